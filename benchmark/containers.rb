@@ -0,0 +1,54 @@
+#!/usr/bin/env ruby
+# frozen_string_literal: true
+
+# Compares Value#container_elements with walking the same containers through
+# synthetic children, on the million-element containers of
+# spec/fixtures/containers.cpp.
+#
+# Usage:
+#   bundle exec rake compile
+#   bundle exec ruby benchmark/containers.rb [child_limit]
+
+require 'benchmark'
+require 'tmpdir'
+require_relative '../lib/lldb'
+
+# Walking a million synthetic children one Value at a time takes minutes, so
+# the per-child loop only covers the first CHILD_LIMIT elements.
+CHILD_LIMIT = Integer(ARGV[0] || 100_000)
+
+Dir.mktmpdir('lldb-ruby-bench') do |directory|
+  executable = File.join(directory, 'containers')
+  source = File.expand_path('../spec/fixtures/containers.cpp', __dir__)
+  system('g++', '-g', '-O0', '-o', executable, source, exception: true)
+
+  LLDB.initialize
+  debugger = LLDB::Debugger.create
+  debugger.async = false
+  target = debugger.create_target(executable)
+  target.breakpoint_create_by_name('lldb_test_containers_ready')
+  process = target.launch
+  frame = process.selected_thread.frame_at_index(1)
+  ints = frame.find_variable('ints')
+  halves = frame.find_variable('halves')
+
+  Benchmark.bm(36) do |bench|
+    bench.report('vector: container_elements') { ints.container_elements }
+    bench.report('vector: each_child') { ints.each_child(batch: 4096, summaries: false).count }
+    bench.report("vector: child_at_index x #{CHILD_LIMIT}") do
+      LLDB.with_scope { CHILD_LIMIT.times { |index| ints.child_at_index(index).value } }
+    end
+    bench.report('unordered_map: container_elements') { halves.container_elements }
+    bench.report('unordered_map: container_elements cached') do
+      process.enable_memory_cache(page_size: 64 * 1024, max_pages: 1024)
+      halves.container_elements
+    ensure
+      process.disable_memory_cache
+    end
+    bench.report('unordered_map: each_child') { halves.each_child(batch: 4096, summaries: false).count }
+  end
+
+  process.kill
+  debugger.close
+  LLDB.terminate
+end
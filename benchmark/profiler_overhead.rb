@@ -0,0 +1,60 @@
+#!/usr/bin/env ruby
+# frozen_string_literal: true
+
+# Measures what the sampling profiler costs the profiled process: runs the
+# CPU-bound mode of spec/fixtures/loop.c to completion under the debugger,
+# without a profiler and then at several sampling rates, and reports the
+# wall-clock slowdown next to the profiler's own pause accounting.
+#
+# Usage:
+#   bundle exec rake compile
+#   bundle exec ruby benchmark/profiler_overhead.rb [rounds]
+
+require 'tmpdir'
+require_relative '../lib/lldb'
+
+# About a microsecond and a half per round at -O0.
+ROUNDS = Integer(ARGV[0] || 2_000_000)
+RATES = [nil, 10, 100, 1000].freeze
+
+def run(debugger, executable, rate)
+  target = debugger.create_target(executable)
+  started = Process.clock_gettime(Process::CLOCK_MONOTONIC)
+  process = target.launch(args: [ROUNDS.to_s])
+  profiler = rate && process.start_profiler(interval: 1.0 / rate)
+  sleep 0.001 until process.state == LLDB::State::EXITED
+  elapsed = Process.clock_gettime(Process::CLOCK_MONOTONIC) - started
+  profiler&.stop
+  [elapsed, profiler&.stats]
+ensure
+  debugger.delete_target(target) if target
+end
+
+Dir.mktmpdir('lldb-ruby-bench') do |directory|
+  executable = File.join(directory, 'loop')
+  source = File.expand_path('../spec/fixtures/loop.c', __dir__)
+  system('gcc', '-g', '-O0', '-o', executable, source, exception: true)
+
+  LLDB.initialize
+  debugger = LLDB::Debugger.create
+  debugger.async = true
+
+  baseline = nil
+  puts format('%-10s %10s %10s %8s %8s %12s %12s', 'rate', 'wall (s)', 'slowdown', 'samples', 'missed',
+              'mean pause', 'max pause')
+  RATES.each do |rate|
+    elapsed, stats = run(debugger, executable, rate)
+    baseline ||= elapsed
+    if stats
+      mean = stats[:samples].zero? ? 0.0 : stats[:paused] / stats[:samples]
+      puts format('%-10s %10.3f %9.1f%% %8d %8d %10.1fus %10.1fus', "#{rate} Hz", elapsed,
+                  (elapsed / baseline - 1) * 100, stats[:samples], stats[:missed], mean * 1e6,
+                  stats[:max_pause] * 1e6)
+    else
+      puts format('%-10s %10.3f', 'off', elapsed)
+    end
+  end
+
+  debugger.close
+  LLDB.terminate
+end
@@ -0,0 +1,69 @@
+#!/usr/bin/env ruby
+# frozen_string_literal: true
+
+# Compares Process#scan_memory with the equivalent Ruby loop over
+# Process#memory_regions, Process#read_memory, and String#index.
+#
+# Usage:
+#   bundle exec rake compile
+#   bundle exec ruby benchmark/scan_memory.rb [pattern]
+
+require 'benchmark'
+require 'tmpdir'
+require_relative '../lib/lldb'
+
+PATTERN = (ARGV[0] || 'Sum: %d').b
+CHUNK_SIZE = 1024 * 1024
+
+def ruby_scan(process, pattern)
+  hits = []
+  process.memory_regions.each do |region|
+    next unless region.mapped? && region.readable?
+
+    address = region.base_address
+    while address < region.end_address
+      size = [CHUNK_SIZE, region.end_address - address].min
+      data = begin
+        process.read_memory(address, size)
+      rescue LLDB::LLDBError
+        break
+      end
+      offset = 0
+      while (found = data.index(pattern, offset))
+        hits << (address + found)
+        offset = found + 1
+      end
+      # Patterns that straddle chunk boundaries are ignored; the native scanner
+      # handles them, which only makes this loop look faster.
+      address += size
+    end
+  end
+  hits
+end
+
+Dir.mktmpdir('lldb-ruby-bench') do |directory|
+  executable = File.join(directory, 'simple')
+  source = File.expand_path('../spec/fixtures/simple.c', __dir__)
+  system('gcc', '-g', '-O0', '-o', executable, source, exception: true)
+
+  LLDB.initialize
+  debugger = LLDB::Debugger.create
+  debugger.async = false
+  target = debugger.create_target(executable)
+  target.breakpoint_create_by_name('main')
+  process = target.launch
+
+  readable = process.memory_regions.select { |region| region.mapped? && region.readable? }
+  puts "scanning #{readable.sum(&:size)} bytes in #{readable.length} regions for #{PATTERN.inspect}"
+
+  native_hits = ruby_hits = nil
+  Benchmark.bm(22) do |bench|
+    bench.report('Process#scan_memory') { native_hits = process.scan_memory(PATTERN, max_hits: 1_000_000) }
+    bench.report('Ruby read + index') { ruby_hits = ruby_scan(process, PATTERN) }
+  end
+  puts "hits: native=#{native_hits.length} ruby=#{ruby_hits.length}"
+
+  process.kill
+  debugger.close
+  LLDB.terminate
+end
@@ -0,0 +1,49 @@
+#!/usr/bin/env ruby
+# frozen_string_literal: true
+
+# Compares symbolicating the same stack PCs through the native cache, cold
+# and warm, with asking each frame for its function, file and line.
+#
+# Usage:
+#   bundle exec rake compile
+#   bundle exec ruby benchmark/symbolicate.rb [iterations]
+
+require 'benchmark'
+require 'tmpdir'
+require_relative '../lib/lldb'
+
+ITERATIONS = Integer(ARGV[0] || 10_000)
+
+Dir.mktmpdir('lldb-ruby-bench') do |directory|
+  executable = File.join(directory, 'loop')
+  source = File.expand_path('../spec/fixtures/loop.c', __dir__)
+  system('gcc', '-g', '-O0', '-o', executable, source, exception: true)
+
+  LLDB.initialize
+  debugger = LLDB::Debugger.create
+  debugger.async = false
+  target = debugger.create_target(executable)
+  target.breakpoint_create_by_name('lldb_test_spin_inner')
+  process = target.launch(args: ['1'])
+  thread = process.selected_thread
+  frames = thread.frames
+  addresses = frames.each_with_index.map { |frame, index| index.zero? ? frame.pc : frame.pc - 1 }
+
+  Benchmark.bm(28) do |bench|
+    bench.report('frame getters') do
+      ITERATIONS.times { frames.each { |frame| [frame.function_name, frame.file_path, frame.line] } }
+    end
+    bench.report('symbolicate, cold cache') do
+      ITERATIONS.times do
+        LLDB::Target.clear_symbol_cache
+        target.symbolicate(addresses)
+      end
+    end
+    bench.report('symbolicate, warm cache') { ITERATIONS.times { target.symbolicate(addresses) } }
+  end
+  puts "cache: #{LLDB::Target.symbol_cache_stats}"
+
+  process.kill
+  debugger.close
+  LLDB.terminate
+end
@@ -14,7 +14,7 @@ unless RbConfig::CONFIG['host_os'] =~ /darwin|linux/
 end
 
 $CXXFLAGS ||= ''
-$CXXFLAGS << ' -std=c++17'
+$CXXFLAGS << ' -std=c++17 -pthread'
 
 def run_command(*command)
   stdout, stderr, status = Open3.capture3(*command)
@@ -194,6 +194,9 @@ function_get_base_name = api_capability_probe(
 basic_type_char8 = api_capability_probe(
   compiler, selected, 'SBType.h', 'static_cast<int>(lldb::eBasicTypeChar8)'
 )
+type_get_module = api_capability_probe(
+  compiler, selected, 'SBType.h', '&lldb::SBType::GetModule'
+)
 build_version = llvm_config_version(selected)
 config_path = File.expand_path('lldb_wrapper_config.h', __dir__)
 File.write(config_path, <<~HEADER)
@@ -209,6 +212,7 @@ File.write(config_path, <<~HEADER)
   #define LLDB_RUBY_HAVE_SYMBOL_GET_SIZE #{symbol_get_size ? 1 : 0}
   #define LLDB_RUBY_HAVE_FUNCTION_GET_BASE_NAME #{function_get_base_name ? 1 : 0}
   #define LLDB_RUBY_HAVE_BASIC_TYPE_CHAR8 #{basic_type_char8 ? 1 : 0}
+  #define LLDB_RUBY_HAVE_TYPE_GET_MODULE #{type_get_module ? 1 : 0}
 
   #endif
 HEADER
@@ -219,11 +223,13 @@ puts "SBSymbol::GetValue capability: #{symbol_get_value ? 'supported' : 'unsuppo
 puts "SBSymbol::GetSize capability: #{symbol_get_size ? 'supported' : 'unsupported'}"
 puts "SBFunction::GetBaseName capability: #{function_get_base_name ? 'supported' : 'unsupported'}"
 puts "BasicType::Char8 capability: #{basic_type_char8 ? 'supported' : 'unsupported'}"
+puts "SBType::GetModule capability: #{type_get_module ? 'supported' : 'unsupported'}"
 puts "Build LLDB version: #{build_version}"
 
 $CXXFLAGS << " -I#{selected.include_dir}"
 $LDFLAGS << " -L#{selected.lib_dir} -llldb"
 $LDFLAGS << " -Wl,-rpath,#{selected.lib_dir}"
+$LDFLAGS << ' -pthread'
 $LDFLAGS << if RbConfig::CONFIG['host_os'] =~ /darwin/
               ' -lc++'
             else
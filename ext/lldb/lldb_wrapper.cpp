@@ -4,9 +4,46 @@
 
 #include <algorithm>
 #include <string>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
 #include <cstring>
 #include <exception>
+#include <initializer_list>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <new>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define WRAPPER_HAVE_POSIX_FILES 1
+#else
+#define WRAPPER_HAVE_POSIX_FILES 0
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define WRAPPER_HAVE_AVX2 1
+#else
+#define WRAPPER_HAVE_AVX2 0
+#endif
+#if defined(__GNUC__) && defined(__SSE2__)
+#define WRAPPER_HAVE_SSE2 1
+#else
+#define WRAPPER_HAVE_SSE2 0
+#endif
 
 // Thread-local storage for temporary strings
 static thread_local std::string g_temp_string;
@@ -19,56 +56,3706 @@ static void wrapper_clear_error_state() noexcept {
     g_last_error_message[0] = '\0';
 }
 
-static void wrapper_set_error_state(const char* message) noexcept {
-    g_last_error_code = LLDB_RUBY_STATUS_INTERNAL_ERROR;
-    if (!message) message = "unknown native exception";
-    std::strncpy(g_last_error_message, message, sizeof(g_last_error_message) - 1);
-    g_last_error_message[sizeof(g_last_error_message) - 1] = '\0';
-}
+static void wrapper_set_error_state(const char* message) noexcept {
+    g_last_error_code = LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    if (!message) message = "unknown native exception";
+    std::strncpy(g_last_error_message, message, sizeof(g_last_error_message) - 1);
+    g_last_error_message[sizeof(g_last_error_message) - 1] = '\0';
+}
+
+static void wrapper_set_invalid_argument(lldb::SBError* error, const char* message) noexcept {
+    if (error) error->SetErrorString(message);
+}
+
+static void wrapper_copy_error(lldb_error_t output, const lldb::SBError& error) {
+    if (output) *static_cast<lldb::SBError*>(output) = error;
+}
+
+static lldb_ruby_status_t wrapper_status(lldb::SBError& error, lldb_error_t output) {
+    wrapper_copy_error(output, error);
+    return error.Success() ? LLDB_RUBY_STATUS_OK : LLDB_RUBY_STATUS_LLDB_ERROR;
+}
+
+static bool wrapper_copy_file_spec_path(const lldb::SBFileSpec& file_spec,
+                                        std::string& output) {
+    size_t capacity = 256;
+    for (;;) {
+        output.resize(capacity);
+        uint32_t written = file_spec.GetPath(output.data(), output.size());
+        if (written < output.size() - 1) {
+            output.resize(written);
+            return written > 0;
+        }
+
+        capacity = std::max(capacity * 2, static_cast<size_t>(written) + 2);
+    }
+}
+
+// Opt-in page cache for inferior memory reads. Caches are keyed by
+// SBProcess::GetUniqueID() and only serve reads while the process stays at
+// the stop they were filled at; a new stop ID (resume, step, or expression
+// evaluation) drops every cached page.
+struct WrapperPageCache {
+    struct Page {
+        std::vector<uint8_t> bytes;
+        std::list<uint64_t>::iterator recent;
+    };
+
+    std::mutex mutex;
+    // Kept so caches of processes that exit on their own can be swept.
+    lldb::SBProcess process;
+    uint32_t page_size = 0;
+    size_t max_pages = 0;
+    uint32_t stop_id = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    // Bumped on resume and when the cache is dropped; running prefetches stop
+    // when it no longer matches the value they started with.
+    std::atomic<uint64_t> prefetch_generation{0};
+    // Bumped whenever pages are dropped or written over; a prefetch discards
+    // bytes it read while the epoch moved.
+    uint64_t epoch = 0;
+    std::list<uint64_t> recent_pages;
+    std::unordered_map<uint64_t, Page> pages;
+
+    void clear() {
+        ++epoch;
+        pages.clear();
+        recent_pages.clear();
+    }
+
+    const Page* find(uint64_t page_address) {
+        auto found = pages.find(page_address);
+        if (found == pages.end()) return nullptr;
+        recent_pages.splice(recent_pages.begin(), recent_pages, found->second.recent);
+        return &found->second;
+    }
+
+    void insert(uint64_t page_address, const uint8_t* bytes) {
+        while (pages.size() >= max_pages && !recent_pages.empty()) {
+            pages.erase(recent_pages.back());
+            recent_pages.pop_back();
+        }
+        recent_pages.push_front(page_address);
+        Page& page = pages[page_address];
+        page.bytes.assign(bytes, bytes + page_size);
+        page.recent = recent_pages.begin();
+    }
+
+    void invalidate(uint64_t address, uint64_t size) {
+        if (size == 0) return;
+        ++epoch;
+        if (pages.empty()) return;
+        if (address > UINT64_MAX - (size - 1)) {
+            clear();
+            return;
+        }
+
+        uint64_t mask = ~static_cast<uint64_t>(page_size - 1);
+        uint64_t first = address & mask;
+        uint64_t last = (address + (size - 1)) & mask;
+        if ((last - first) / page_size >= pages.size()) {
+            for (auto page = pages.begin(); page != pages.end();) {
+                if (page->first < first || page->first > last) {
+                    ++page;
+                    continue;
+                }
+                recent_pages.erase(page->second.recent);
+                page = pages.erase(page);
+            }
+            return;
+        }
+
+        for (uint64_t page_address = first;; page_address += page_size) {
+            auto page = pages.find(page_address);
+            if (page != pages.end()) {
+                recent_pages.erase(page->second.recent);
+                pages.erase(page);
+            }
+            if (page_address == last) break;
+        }
+    }
+};
+
+static std::mutex g_page_caches_mutex;
+static std::unordered_map<uint32_t, std::shared_ptr<WrapperPageCache>> g_page_caches;
+
+static std::shared_ptr<WrapperPageCache> wrapper_find_page_cache(lldb::SBProcess& process) {
+    std::lock_guard<std::mutex> lock(g_page_caches_mutex);
+    if (g_page_caches.empty()) return nullptr;
+    auto found = g_page_caches.find(process.GetUniqueID());
+    return found == g_page_caches.end() ? nullptr : found->second;
+}
+
+static void wrapper_drop_page_cache(lldb::SBProcess& process) {
+    std::lock_guard<std::mutex> lock(g_page_caches_mutex);
+    if (g_page_caches.empty()) return;
+    auto found = g_page_caches.find(process.GetUniqueID());
+    if (found == g_page_caches.end()) return;
+    ++found->second->prefetch_generation;
+    g_page_caches.erase(found);
+}
+
+// True once the process can no longer stop again, so its cache is dead weight.
+static bool wrapper_page_cache_process_gone(lldb::SBProcess& process) {
+    if (!process.IsValid()) return true;
+    lldb::StateType state = process.GetState();
+    return state == lldb::eStateExited || state == lldb::eStateDetached || state == lldb::eStateInvalid;
+}
+
+// Drops caches whose process exited without going through kill, detach, or
+// destroy. Process states are queried outside the registry lock.
+static void wrapper_sweep_page_caches() {
+    std::vector<std::shared_ptr<WrapperPageCache>> caches;
+    {
+        std::lock_guard<std::mutex> lock(g_page_caches_mutex);
+        caches.reserve(g_page_caches.size());
+        for (const auto& entry : g_page_caches) caches.push_back(entry.second);
+    }
+
+    for (const std::shared_ptr<WrapperPageCache>& cache : caches) {
+        if (!wrapper_page_cache_process_gone(cache->process)) continue;
+        std::lock_guard<std::mutex> lock(g_page_caches_mutex);
+        for (auto entry = g_page_caches.begin(); entry != g_page_caches.end(); ++entry) {
+            if (entry->second != cache) continue;
+            ++cache->prefetch_generation;
+            g_page_caches.erase(entry);
+            break;
+        }
+    }
+}
+
+static std::shared_ptr<WrapperPageCache> wrapper_install_page_cache(lldb::SBProcess& process,
+                                                                   uint32_t page_size,
+                                                                   uint32_t max_pages) {
+    wrapper_sweep_page_caches();
+    std::shared_ptr<WrapperPageCache> cache = std::make_shared<WrapperPageCache>();
+    cache->process = process;
+    cache->page_size = page_size;
+    cache->max_pages = max_pages;
+    cache->stop_id = process.GetStopID(true);
+    std::lock_guard<std::mutex> lock(g_page_caches_mutex);
+    std::shared_ptr<WrapperPageCache>& slot = g_page_caches[process.GetUniqueID()];
+    if (slot) ++slot->prefetch_generation;
+    slot = cache;
+    return cache;
+}
+
+// Called before the process resumes: pages a prefetch loaded from now on
+// would belong to a stop that is about to end.
+static void wrapper_cancel_prefetches(lldb::SBProcess& process) {
+    std::shared_ptr<WrapperPageCache> cache = wrapper_find_page_cache(process);
+    if (cache) ++cache->prefetch_generation;
+}
+
+static void wrapper_cancel_thread_prefetches(lldb::SBThread& thread) {
+    lldb::SBProcess process = thread.GetProcess();
+    if (process.IsValid()) wrapper_cancel_prefetches(process);
+}
+
+static void wrapper_invalidate_page_cache(lldb::SBProcess& process, uint64_t address, uint64_t size) {
+    std::shared_ptr<WrapperPageCache> cache = wrapper_find_page_cache(process);
+    if (!cache) return;
+    std::lock_guard<std::mutex> lock(cache->mutex);
+    cache->invalidate(address, size);
+}
+
+static void wrapper_flush_page_cache(lldb::SBProcess& process) {
+    std::shared_ptr<WrapperPageCache> cache = wrapper_find_page_cache(process);
+    if (!cache) return;
+    std::lock_guard<std::mutex> lock(cache->mutex);
+    cache->clear();
+}
+
+// Reads inferior memory, serving whole pages from the process page cache
+// when one is enabled and the process is stopped. Runs of missing pages are
+// fetched with a single ReadMemory call. If a page cannot be read in full the
+// remainder falls back to an uncached read, so partial reads and errors match
+// SBProcess::ReadMemory exactly.
+static size_t wrapper_read_process_memory(lldb::SBProcess& process,
+                                          uint64_t address,
+                                          void* buffer,
+                                          size_t size,
+                                          lldb::SBError& error) {
+    std::shared_ptr<WrapperPageCache> cache = size > 0 ? wrapper_find_page_cache(process) : nullptr;
+    lldb::StateType state = cache ? process.GetState() : lldb::eStateInvalid;
+    if (cache && (state == lldb::eStateExited || state == lldb::eStateDetached)) {
+        wrapper_drop_page_cache(process);
+        cache.reset();
+    }
+    if (!cache || (state != lldb::eStateStopped && state != lldb::eStateCrashed)) {
+        return process.ReadMemory(address, buffer, size, error);
+    }
+
+    std::lock_guard<std::mutex> lock(cache->mutex);
+    uint32_t stop_id = process.GetStopID(true);
+    if (stop_id != cache->stop_id) {
+        cache->clear();
+        cache->stop_id = stop_id;
+    }
+
+    const uint64_t page_size = cache->page_size;
+    const uint64_t mask = ~(page_size - 1);
+    if (address > UINT64_MAX - size ||
+        ((address + size - 1) & mask) / page_size - (address & mask) / page_size >= cache->max_pages) {
+        return process.ReadMemory(address, buffer, size, error);
+    }
+
+    uint8_t* output = static_cast<uint8_t*>(buffer);
+    std::vector<uint8_t> run;
+    size_t copied = 0;
+    while (copied < size) {
+        uint64_t current = address + copied;
+        uint64_t page_address = current & mask;
+        size_t page_offset = static_cast<size_t>(current - page_address);
+        size_t chunk = std::min<size_t>(size - copied, page_size - page_offset);
+
+        if (const WrapperPageCache::Page* page = cache->find(page_address)) {
+            ++cache->hits;
+            std::memcpy(output + copied, page->bytes.data() + page_offset, chunk);
+            copied += chunk;
+            continue;
+        }
+
+        uint64_t last_page = (address + size - 1) & mask;
+        uint64_t run_pages = 1;
+        while (page_address + run_pages * page_size <= last_page &&
+               cache->pages.find(page_address + run_pages * page_size) == cache->pages.end()) {
+            ++run_pages;
+        }
+
+        cache->misses += run_pages;
+        run.resize(static_cast<size_t>(run_pages * page_size));
+        lldb::SBError run_error;
+        size_t available = process.ReadMemory(page_address, run.data(), run.size(), run_error);
+        uint64_t complete_pages = available / page_size;
+        for (uint64_t index = 0; index < complete_pages; ++index) {
+            cache->insert(page_address + index * page_size, run.data() + index * page_size);
+        }
+
+        size_t complete_bytes = static_cast<size_t>(complete_pages * page_size);
+        if (complete_bytes > page_offset) {
+            size_t usable = std::min(size - copied, complete_bytes - page_offset);
+            std::memcpy(output + copied, run.data() + page_offset, usable);
+            copied += usable;
+        }
+        if (complete_pages < run_pages) {
+            return copied + process.ReadMemory(address + copied, output + copied, size - copied, error);
+        }
+    }
+    return copied;
+}
+
+// Enumerates the inferior address space. SBProcess::GetMemoryRegions is
+// preferred; when a platform reports no list, the map is walked with
+// GetMemoryRegionInfo the same way LLDB builds it. Region names are
+// deduplicated into `names` as NUL-terminated strings when it is provided.
+static void wrapper_collect_memory_regions(lldb::SBProcess& process,
+                                           std::vector<lldb_ruby_memory_region_t>& regions,
+                                           std::string* names) {
+    regions.clear();
+    if (names) names->clear();
+
+    std::unordered_map<std::string, uint64_t> name_offsets;
+    auto append = [&](lldb::SBMemoryRegionInfo& info) {
+        lldb_ruby_memory_region_t region;
+        region.base = info.GetRegionBase();
+        region.end = info.GetRegionEnd();
+        region.permissions = (info.IsReadable() ? lldb::ePermissionsReadable : 0) |
+                             (info.IsWritable() ? lldb::ePermissionsWritable : 0) |
+                             (info.IsExecutable() ? lldb::ePermissionsExecutable : 0);
+        region.mapped = info.IsMapped() ? 1 : 0;
+        region.name_offset = UINT64_MAX;
+
+        const char* name = names ? info.GetName() : nullptr;
+        if (name && *name) {
+            auto inserted = name_offsets.emplace(name, names->size());
+            if (inserted.second) names->append(name, std::strlen(name) + 1);
+            region.name_offset = inserted.first->second;
+        }
+        regions.push_back(region);
+    };
+
+    lldb::SBMemoryRegionInfoList list = process.GetMemoryRegions();
+    uint32_t count = list.GetSize();
+    regions.reserve(count);
+    for (uint32_t index = 0; index < count; ++index) {
+        lldb::SBMemoryRegionInfo info;
+        if (list.GetMemoryRegionAtIndex(index, info)) append(info);
+    }
+    if (!regions.empty()) return;
+
+    uint64_t address = 0;
+    for (;;) {
+        lldb::SBMemoryRegionInfo info;
+        if (process.GetMemoryRegionInfo(address, info).Fail()) break;
+        append(info);
+
+        uint64_t end = info.GetRegionEnd();
+        if (end <= address || end == LLDB_INVALID_ADDRESS) break;
+        address = end;
+    }
+}
+
+static bool wrapper_is_valid_page_size(uint64_t page_size) {
+    return page_size >= 64 && (page_size & (page_size - 1)) == 0;
+}
+
+// Coalesced batch reads are capped so that a batch of scattered ranges never
+// forces a single huge scratch allocation.
+static const uint64_t kWrapperMaxCoalescedRead = 1024 * 1024;
+
+static bool wrapper_memory_range_is_valid(const lldb_ruby_memory_range_t& range,
+                                          size_t buffer_size) {
+    if (range.offset > buffer_size || range.size > buffer_size - range.offset) return false;
+    return range.address <= UINT64_MAX - range.size;
+}
+
+static void wrapper_record_first_error(lldb::SBError& first_error,
+                                       bool& failed,
+                                       const lldb::SBError& error) {
+    if (failed || error.Success()) return;
+    first_error = error;
+    failed = true;
+}
+
+// Reads every range in `ranges` into `buffer`, issuing one ReadMemory call per
+// run of adjacent or overlapping ranges. Ranges that a coalesced read does not
+// fully cover are retried individually so one unmapped page cannot hide the
+// rest of its run.
+static void wrapper_read_memory_ranges(lldb::SBProcess& process,
+                                       const lldb_ruby_memory_range_t* ranges,
+                                       size_t count,
+                                       uint8_t* buffer,
+                                       uint64_t* bytes_read,
+                                       lldb::SBError& first_error) {
+    std::vector<size_t> order;
+    order.reserve(count);
+    for (size_t index = 0; index < count; ++index) {
+        bytes_read[index] = 0;
+        if (ranges[index].size > 0) order.push_back(index);
+    }
+    std::sort(order.begin(), order.end(), [ranges](size_t left, size_t right) {
+        return ranges[left].address < ranges[right].address;
+    });
+
+    bool failed = false;
+    std::vector<uint8_t> scratch;
+    size_t group_begin = 0;
+    while (group_begin < order.size()) {
+        const lldb_ruby_memory_range_t& first = ranges[order[group_begin]];
+        uint64_t start = first.address;
+        uint64_t end = first.address + first.size;
+        size_t group_end = group_begin + 1;
+        while (group_end < order.size()) {
+            const lldb_ruby_memory_range_t& next = ranges[order[group_end]];
+            uint64_t next_end = std::max(end, next.address + next.size);
+            if (next.address > end || next_end - start > kWrapperMaxCoalescedRead) break;
+            end = next_end;
+            ++group_end;
+        }
+
+        if (group_end - group_begin == 1) {
+            lldb::SBError error;
+            bytes_read[order[group_begin]] = wrapper_read_process_memory(
+                process, first.address, buffer + first.offset, first.size, error);
+            wrapper_record_first_error(first_error, failed, error);
+            group_begin = group_end;
+            continue;
+        }
+
+        scratch.resize(static_cast<size_t>(end - start));
+        lldb::SBError error;
+        size_t available = wrapper_read_process_memory(process, start, scratch.data(), scratch.size(), error);
+        for (size_t position = group_begin; position < group_end; ++position) {
+            size_t index = order[position];
+            const lldb_ruby_memory_range_t& range = ranges[index];
+            uint64_t relative = range.address - start;
+            if (relative + range.size <= available) {
+                std::memcpy(buffer + range.offset, scratch.data() + relative, range.size);
+                bytes_read[index] = range.size;
+                continue;
+            }
+
+            lldb::SBError range_error;
+            bytes_read[index] = wrapper_read_process_memory(
+                process, range.address, buffer + range.offset, range.size, range_error);
+            wrapper_record_first_error(first_error, failed, range_error);
+        }
+        group_begin = group_end;
+    }
+}
+
+// Reads inferior memory through aligned blocks that stay cached for the
+// lifetime of the reader, so walks over nearby nodes cost one LLDB read per
+// block instead of one per node. Blocks that start in unreadable memory fall
+// back to reading the requested range directly.
+struct WrapperBlockReader {
+    lldb::SBProcess& process;
+    uint64_t block_size;
+    size_t max_blocks;
+    std::unordered_map<uint64_t, std::vector<uint8_t>> blocks;
+
+    WrapperBlockReader(lldb::SBProcess& sb_process, uint64_t size, size_t limit)
+        : process(sb_process), block_size(size), max_blocks(limit) {}
+
+    size_t read(uint64_t address, void* buffer, size_t size) {
+        uint8_t* destination = static_cast<uint8_t*>(buffer);
+        size_t copied = 0;
+        while (copied < size) {
+            uint64_t current = address + copied;
+            uint64_t base = current & ~(block_size - 1);
+            auto block = blocks.find(base);
+            if (block == blocks.end()) {
+                if (blocks.size() >= max_blocks) blocks.clear();
+                std::vector<uint8_t> bytes(static_cast<size_t>(block_size));
+                lldb::SBError error;
+                bytes.resize(wrapper_read_process_memory(process, base, bytes.data(), bytes.size(), error));
+                block = blocks.emplace(base, std::move(bytes)).first;
+            }
+
+            uint64_t offset = current - base;
+            if (offset >= block->second.size()) {
+                lldb::SBError error;
+                return copied + wrapper_read_process_memory(process, current, destination + copied, size - copied, error);
+            }
+            size_t length = static_cast<size_t>(std::min<uint64_t>(size - copied, block->second.size() - offset));
+            std::memcpy(destination + copied, block->second.data() + offset, length);
+            copied += length;
+            if (block->second.size() < block_size && copied < size) {
+                lldb::SBError error;
+                return copied + wrapper_read_process_memory(process, address + copied, destination + copied, size - copied, error);
+            }
+        }
+        return copied;
+    }
+};
+
+static const uint64_t kWrapperWalkBlockSize = 16 * 1024;
+static const size_t kWrapperWalkMaxBlocks = 4096;
+
+// Returns the size of one element in inferior memory, or 0 for an unknown type.
+static size_t wrapper_element_source_size(uint32_t element_type, uint32_t address_byte_size) {
+    switch (element_type) {
+    case LLDB_RUBY_ELEMENT_INT8:
+    case LLDB_RUBY_ELEMENT_UINT8:
+        return 1;
+    case LLDB_RUBY_ELEMENT_INT16:
+    case LLDB_RUBY_ELEMENT_UINT16:
+        return 2;
+    case LLDB_RUBY_ELEMENT_INT32:
+    case LLDB_RUBY_ELEMENT_UINT32:
+    case LLDB_RUBY_ELEMENT_FLOAT:
+        return 4;
+    case LLDB_RUBY_ELEMENT_INT64:
+    case LLDB_RUBY_ELEMENT_UINT64:
+    case LLDB_RUBY_ELEMENT_DOUBLE:
+        return 8;
+    case LLDB_RUBY_ELEMENT_POINTER:
+        return address_byte_size == 4 || address_byte_size == 8 ? address_byte_size : 0;
+    default:
+        return 0;
+    }
+}
+
+static bool wrapper_host_is_little_endian() {
+    const uint16_t probe = 1;
+    uint8_t first;
+    std::memcpy(&first, &probe, 1);
+    return first == 1;
+}
+
+static void wrapper_swap_elements(uint8_t* data, size_t element_size, size_t count) {
+    for (size_t index = 0; index < count; ++index, data += element_size) {
+        std::reverse(data, data + element_size);
+    }
+}
+
+// Converts one element from target layout into its host representation.
+// Pointers narrower than 64 bits are zero-extended.
+static void wrapper_decode_element(const uint8_t* source,
+                                   size_t source_size,
+                                   bool swap,
+                                   uint8_t* destination,
+                                   size_t destination_size) {
+    uint8_t scratch[8];
+    std::memcpy(scratch, source, source_size);
+    if (swap) std::reverse(scratch, scratch + source_size);
+    if (destination_size == source_size) {
+        std::memcpy(destination, scratch, source_size);
+        return;
+    }
+
+    uint64_t widened = 0;
+    if (source_size == 4) {
+        uint32_t narrow;
+        std::memcpy(&narrow, scratch, sizeof(narrow));
+        widened = narrow;
+    }
+    std::memcpy(destination, &widened, sizeof(widened));
+}
+
+// Memory scans stream each region through a buffer of this size.
+static const size_t kWrapperScanChunkSize = 1024 * 1024;
+static const uint64_t kWrapperScanSkipAlignment = 4096;
+
+static bool wrapper_region_matches_filter(const lldb_ruby_memory_region_t& region,
+                                          const lldb_ruby_memory_scan_filter_t& filter) {
+    if (!region.mapped || !(region.permissions & lldb::ePermissionsReadable)) return false;
+    if ((region.permissions & filter.required_permissions) != filter.required_permissions) return false;
+    return (region.permissions & filter.excluded_permissions) == 0;
+}
+
+// Streams [begin, end) through `buffer`, keeping the last `overlap` bytes of
+// each chunk in front of the next one so a match that straddles a chunk
+// boundary is still seen exactly once. A short read skips to the next page
+// and restarts the overlap. `visit(base, data, size)` returns false to stop.
+template <typename Visit>
+static bool wrapper_stream_memory(lldb::SBProcess& process,
+                                  uint64_t begin,
+                                  uint64_t end,
+                                  size_t overlap,
+                                  std::vector<uint8_t>& buffer,
+                                  Visit&& visit) {
+    size_t chunk = buffer.size() - overlap;
+    size_t carried = 0;
+    uint64_t address = begin;
+    while (address < end) {
+        size_t wanted = static_cast<size_t>(std::min<uint64_t>(chunk, end - address));
+        lldb::SBError error;
+        size_t got = wrapper_read_process_memory(process, address, buffer.data() + carried, wanted, error);
+        size_t available = carried + got;
+        if (available > 0 && !visit(address - carried, buffer.data(), available)) return false;
+
+        if (got < wanted) {
+            uint64_t failed = address + got;
+            uint64_t next = (failed | (kWrapperScanSkipAlignment - 1));
+            if (next >= end - 1) break;
+            address = next + 1;
+            carried = 0;
+            continue;
+        }
+
+        address += got;
+        carried = std::min(overlap, available);
+        std::memmove(buffer.data(), buffer.data() + available - carried, carried);
+    }
+    return true;
+}
+
+// Anchor search: returns the first index in [begin, end) whose byte satisfies
+// (data[index] & mask) == value, or `end`. The SIMD variants fall back to the
+// scalar loop for their tails.
+static size_t wrapper_find_anchor_scalar(const uint8_t* data,
+                                         size_t begin,
+                                         size_t end,
+                                         uint8_t value,
+                                         uint8_t mask) {
+    if (begin >= end) return end;
+    if (mask == 0xFF) {
+        const void* found = std::memchr(data + begin, value, end - begin);
+        return found ? static_cast<size_t>(static_cast<const uint8_t*>(found) - data) : end;
+    }
+    for (; begin < end; ++begin) {
+        if ((data[begin] & mask) == value) return begin;
+    }
+    return end;
+}
+
+#if WRAPPER_HAVE_SSE2
+static size_t wrapper_find_anchor_sse2(const uint8_t* data,
+                                       size_t begin,
+                                       size_t end,
+                                       uint8_t value,
+                                       uint8_t mask) {
+    const __m128i needle = _mm_set1_epi8(static_cast<char>(value));
+    const __m128i bits = _mm_set1_epi8(static_cast<char>(mask));
+    while (end - begin >= 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + begin));
+        int matches = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(block, bits), needle));
+        if (matches) return begin + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(matches)));
+        begin += 16;
+    }
+    return wrapper_find_anchor_scalar(data, begin, end, value, mask);
+}
+#endif
+
+#if WRAPPER_HAVE_AVX2
+__attribute__((target("avx2"))) static size_t wrapper_find_anchor_avx2(const uint8_t* data,
+                                                                       size_t begin,
+                                                                       size_t end,
+                                                                       uint8_t value,
+                                                                       uint8_t mask) {
+    const __m256i needle = _mm256_set1_epi8(static_cast<char>(value));
+    const __m256i bits = _mm256_set1_epi8(static_cast<char>(mask));
+    while (end - begin >= 32) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + begin));
+        unsigned matches = static_cast<unsigned>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(block, bits), needle)));
+        if (matches) return begin + static_cast<size_t>(__builtin_ctz(matches));
+        begin += 32;
+    }
+    return wrapper_find_anchor_scalar(data, begin, end, value, mask);
+}
+#endif
+
+using WrapperAnchorFinder = size_t (*)(const uint8_t*, size_t, size_t, uint8_t, uint8_t);
+
+static WrapperAnchorFinder wrapper_anchor_finder() {
+    static const WrapperAnchorFinder finder = [] {
+#if WRAPPER_HAVE_AVX2
+        if (__builtin_cpu_supports("avx2")) return &wrapper_find_anchor_avx2;
+#endif
+#if WRAPPER_HAVE_SSE2
+        return &wrapper_find_anchor_sse2;
+#else
+        return &wrapper_find_anchor_scalar;
+#endif
+    }();
+    return finder;
+}
+
+// Masked byte pattern. Bytes are stored pre-masked and the anchor is the most
+// specific byte, which the vectorized search looks for before verifying the
+// whole pattern.
+struct WrapperBytePattern {
+    std::vector<uint8_t> bytes;
+    std::vector<uint8_t> mask;
+    size_t anchor = 0;
+
+    bool assign(const uint8_t* pattern, const uint8_t* pattern_mask, size_t size) {
+        bytes.resize(size);
+        mask.resize(size);
+        int best_bits = 0;
+        for (size_t index = 0; index < size; ++index) {
+            mask[index] = pattern_mask ? pattern_mask[index] : 0xFF;
+            bytes[index] = pattern[index] & mask[index];
+            int bits = __builtin_popcount(mask[index]);
+            if (bits > best_bits) {
+                best_bits = bits;
+                anchor = index;
+            }
+        }
+        return best_bits > 0;
+    }
+
+    bool matches(const uint8_t* data) const {
+        for (size_t index = 0; index < bytes.size(); ++index) {
+            if ((data[index] & mask[index]) != bytes[index]) return false;
+        }
+        return true;
+    }
+};
+
+// Calls `emit(offset)` for every match that fits entirely inside data[0, size).
+// Returns false if `emit` asked to stop.
+template <typename Emit>
+static bool wrapper_find_pattern(const uint8_t* data,
+                                 size_t size,
+                                 const WrapperBytePattern& pattern,
+                                 Emit&& emit) {
+    if (size < pattern.bytes.size()) return true;
+    const size_t limit = size - pattern.bytes.size() + 1;
+    const uint8_t* anchor_data = data + pattern.anchor;
+    const uint8_t value = pattern.bytes[pattern.anchor];
+    const uint8_t mask = pattern.mask[pattern.anchor];
+    WrapperAnchorFinder find = wrapper_anchor_finder();
+    for (size_t position = find(anchor_data, 0, limit, value, mask); position < limit;
+         position = find(anchor_data, position + 1, limit, value, mask)) {
+        if (pattern.matches(data + position) && !emit(position)) return false;
+    }
+    return true;
+}
+
+static_assert(sizeof(lldb_ruby_memory_snapshot_header_t) == 64, "unexpected memory snapshot header size");
+static_assert(sizeof(lldb_ruby_memory_snapshot_region_t) == 32, "unexpected memory snapshot region size");
+
+// Snapshot data is read in large chunks and every region is aligned so that a
+// mapped snapshot can hand out page-aligned views of captured memory.
+static const size_t kWrapperSnapshotChunkSize = 8 * 1024 * 1024;
+static const uint64_t kWrapperSnapshotAlignment = 4096;
+
+static uint64_t wrapper_align_up(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+#if WRAPPER_HAVE_POSIX_FILES
+// Writes all of `data` at `offset`, retrying short and interrupted writes.
+static bool wrapper_pwrite_all(int fd, const void* data, size_t size, uint64_t offset) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+        ssize_t written = ::pwrite(fd, bytes, size, static_cast<off_t>(offset));
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        bytes += written;
+        size -= static_cast<size_t>(written);
+        offset += static_cast<uint64_t>(written);
+    }
+    return true;
+}
+
+// Read-only mapping of a snapshot file. The header and index are validated on
+// open so lookups can trust every record.
+struct WrapperMemorySnapshot {
+    void* mapping = MAP_FAILED;
+    size_t mapping_size = 0;
+    const lldb_ruby_memory_snapshot_header_t* header = nullptr;
+    const lldb_ruby_memory_snapshot_region_t* regions = nullptr;
+
+    ~WrapperMemorySnapshot() {
+        if (mapping != MAP_FAILED) ::munmap(mapping, mapping_size);
+    }
+
+    const uint8_t* bytes() const { return static_cast<const uint8_t*>(mapping); }
+
+    bool validate() {
+        if (mapping_size < sizeof(lldb_ruby_memory_snapshot_header_t)) return false;
+        header = static_cast<const lldb_ruby_memory_snapshot_header_t*>(mapping);
+        if (std::memcmp(header->magic, LLDB_RUBY_MEMORY_SNAPSHOT_MAGIC, sizeof(header->magic)) != 0 ||
+            header->version != LLDB_RUBY_MEMORY_SNAPSHOT_VERSION ||
+            header->header_size != sizeof(lldb_ruby_memory_snapshot_header_t) ||
+            header->index_offset % alignof(lldb_ruby_memory_snapshot_region_t) != 0 ||
+            header->index_offset > mapping_size ||
+            header->region_count > (mapping_size - header->index_offset) / sizeof(lldb_ruby_memory_snapshot_region_t)) {
+            return false;
+        }
+
+        regions = reinterpret_cast<const lldb_ruby_memory_snapshot_region_t*>(bytes() + header->index_offset);
+        uint64_t previous_end = 0;
+        for (uint64_t index = 0; index < header->region_count; ++index) {
+            const lldb_ruby_memory_snapshot_region_t& region = regions[index];
+            if (region.address < previous_end || region.address > UINT64_MAX - region.size ||
+                region.file_offset > header->index_offset ||
+                region.size > header->index_offset - region.file_offset) {
+                return false;
+            }
+            previous_end = region.address + region.size;
+        }
+        return true;
+    }
+};
+#endif
+
+// Small pool of worker threads that runs one batch of indexed tasks at a time.
+// start() returns immediately so callers can overlap LLDB reads with the
+// batch; wait() blocks until every index has run and rethrows the first
+// exception a task raised. Declare the pool after any buffer its tasks use so
+// that the destructor drains the batch before those buffers go away.
+class WrapperWorkerPool {
+public:
+    explicit WrapperWorkerPool(size_t thread_count = default_thread_count()) {
+        for (size_t index = 0; index < thread_count; ++index) {
+            threads.emplace_back([this] { work(); });
+        }
+    }
+
+    ~WrapperWorkerPool() {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            done.wait(lock, [this] { return remaining == 0; });
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& thread : threads) thread.join();
+    }
+
+    WrapperWorkerPool(const WrapperWorkerPool&) = delete;
+    WrapperWorkerPool& operator=(const WrapperWorkerPool&) = delete;
+
+    static size_t default_thread_count() {
+        unsigned hardware = std::thread::hardware_concurrency();
+        return std::max(1u, std::min(8u, hardware));
+    }
+
+    void start(size_t count, std::function<void(size_t)> batch) {
+        wait();
+        if (count == 0) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            task = std::move(batch);
+            next = 0;
+            total = count;
+            remaining = count;
+        }
+        wake.notify_all();
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this] { return remaining == 0; });
+        if (failure) {
+            std::exception_ptr raised = failure;
+            failure = nullptr;
+            std::rethrow_exception(raised);
+        }
+    }
+
+    void run(size_t count, std::function<void(size_t)> batch) {
+        start(count, std::move(batch));
+        wait();
+    }
+
+private:
+    void work() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            wake.wait(lock, [this] { return stopping || next < total; });
+            if (stopping) return;
+
+            size_t index = next++;
+            lock.unlock();
+            try {
+                task(index);
+            } catch (...) {
+                lock.lock();
+                if (!failure) failure = std::current_exception();
+                lock.unlock();
+            }
+            lock.lock();
+            if (--remaining == 0) done.notify_all();
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    std::vector<std::thread> threads;
+    std::function<void(size_t)> task;
+    std::exception_ptr failure;
+    size_t next = 0;
+    size_t total = 0;
+    size_t remaining = 0;
+    bool stopping = false;
+};
+
+// Fast non-cryptographic 64-bit hash for page contents. Four independent
+// multiply-xorshift lanes consume 32 bytes per step; any single changed word
+// changes its lane's state.
+static uint64_t wrapper_hash_bytes(const uint8_t* data, size_t size) {
+    const uint64_t multiplier = 0x9E3779B97F4A7C15ULL;
+    uint64_t lanes[4] = {size, multiplier, ~size, ~multiplier};
+    size_t offset = 0;
+    for (; offset + 32 <= size; offset += 32) {
+        for (size_t lane = 0; lane < 4; ++lane) {
+            uint64_t word;
+            std::memcpy(&word, data + offset + lane * 8, sizeof(word));
+            lanes[lane] = (lanes[lane] ^ word) * multiplier;
+            lanes[lane] ^= lanes[lane] >> 29;
+        }
+    }
+    uint64_t hash = lanes[0] ^ (lanes[1] * 31) ^ (lanes[2] * 131) ^ (lanes[3] * 8191);
+    for (; offset < size; ++offset) hash = (hash ^ data[offset]) * multiplier;
+    hash ^= hash >> 32;
+    return hash * multiplier;
+}
+
+// Per-page hashes of the readable memory selected by a tracker, sorted by
+// address. `contents` keeps a copy of every page when byte diffs are enabled.
+struct WrapperPageDigest {
+    std::vector<uint64_t> addresses;
+    std::vector<uint64_t> hashes;
+    std::vector<uint8_t> contents;
+};
+
+struct WrapperMemoryTracker {
+    lldb::SBProcess process;
+    lldb_ruby_memory_scan_filter_t filter;
+    uint64_t page_size = 4096;
+    bool byte_diff = false;
+    WrapperPageDigest baseline;
+    std::vector<lldb_ruby_memory_change_t> changes;
+};
+
+static const size_t kWrapperDigestChunkSize = 4 * 1024 * 1024;
+static const size_t kWrapperDigestPagesPerTask = 64;
+
+// Reads every selected page into one of two buffers and hashes it on the
+// worker pool while the next chunk is being read from LLDB.
+static void wrapper_capture_pages(WrapperMemoryTracker& tracker, WrapperPageDigest& digest) {
+    const uint64_t page_size = tracker.page_size;
+    std::vector<lldb_ruby_memory_region_t> regions;
+    wrapper_collect_memory_regions(tracker.process, regions, nullptr);
+
+    // Size the digest for every candidate page up front so workers never
+    // write into a vector that is being reallocated.
+    std::vector<std::pair<uint64_t, uint64_t>> spans;
+    size_t capacity = 0;
+    for (const lldb_ruby_memory_region_t& region : regions) {
+        if (!wrapper_region_matches_filter(region, tracker.filter)) continue;
+        uint64_t begin = wrapper_align_up(std::max(region.base, tracker.filter.start), page_size);
+        uint64_t end = std::min(region.end, tracker.filter.end) & ~(page_size - 1);
+        if (begin >= end) continue;
+        spans.emplace_back(begin, end);
+        capacity += static_cast<size_t>((end - begin) / page_size);
+    }
+    digest.addresses.resize(capacity);
+    digest.hashes.resize(capacity);
+    digest.contents.resize(tracker.byte_diff ? capacity * page_size : 0);
+
+    const size_t chunk = std::max<size_t>(page_size, kWrapperDigestChunkSize & ~(page_size - 1));
+    std::vector<uint8_t> buffers[2] = {std::vector<uint8_t>(chunk), std::vector<uint8_t>(chunk)};
+    size_t current = 0;
+    size_t count = 0;
+    WrapperWorkerPool pool;
+    for (const std::pair<uint64_t, uint64_t>& span : spans) {
+        uint64_t address = span.first;
+        while (address < span.second) {
+            size_t wanted = static_cast<size_t>(std::min<uint64_t>(chunk, span.second - address));
+            const uint8_t* data = buffers[current].data();
+            lldb::SBError error;
+            size_t got = wrapper_read_process_memory(tracker.process, address, buffers[current].data(), wanted, error);
+            size_t pages = got / page_size;
+            size_t first = count;
+            for (size_t page = 0; page < pages; ++page) digest.addresses[count++] = address + page * page_size;
+
+            if (pages > 0) {
+                bool keep = tracker.byte_diff;
+                pool.start((pages + kWrapperDigestPagesPerTask - 1) / kWrapperDigestPagesPerTask,
+                           [&digest, data, first, pages, page_size, keep](size_t task) {
+                    size_t begin = task * kWrapperDigestPagesPerTask;
+                    size_t end = std::min(pages, begin + kWrapperDigestPagesPerTask);
+                    for (size_t page = begin; page < end; ++page) {
+                        const uint8_t* bytes = data + page * page_size;
+                        digest.hashes[first + page] = wrapper_hash_bytes(bytes, page_size);
+                        if (keep) std::memcpy(&digest.contents[(first + page) * page_size], bytes, page_size);
+                    }
+                });
+                current ^= 1;
+            }
+
+            address += pages * page_size;
+            if (got < wanted) address += page_size;
+        }
+    }
+    pool.wait();
+
+    digest.addresses.resize(count);
+    digest.hashes.resize(count);
+    if (tracker.byte_diff) digest.contents.resize(count * page_size);
+}
+
+static void wrapper_append_change(std::vector<lldb_ruby_memory_change_t>& changes,
+                                  uint64_t address,
+                                  uint64_t size,
+                                  lldb_ruby_memory_change_kind_t kind) {
+    if (!changes.empty()) {
+        lldb_ruby_memory_change_t& last = changes.back();
+        if (last.kind == static_cast<uint64_t>(kind) && last.address + last.size == address) {
+            last.size += size;
+            return;
+        }
+    }
+    changes.push_back({address, size, static_cast<uint64_t>(kind)});
+}
+
+// Merges two sorted digests into change records. Pages whose hashes differ are
+// reported whole, or as runs of differing bytes when contents were kept.
+static void wrapper_diff_pages(const WrapperMemoryTracker& tracker,
+                               const WrapperPageDigest& before,
+                               const WrapperPageDigest& after,
+                               std::vector<lldb_ruby_memory_change_t>& changes) {
+    const uint64_t page_size = tracker.page_size;
+    changes.clear();
+    size_t old_index = 0;
+    size_t new_index = 0;
+    while (old_index < before.addresses.size() || new_index < after.addresses.size()) {
+        if (new_index == after.addresses.size() ||
+            (old_index < before.addresses.size() && before.addresses[old_index] < after.addresses[new_index])) {
+            wrapper_append_change(changes, before.addresses[old_index++], page_size, LLDB_RUBY_MEMORY_CHANGE_UNMAPPED);
+            continue;
+        }
+        if (old_index == before.addresses.size() || after.addresses[new_index] < before.addresses[old_index]) {
+            wrapper_append_change(changes, after.addresses[new_index++], page_size, LLDB_RUBY_MEMORY_CHANGE_MAPPED);
+            continue;
+        }
+
+        uint64_t address = after.addresses[new_index];
+        if (before.hashes[old_index] != after.hashes[new_index]) {
+            if (!tracker.byte_diff) {
+                wrapper_append_change(changes, address, page_size, LLDB_RUBY_MEMORY_CHANGE_MODIFIED);
+            } else {
+                const uint8_t* old_bytes = &before.contents[old_index * page_size];
+                const uint8_t* new_bytes = &after.contents[new_index * page_size];
+                for (size_t offset = 0; offset < page_size;) {
+                    if (old_bytes[offset] == new_bytes[offset]) {
+                        ++offset;
+                        continue;
+                    }
+                    size_t run = offset;
+                    while (run < page_size && old_bytes[run] != new_bytes[run]) ++run;
+                    wrapper_append_change(changes, address + offset, run - offset, LLDB_RUBY_MEMORY_CHANGE_MODIFIED);
+                    offset = run;
+                }
+            }
+        }
+        ++old_index;
+        ++new_index;
+    }
+}
+
+// Sorted interval index for conservative pointer scans. Ranges are ordered
+// by start; max_ends[i] is the largest end among the first i + 1 ranges, which
+// bounds the backwards search for overlapping ranges.
+struct WrapperIntervalIndex {
+    std::vector<uint64_t> begins;
+    std::vector<uint64_t> ends;
+    std::vector<uint64_t> max_ends;
+    std::vector<uint64_t> ids;
+    uint64_t low = UINT64_MAX;
+    uint64_t high = 0;
+
+    void assign(const lldb_ruby_address_range_t* ranges, size_t count) {
+        std::vector<size_t> order;
+        for (size_t index = 0; index < count; ++index) {
+            if (ranges[index].size > 0) order.push_back(index);
+        }
+        std::sort(order.begin(), order.end(), [ranges](size_t left, size_t right) {
+            return ranges[left].address < ranges[right].address;
+        });
+
+        uint64_t running_end = 0;
+        for (size_t index : order) {
+            uint64_t end = ranges[index].address + ranges[index].size;
+            begins.push_back(ranges[index].address);
+            ends.push_back(end);
+            running_end = std::max(running_end, end);
+            max_ends.push_back(running_end);
+            ids.push_back(index);
+            low = std::min(low, ranges[index].address);
+            high = std::max(high, end);
+        }
+    }
+
+    template <typename Emit>
+    void find(uint64_t value, Emit&& emit) const {
+        if (value < low || value >= high) return;
+        size_t index = static_cast<size_t>(std::upper_bound(begins.begin(), begins.end(), value) - begins.begin());
+        while (index-- > 0 && max_ends[index] > value) {
+            if (ends[index] > value) emit(ids[index]);
+        }
+    }
+};
+
+static inline uint64_t wrapper_load_pointer(const uint8_t* source, uint32_t pointer_size, bool swap) {
+    if (pointer_size == 8) {
+        uint64_t value;
+        std::memcpy(&value, source, sizeof(value));
+        return swap ? __builtin_bswap64(value) : value;
+    }
+    uint32_t value;
+    std::memcpy(&value, source, sizeof(value));
+    return swap ? __builtin_bswap32(value) : value;
+}
+
+static const size_t kWrapperReferenceChunkSize = 4 * 1024 * 1024;
+static const size_t kWrapperReferenceTaskSize = 64 * 1024;
+
+// Batched C-string reads fetch whole pages so that a read never runs past a
+// mapped page into an unmapped one. Tables of strings tend to be packed, so a
+// few recently used pages serve most of the batch.
+static const uint64_t kWrapperCStringPageSize = 4096;
+static const size_t kWrapperCStringCachedPages = 16;
+
+struct WrapperCStringPages {
+    struct Page {
+        uint64_t address = 0;
+        size_t size = 0;
+        uint64_t last_use = 0;
+        std::vector<uint8_t> bytes;
+    };
+
+    lldb::SBProcess& process;
+    std::vector<Page> pages;
+    uint64_t clock = 0;
+
+    explicit WrapperCStringPages(lldb::SBProcess& target_process) : process(target_process) {}
+
+    const Page& fetch(uint64_t page_address) {
+        ++clock;
+        for (Page& page : pages) {
+            if (page.address != page_address) continue;
+            page.last_use = clock;
+            return page;
+        }
+
+        Page* slot;
+        if (pages.size() < kWrapperCStringCachedPages) {
+            pages.emplace_back();
+            slot = &pages.back();
+            slot->bytes.resize(kWrapperCStringPageSize);
+        } else {
+            slot = &*std::min_element(pages.begin(), pages.end(), [](const Page& left, const Page& right) {
+                return left.last_use < right.last_use;
+            });
+        }
+        lldb::SBError error;
+        slot->address = page_address;
+        slot->last_use = clock;
+        slot->size = wrapper_read_process_memory(process, page_address, slot->bytes.data(),
+                                                 kWrapperCStringPageSize, error);
+        return *slot;
+    }
+};
+
+// Element equality pattern for value searches, in target byte order. The
+// lane arrays repeat the element across one AVX2 register; lane_starts has a
+// bit set at the first byte of every element in a 32-byte block.
+struct WrapperValuePattern {
+    size_t size = 0;
+    uint64_t value = 0;
+    uint64_t mask = 0;
+    uint8_t value_lanes[32];
+    uint8_t mask_lanes[32];
+    uint32_t lane_starts = 0;
+
+    void assign(const uint8_t* bytes, const uint8_t* bytes_mask, size_t element_size) {
+        size = element_size;
+        std::memcpy(&value, bytes, size);
+        std::memcpy(&mask, bytes_mask, size);
+        value &= mask;
+        for (size_t index = 0; index < sizeof(value_lanes); ++index) {
+            value_lanes[index] = bytes[index % size] & bytes_mask[index % size];
+            mask_lanes[index] = bytes_mask[index % size];
+            if (index % size == 0) lane_starts |= 1u << index;
+        }
+    }
+
+    bool matches(const uint8_t* data) const {
+        uint64_t word = 0;
+        std::memcpy(&word, data, size);
+        return (word & mask) == value;
+    }
+};
+
+// Appends the offset of every aligned element in data[begin, size) that equals
+// the pattern. `data` must be aligned to the element size.
+static void wrapper_find_values_scalar(const uint8_t* data,
+                                       size_t begin,
+                                       size_t size,
+                                       const WrapperValuePattern& pattern,
+                                       std::vector<uint32_t>& offsets) {
+    for (size_t offset = begin; offset + pattern.size <= size; offset += pattern.size) {
+        if (pattern.matches(data + offset)) offsets.push_back(static_cast<uint32_t>(offset));
+    }
+}
+
+// Reduces a per-byte equality mask to one bit per element that matched in
+// every byte.
+static inline uint32_t wrapper_value_lane_hits(uint32_t equal, const WrapperValuePattern& pattern) {
+    uint32_t hits = equal;
+    for (size_t shift = 1; shift < pattern.size; ++shift) hits &= equal >> shift;
+    return hits & pattern.lane_starts;
+}
+
+#if WRAPPER_HAVE_SSE2
+static void wrapper_find_values_sse2(const uint8_t* data,
+                                     size_t begin,
+                                     size_t size,
+                                     const WrapperValuePattern& pattern,
+                                     std::vector<uint32_t>& offsets) {
+    const __m128i needle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern.value_lanes));
+    const __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern.mask_lanes));
+    size_t offset = begin;
+    for (; size - offset >= 16; offset += 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+        uint32_t equal = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(block, bits), needle)));
+        for (uint32_t hits = wrapper_value_lane_hits(equal, pattern) & 0xFFFF; hits; hits &= hits - 1) {
+            offsets.push_back(static_cast<uint32_t>(offset + __builtin_ctz(hits)));
+        }
+    }
+    wrapper_find_values_scalar(data, offset, size, pattern, offsets);
+}
+#endif
+
+#if WRAPPER_HAVE_AVX2
+__attribute__((target("avx2"))) static void wrapper_find_values_avx2(const uint8_t* data,
+                                                                     size_t begin,
+                                                                     size_t size,
+                                                                     const WrapperValuePattern& pattern,
+                                                                     std::vector<uint32_t>& offsets) {
+    const __m256i needle = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pattern.value_lanes));
+    const __m256i bits = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pattern.mask_lanes));
+    size_t offset = begin;
+    for (; size - offset >= 32; offset += 32) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + offset));
+        uint32_t equal = static_cast<uint32_t>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(block, bits), needle)));
+        for (uint32_t hits = wrapper_value_lane_hits(equal, pattern); hits; hits &= hits - 1) {
+            offsets.push_back(static_cast<uint32_t>(offset + __builtin_ctz(hits)));
+        }
+    }
+    wrapper_find_values_scalar(data, offset, size, pattern, offsets);
+}
+#endif
+
+using WrapperValueFinder = void (*)(const uint8_t*, size_t, size_t, const WrapperValuePattern&,
+                                    std::vector<uint32_t>&);
+
+static WrapperValueFinder wrapper_value_finder() {
+    static const WrapperValueFinder finder = [] {
+#if WRAPPER_HAVE_AVX2
+        if (__builtin_cpu_supports("avx2")) return &wrapper_find_values_avx2;
+#endif
+#if WRAPPER_HAVE_SSE2
+        return &wrapper_find_values_sse2;
+#else
+        return &wrapper_find_values_scalar;
+#endif
+    }();
+    return finder;
+}
+
+// Compares two host-order elements: -1, 0, or 1, or 2 when a floating-point
+// operand is NaN.
+static int wrapper_compare_elements(uint32_t element_type, const uint8_t* left, const uint8_t* right) {
+    auto order = [](auto a, auto b) { return a < b ? -1 : (b < a ? 1 : (a == b ? 0 : 2)); };
+    auto load = [](auto sample, const uint8_t* bytes) {
+        decltype(sample) value;
+        std::memcpy(&value, bytes, sizeof(value));
+        return value;
+    };
+    switch (element_type) {
+    case LLDB_RUBY_ELEMENT_INT8: return order(load(int8_t(), left), load(int8_t(), right));
+    case LLDB_RUBY_ELEMENT_UINT8: return order(load(uint8_t(), left), load(uint8_t(), right));
+    case LLDB_RUBY_ELEMENT_INT16: return order(load(int16_t(), left), load(int16_t(), right));
+    case LLDB_RUBY_ELEMENT_UINT16: return order(load(uint16_t(), left), load(uint16_t(), right));
+    case LLDB_RUBY_ELEMENT_INT32: return order(load(int32_t(), left), load(int32_t(), right));
+    case LLDB_RUBY_ELEMENT_UINT32: return order(load(uint32_t(), left), load(uint32_t(), right));
+    case LLDB_RUBY_ELEMENT_INT64: return order(load(int64_t(), left), load(int64_t(), right));
+    case LLDB_RUBY_ELEMENT_UINT64: return order(load(uint64_t(), left), load(uint64_t(), right));
+    case LLDB_RUBY_ELEMENT_FLOAT: return order(load(float(), left), load(float(), right));
+    case LLDB_RUBY_ELEMENT_DOUBLE: return order(load(double(), left), load(double(), right));
+    default: return 2;
+    }
+}
+
+static bool wrapper_value_predicate_holds(uint32_t predicate, int versus_operand, int versus_previous) {
+    switch (predicate) {
+    case LLDB_RUBY_VALUE_SEARCH_EQUAL: return versus_operand == 0;
+    case LLDB_RUBY_VALUE_SEARCH_NOT_EQUAL: return versus_operand != 0;
+    case LLDB_RUBY_VALUE_SEARCH_GREATER: return versus_operand == 1;
+    case LLDB_RUBY_VALUE_SEARCH_LESS: return versus_operand == -1;
+    case LLDB_RUBY_VALUE_SEARCH_CHANGED: return versus_previous != 0;
+    case LLDB_RUBY_VALUE_SEARCH_UNCHANGED: return versus_previous == 0;
+    case LLDB_RUBY_VALUE_SEARCH_INCREASED: return versus_previous == 1;
+    case LLDB_RUBY_VALUE_SEARCH_DECREASED: return versus_previous == -1;
+    default: return false;
+    }
+}
+
+// Candidates of a value search, grouped by 4 KiB page: each page owns a run of
+// 16-bit in-page offsets. `values` holds the host-order value of every
+// candidate at the last narrow; it is empty right after the initial scan,
+// where every candidate held `initial`.
+static const uint64_t kWrapperValueSearchPageSize = 4096;
+static const size_t kWrapperValueSearchBatchPages = 256;
+
+struct WrapperValueSearchPage {
+    uint64_t address;
+    uint64_t first;
+    uint32_t count;
+};
+
+struct WrapperValueSearch {
+    lldb::SBProcess process;
+    uint32_t element_type = 0;
+    size_t element_size = 0;
+    bool swap = false;
+    uint8_t initial[8] = {0};
+    std::vector<WrapperValueSearchPage> pages;
+    std::vector<uint16_t> offsets;
+    std::vector<uint8_t> values;
+
+    void add(uint64_t address) {
+        uint64_t page_address = address & ~(kWrapperValueSearchPageSize - 1);
+        if (pages.empty() || pages.back().address != page_address) {
+            pages.push_back({page_address, offsets.size(), 0});
+        }
+        offsets.push_back(static_cast<uint16_t>(address - page_address));
+        ++pages.back().count;
+    }
+
+    const uint8_t* previous(size_t index) const {
+        return values.empty() ? initial : values.data() + index * element_size;
+    }
+};
+
+static void wrapper_value_search_scan(WrapperValueSearch& search,
+                                      const lldb_ruby_memory_scan_filter_t& filter,
+                                      const WrapperValuePattern& pattern) {
+    std::vector<lldb_ruby_memory_region_t> regions;
+    wrapper_collect_memory_regions(search.process, regions, nullptr);
+
+    WrapperValueFinder find = wrapper_value_finder();
+    std::vector<uint8_t> buffer(kWrapperScanChunkSize);
+    std::vector<uint32_t> hits;
+    for (const lldb_ruby_memory_region_t& region : regions) {
+        if (!wrapper_region_matches_filter(region, filter)) continue;
+        uint64_t begin = wrapper_align_up(std::max(region.base, filter.start), search.element_size);
+        uint64_t end = std::min(region.end, filter.end);
+        if (begin >= end) continue;
+
+        wrapper_stream_memory(search.process, begin, end, 0, buffer,
+                              [&](uint64_t base, const uint8_t* data, size_t size) {
+            hits.clear();
+            find(data, 0, size, pattern, hits);
+            for (uint32_t offset : hits) search.add(base + offset);
+            return true;
+        });
+    }
+}
+
+// Re-reads the span of each candidate page that holds candidates, a batch of
+// pages per coalesced read, and keeps the candidates that satisfy
+// `predicate`. Candidates that can no longer be read are dropped.
+static void wrapper_value_search_narrow(WrapperValueSearch& search, uint32_t predicate, const uint8_t* operand) {
+    const size_t element_size = search.element_size;
+    std::vector<WrapperValueSearchPage> pages;
+    std::vector<uint16_t> offsets;
+    std::vector<uint8_t> values;
+    std::vector<lldb_ruby_memory_range_t> ranges;
+    std::vector<uint64_t> bytes_read;
+    std::vector<uint8_t> buffer;
+    uint8_t current[8];
+    for (size_t batch = 0; batch < search.pages.size(); batch += kWrapperValueSearchBatchPages) {
+        size_t batch_end = std::min(search.pages.size(), batch + kWrapperValueSearchBatchPages);
+        ranges.clear();
+        uint64_t buffer_size = 0;
+        for (size_t index = batch; index < batch_end; ++index) {
+            const WrapperValueSearchPage& page = search.pages[index];
+            uint64_t low = search.offsets[page.first];
+            uint64_t high = search.offsets[page.first + page.count - 1] + element_size;
+            ranges.push_back({page.address + low, high - low, buffer_size});
+            buffer_size += high - low;
+        }
+        buffer.resize(buffer_size);
+        bytes_read.resize(ranges.size());
+        lldb::SBError first_error;
+        wrapper_read_memory_ranges(search.process, ranges.data(), ranges.size(), buffer.data(),
+                                   bytes_read.data(), first_error);
+
+        for (size_t index = batch; index < batch_end; ++index) {
+            const WrapperValueSearchPage& page = search.pages[index];
+            const lldb_ruby_memory_range_t& range = ranges[index - batch];
+            const uint64_t low = range.address - page.address;
+            bool opened = false;
+            for (uint64_t candidate = page.first; candidate < page.first + page.count; ++candidate) {
+                uint64_t position = search.offsets[candidate] - low;
+                if (position + element_size > bytes_read[index - batch]) break;
+
+                wrapper_decode_element(buffer.data() + range.offset + position, element_size, search.swap, current,
+                                       element_size);
+                int versus_operand = operand ? wrapper_compare_elements(search.element_type, current, operand) : 2;
+                int versus_previous = wrapper_compare_elements(search.element_type, current,
+                                                               search.previous(static_cast<size_t>(candidate)));
+                if (!wrapper_value_predicate_holds(predicate, versus_operand, versus_previous)) continue;
+
+                if (!opened) {
+                    pages.push_back({page.address, offsets.size(), 0});
+                    opened = true;
+                }
+                offsets.push_back(search.offsets[candidate]);
+                values.insert(values.end(), current, current + element_size);
+                ++pages.back().count;
+            }
+        }
+    }
+
+    search.pages = std::move(pages);
+    search.offsets = std::move(offsets);
+    search.values = std::move(values);
+}
+
+// Background read-ahead into the process page cache. A prefetch owns one
+// worker thread that reads runs of missing pages without holding the cache
+// lock and inserts them while the process is still at the stop the prefetch
+// started at. Resuming, dropping the cache, or cancelling stops the worker
+// at the next run. Completion is signalled through a condition variable and,
+// on POSIX hosts, by making a pipe readable.
+static const uint64_t kWrapperPrefetchRunPages = 64;
+static const uint32_t kWrapperPrefetchDefaultPageSize = 4096;
+static const uint32_t kWrapperPrefetchDefaultMaxPages = 1024;
+
+struct WrapperMemoryPrefetch {
+    lldb::SBProcess process;
+    std::shared_ptr<WrapperPageCache> cache;
+    uint32_t stop_id = 0;
+    uint64_t generation = 0;
+    std::vector<std::pair<uint64_t, uint64_t>> spans;
+    std::atomic<bool> cancel_requested{false};
+    std::atomic<uint64_t> pages_loaded{0};
+    std::mutex mutex;
+    std::condition_variable finished;
+    bool done = false;
+    int notify_fds[2] = {-1, -1};
+    std::thread worker;
+
+    ~WrapperMemoryPrefetch() {
+        cancel_requested = true;
+        if (worker.joinable()) worker.join();
+#if WRAPPER_HAVE_POSIX_FILES
+        for (int fd : notify_fds) {
+            if (fd >= 0) close(fd);
+        }
+#endif
+    }
+
+    bool cancelled() {
+        return cancel_requested || cache->prefetch_generation != generation || process.GetStopID(true) != stop_id;
+    }
+
+    void finish() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            done = true;
+        }
+        finished.notify_all();
+#if WRAPPER_HAVE_POSIX_FILES
+        if (notify_fds[1] >= 0) {
+            const char signal = 1;
+            ssize_t ignored = write(notify_fds[1], &signal, 1);
+            (void)ignored;
+        }
+#endif
+    }
+};
+
+// Turns byte ranges into sorted, merged runs of whole pages, keeping at most
+// `max_pages` pages so that a prefetch never evicts its own pages.
+static void wrapper_prefetch_spans(const lldb_ruby_address_range_t* ranges,
+                                   size_t count,
+                                   uint64_t page_size,
+                                   uint64_t max_pages,
+                                   std::vector<std::pair<uint64_t, uint64_t>>& spans) {
+    const uint64_t mask = ~(page_size - 1);
+    std::vector<std::pair<uint64_t, uint64_t>> bounds;
+    for (size_t index = 0; index < count; ++index) {
+        if (ranges[index].size == 0) continue;
+        uint64_t last = ranges[index].address + (ranges[index].size - 1);
+        bounds.emplace_back(ranges[index].address & mask, last & mask);
+    }
+    std::sort(bounds.begin(), bounds.end());
+
+    uint64_t budget = max_pages;
+    for (size_t index = 0; index < bounds.size() && budget > 0;) {
+        uint64_t first = bounds[index].first;
+        uint64_t last = bounds[index].second;
+        for (++index; index < bounds.size() && last != mask && bounds[index].first <= last + page_size; ++index) {
+            last = std::max(last, bounds[index].second);
+        }
+        uint64_t pages = std::min(budget, (last - first) / page_size + 1);
+        spans.emplace_back(first, pages);
+        budget -= pages;
+    }
+}
+
+static void wrapper_run_prefetch(WrapperMemoryPrefetch& prefetch) {
+    WrapperPageCache& cache = *prefetch.cache;
+    const uint64_t page_size = cache.page_size;
+    std::vector<uint8_t> run;
+    for (const std::pair<uint64_t, uint64_t>& span : prefetch.spans) {
+        uint64_t page = span.first;
+        uint64_t remaining = span.second;
+        while (remaining > 0 && !prefetch.cancelled()) {
+            uint64_t pages = 0;
+            uint64_t epoch = 0;
+            {
+                std::lock_guard<std::mutex> lock(cache.mutex);
+                epoch = cache.epoch;
+                while (remaining > 0 && cache.pages.count(page)) {
+                    page += page_size;
+                    --remaining;
+                }
+                while (pages < remaining && pages < kWrapperPrefetchRunPages &&
+                       !cache.pages.count(page + pages * page_size)) {
+                    ++pages;
+                }
+            }
+            if (pages == 0) break;
+
+            run.resize(static_cast<size_t>(pages * page_size));
+            lldb::SBError error;
+            uint64_t complete = prefetch.process.ReadMemory(page, run.data(), run.size(), error) / page_size;
+            if (prefetch.cancelled()) break;
+            {
+                std::lock_guard<std::mutex> lock(cache.mutex);
+                if (cache.stop_id != prefetch.stop_id) break;
+                // Memory was written while the run was being read: the bytes
+                // may predate the write, so read the run again.
+                if (cache.epoch != epoch) continue;
+                for (uint64_t index = 0; index < complete; ++index) {
+                    cache.insert(page + index * page_size, run.data() + index * page_size);
+                }
+            }
+            prefetch.pages_loaded += complete;
+
+            // Skip the page that could not be read along with the ones that were.
+            uint64_t advance = complete < pages ? complete + 1 : pages;
+            page += advance * page_size;
+            remaining -= advance;
+        }
+    }
+}
+
+// Deduplicating table of NUL-terminated strings addressed by byte offset.
+struct WrapperStringTable {
+    std::string bytes;
+    std::unordered_map<std::string, uint32_t> offsets;
+
+    uint32_t intern(const char* text) {
+        if (!text) return UINT32_MAX;
+        auto inserted = offsets.emplace(text, static_cast<uint32_t>(bytes.size()));
+        if (inserted.second) bytes.append(text, std::strlen(text) + 1);
+        return inserted.first->second;
+    }
+};
+
+static_assert(sizeof(lldb_ruby_value_tree_header_t) == 24, "unexpected value tree header size");
+static_assert(sizeof(lldb_ruby_value_node_t) == 48, "unexpected value node size");
+
+// Walks a value subtree in preorder with SBValue copies on the C++ stack, so
+// no per-child handle is allocated or crosses the C ABI.
+struct WrapperValueTreeWriter {
+    uint32_t max_depth;
+    uint32_t max_children;
+    uint32_t flags;
+    std::vector<lldb_ruby_value_node_t> nodes;
+    WrapperStringTable strings;
+
+    // Deeper trees are clamped to keep the recursion bounded.
+    static const uint32_t kMaxDepth = 1024;
+
+    void write(lldb::SBValue value, uint32_t depth) {
+        size_t index = nodes.size();
+        nodes.emplace_back();
+        lldb_ruby_value_node_t node{};
+        node.name = strings.intern(value.GetName());
+        node.type_name = flags & LLDB_RUBY_VALUE_SERIALIZE_TYPE_NAMES ? strings.intern(value.GetTypeName()) : UINT32_MAX;
+        node.value = flags & LLDB_RUBY_VALUE_SERIALIZE_VALUES ? strings.intern(value.GetValue()) : UINT32_MAX;
+        node.summary = flags & LLDB_RUBY_VALUE_SERIALIZE_SUMMARIES ? strings.intern(value.GetSummary()) : UINT32_MAX;
+        node.load_address = LLDB_INVALID_ADDRESS;
+        if (flags & LLDB_RUBY_VALUE_SERIALIZE_LOCATIONS) {
+            node.load_address = value.GetLoadAddress();
+            node.byte_size = value.GetByteSize();
+        }
+        node.error = UINT32_MAX;
+        lldb::SBError value_error = value.GetError();
+        if (value_error.Fail()) {
+            node.flags |= LLDB_RUBY_VALUE_NODE_ERROR;
+            node.error = strings.intern(value_error.GetCString());
+        }
+
+        node.num_children = value.GetNumChildren();
+        if (node.num_children > 0 && depth >= std::min(max_depth, kMaxDepth)) {
+            node.flags |= LLDB_RUBY_VALUE_NODE_UNEXPANDED;
+        } else {
+            node.child_count = std::min(node.num_children, max_children);
+            if (node.child_count < node.num_children) node.flags |= LLDB_RUBY_VALUE_NODE_TRUNCATED;
+        }
+        nodes[index] = node;
+
+        for (uint32_t child = 0; child < node.child_count; ++child) {
+            write(value.GetChildAtIndex(child), depth + 1);
+        }
+    }
+
+    // Writes a root for something that has no value, such as a path that
+    // did not resolve.
+    void write_error(const char* name, const char* message) {
+        lldb_ruby_value_node_t node{};
+        node.name = strings.intern(name);
+        node.type_name = UINT32_MAX;
+        node.value = UINT32_MAX;
+        node.summary = UINT32_MAX;
+        node.load_address = LLDB_INVALID_ADDRESS;
+        node.flags = LLDB_RUBY_VALUE_NODE_ERROR;
+        node.error = strings.intern(message);
+        nodes.push_back(node);
+    }
+
+    // Reports the encoded size and copies the tree only if it fits.
+    lldb_ruby_status_t copy(void* buffer, size_t buffer_size, uint64_t* required_size) const {
+        lldb_ruby_value_tree_header_t header;
+        header.node_count = static_cast<uint32_t>(nodes.size());
+        header.node_size = sizeof(lldb_ruby_value_node_t);
+        header.strings_offset = sizeof(header) + nodes.size() * sizeof(lldb_ruby_value_node_t);
+        header.strings_size = strings.bytes.size();
+        *required_size = header.strings_offset + header.strings_size;
+        if (buffer_size < *required_size) return LLDB_RUBY_STATUS_OK;
+
+        uint8_t* output = static_cast<uint8_t*>(buffer);
+        std::memcpy(output, &header, sizeof(header));
+        std::memcpy(output + sizeof(header), nodes.data(), nodes.size() * sizeof(lldb_ruby_value_node_t));
+        std::memcpy(output + header.strings_offset, strings.bytes.data(), strings.bytes.size());
+        return LLDB_RUBY_STATUS_OK;
+    }
+};
+
+static_assert(sizeof(lldb_ruby_backtrace_header_t) == 32, "unexpected backtrace header size");
+static_assert(sizeof(lldb_ruby_backtrace_frame_t) == 56, "unexpected backtrace frame size");
+
+// A backtrace capture of every thread. The last capture that did not fit
+// the caller's buffer stays pending on the calling thread so the retry does
+// not unwind and symbolicate every stack again.
+struct WrapperBacktraceCapture {
+    uint32_t process_unique_id = 0;
+    uint32_t stop_id = 0;
+    uint32_t max_depth = 0;
+    uint32_t flags = 0;
+    std::vector<uint64_t> thread_ids;
+    std::vector<lldb_ruby_backtrace_frame_t> frames;
+    WrapperStringTable strings;
+
+    void capture(lldb::SBProcess& process) {
+        uint32_t thread_count = process.GetNumThreads();
+        uint32_t depth = max_depth == 0 ? UINT32_MAX : max_depth;
+        std::string path;
+        thread_ids.reserve(thread_count);
+        for (uint32_t thread_index = 0; thread_index < thread_count; ++thread_index) {
+            lldb::SBThread thread = process.GetThreadAtIndex(thread_index);
+            uint64_t thread_id = thread.GetThreadID();
+            // Listed even when it unwinds to no frames, so it is not lost.
+            thread_ids.push_back(thread_id);
+            uint32_t index = 0;
+            for (; index < depth; ++index) {
+                lldb::SBFrame frame = thread.GetFrameAtIndex(index);
+                if (!frame.IsValid()) break;
+
+                lldb_ruby_backtrace_frame_t record{};
+                record.thread_id = thread_id;
+                record.pc = frame.GetPC();
+                record.sp = frame.GetSP();
+                record.fp = frame.GetFP();
+                record.frame_index = index;
+                record.function = UINT32_MAX;
+                record.file = UINT32_MAX;
+                if (frame.IsInlined()) record.flags |= LLDB_RUBY_BACKTRACE_FRAME_INLINED;
+                if (flags & LLDB_RUBY_BACKTRACE_FUNCTIONS) record.function = strings.intern(frame.GetFunctionName());
+                if (flags & LLDB_RUBY_BACKTRACE_LINE_ENTRIES) {
+                    lldb::SBLineEntry line_entry = frame.GetLineEntry();
+                    if (line_entry.IsValid()) {
+                        record.line = line_entry.GetLine();
+                        if (wrapper_copy_file_spec_path(line_entry.GetFileSpec(), path)) {
+                            record.file = strings.intern(path.c_str());
+                        }
+                    }
+                }
+                frames.push_back(record);
+            }
+            if (index > 0 && index == depth && thread.GetFrameAtIndex(index).IsValid()) {
+                frames.back().flags |= LLDB_RUBY_BACKTRACE_FRAME_TRUNCATED;
+            }
+        }
+    }
+
+    // Reports the encoded size and copies the capture only if it fits.
+    lldb_ruby_status_t copy(void* buffer, size_t buffer_size, uint64_t* required_size) const {
+        lldb_ruby_backtrace_header_t header{};
+        header.thread_count = static_cast<uint32_t>(thread_ids.size());
+        header.frame_count = static_cast<uint32_t>(frames.size());
+        header.frame_size = sizeof(lldb_ruby_backtrace_frame_t);
+        size_t frames_offset = sizeof(header) + thread_ids.size() * sizeof(uint64_t);
+        header.strings_offset = frames_offset + frames.size() * sizeof(lldb_ruby_backtrace_frame_t);
+        header.strings_size = strings.bytes.size();
+        *required_size = header.strings_offset + header.strings_size;
+        if (buffer_size < *required_size) return LLDB_RUBY_STATUS_OK;
+
+        uint8_t* output = static_cast<uint8_t*>(buffer);
+        std::memcpy(output, &header, sizeof(header));
+        if (!thread_ids.empty()) {
+            std::memcpy(output + sizeof(header), thread_ids.data(), thread_ids.size() * sizeof(uint64_t));
+        }
+        if (!frames.empty()) {
+            std::memcpy(output + frames_offset, frames.data(), frames.size() * sizeof(lldb_ruby_backtrace_frame_t));
+        }
+        std::memcpy(output + header.strings_offset, strings.bytes.data(), strings.bytes.size());
+        return LLDB_RUBY_STATUS_OK;
+    }
+};
+
+static thread_local std::unique_ptr<WrapperBacktraceCapture> g_pending_backtraces;
+
+static_assert(sizeof(lldb_ruby_symbol_scope_t) == 32, "unexpected symbol scope size");
+
+struct WrapperSymbolScope {
+    std::string function;
+    std::string file;
+    uint32_t line = 0;
+    uint32_t column = 0;
+};
+
+// What an address symbolicates to: its innermost scope first, then the
+// scopes it is inlined into.
+struct WrapperSymbolication {
+    std::string module;
+    std::vector<WrapperSymbolScope> scopes;
+};
+
+// Inline chains deeper than this are cut.
+static const uint32_t kWrapperMaxInlineDepth = 64;
+// The whole cache is dropped once it holds this many addresses.
+static const size_t kWrapperSymbolCacheMaxEntries = 1u << 20;
+
+static const uint32_t kWrapperSymbolCacheEvents = lldb::SBTarget::eBroadcastBitModulesLoaded |
+                                                  lldb::SBTarget::eBroadcastBitModulesUnloaded |
+                                                  lldb::SBTarget::eBroadcastBitSymbolsLoaded;
+
+// UUIDs identify module contents. Modules without one have no key and are
+// not cached: a rebuild can reuse their path, and module events fired before
+// the cache listened to a target are never seen.
+static bool wrapper_module_key(lldb::SBModule& module, std::string& key) {
+    if (!module.IsValid()) return false;
+    const char* uuid = module.GetUUIDString();
+    if (!uuid || !*uuid) return false;
+    key.assign(uuid);
+    return true;
+}
+
+static std::shared_ptr<const WrapperSymbolication> wrapper_symbolicate(lldb::SBTarget& target,
+                                                                      const lldb::SBAddress& address) {
+    std::shared_ptr<WrapperSymbolication> symbolication = std::make_shared<WrapperSymbolication>();
+    lldb::SBAddress scope_address = address;
+    const char* module_name = scope_address.GetModule().GetFileSpec().GetFilename();
+    if (module_name) symbolication->module = module_name;
+
+    lldb::SBSymbolContext scope = target.ResolveSymbolContextForAddress(
+        address, lldb::eSymbolContextModule | lldb::eSymbolContextCompUnit | lldb::eSymbolContextFunction |
+                     lldb::eSymbolContextBlock | lldb::eSymbolContextLineEntry | lldb::eSymbolContextSymbol);
+    for (uint32_t depth = 0; depth < kWrapperMaxInlineDepth; ++depth) {
+        WrapperSymbolScope record;
+        lldb::SBBlock inlined = scope.GetBlock().GetContainingInlinedBlock();
+        const char* name = inlined.IsValid() ? inlined.GetInlinedName() : scope.GetFunction().GetName();
+        if (!name) name = scope.GetSymbol().GetName();
+        if (name) record.function = name;
+        lldb::SBLineEntry line_entry = scope.GetLineEntry();
+        if (line_entry.IsValid()) {
+            record.line = line_entry.GetLine();
+            record.column = line_entry.GetColumn();
+            wrapper_copy_file_spec_path(line_entry.GetFileSpec(), record.file);
+        }
+        symbolication->scopes.push_back(std::move(record));
+        if (!inlined.IsValid()) break;
+
+        lldb::SBAddress parent_address;
+        lldb::SBSymbolContext parent = scope.GetParentOfInlinedScope(scope_address, parent_address);
+        if (!parent.IsValid()) break;
+        scope = parent;
+        scope_address = parent_address;
+    }
+    return symbolication;
+}
+
+// Process-wide symbolication cache. Its listener is added to the broadcaster
+// of every target it serves and drained before lookups, dropping the
+// entries of each module named by a module or symbol event.
+struct WrapperSymbolCache {
+    std::mutex mutex;
+    lldb::SBListener listener;
+    std::unordered_map<std::string, std::unordered_map<uint64_t, std::shared_ptr<const WrapperSymbolication>>>
+        modules;
+    size_t entry_count = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    // Bumped whenever entries are dropped; a lookup that missed does not
+    // insert its result if the epoch moved while it was resolving.
+    uint64_t epoch = 0;
+
+    WrapperSymbolCache() : listener("lldb-ruby.symbol-cache") {}
+
+    void clear() {
+        ++epoch;
+        modules.clear();
+        entry_count = 0;
+    }
+
+    void evict(const std::string& key) {
+        ++epoch;
+        auto found = modules.find(key);
+        if (found == modules.end()) return;
+        entry_count -= found->second.size();
+        modules.erase(found);
+    }
+
+    void sync(lldb::SBTarget& target) {
+        std::lock_guard<std::mutex> lock(mutex);
+        // Adding a listener that is already registered only updates its mask.
+        target.GetBroadcaster().AddListener(listener, kWrapperSymbolCacheEvents);
+        lldb::SBEvent event;
+        std::string key;
+        while (listener.GetNextEvent(event)) {
+            if (!lldb::SBTarget::EventIsTargetEvent(event)) continue;
+            uint32_t count = lldb::SBTarget::GetNumModulesFromEvent(event);
+            for (uint32_t index = 0; index < count; ++index) {
+                lldb::SBModule module = lldb::SBTarget::GetModuleAtIndexFromEvent(index, event);
+                if (wrapper_module_key(module, key)) evict(key);
+            }
+        }
+    }
+
+    // Returns nullptr for addresses outside every module.
+    std::shared_ptr<const WrapperSymbolication> lookup(lldb::SBTarget& target, uint64_t address) {
+        lldb::SBAddress resolved = target.ResolveLoadAddress(address);
+        lldb::SBModule module = resolved.GetModule();
+        if (!module.IsValid()) return nullptr;
+        std::string key;
+        if (!wrapper_module_key(module, key)) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                ++misses;
+            }
+            return wrapper_symbolicate(target, resolved);
+        }
+        uint64_t file_address = resolved.GetFileAddress();
+        uint64_t started_epoch = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            started_epoch = epoch;
+            auto found = modules.find(key);
+            if (found != modules.end()) {
+                auto entry = found->second.find(file_address);
+                if (entry != found->second.end()) {
+                    ++hits;
+                    return entry->second;
+                }
+            }
+            ++misses;
+        }
+
+        std::shared_ptr<const WrapperSymbolication> symbolication = wrapper_symbolicate(target, resolved);
+        std::lock_guard<std::mutex> lock(mutex);
+        // The module may have been evicted while this lookup resolved it.
+        if (epoch != started_epoch) return symbolication;
+        if (entry_count >= kWrapperSymbolCacheMaxEntries) clear();
+        if (modules[key].emplace(file_address, symbolication).second) ++entry_count;
+        return symbolication;
+    }
+};
+
+// Created on first use, after LLDB is initialized, and deliberately leaked
+// so its listener is not torn down after LLDB at exit.
+static WrapperSymbolCache& wrapper_symbol_cache() {
+    static WrapperSymbolCache* cache = new WrapperSymbolCache();
+    return *cache;
+}
+
+// One frame of the sampled call tree. Node 0 is the root; every other node
+// is a PC under its caller, and `samples` counts the samples whose innermost
+// frame it was.
+struct WrapperProfileNode {
+    uint64_t pc;
+    uint32_t parent;
+    uint64_t samples;
+};
+
+struct WrapperProfileEdgeHash {
+    size_t operator()(const std::pair<uint32_t, uint64_t>& edge) const {
+        return std::hash<uint64_t>()(edge.second ^ (static_cast<uint64_t>(edge.first) * 0x9e3779b97f4a7c15ULL));
+    }
+};
+
+struct WrapperProfileFunction {
+    std::string name;
+    std::string file;
+};
+
+struct WrapperProfileLocation {
+    uint64_t pc;
+    uint32_t function;
+    uint32_t line;
+};
+
+// Just enough protobuf encoding for the pprof Profile message.
+struct WrapperProtobufWriter {
+    std::string bytes;
+
+    void varint(uint64_t value) {
+        while (value >= 0x80) {
+            bytes.push_back(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        bytes.push_back(static_cast<char>(value));
+    }
+
+    // Zero is the default of every integer field and is left out.
+    void integer(uint32_t field, uint64_t value) {
+        if (value == 0) return;
+        varint(static_cast<uint64_t>(field) << 3);
+        varint(value);
+    }
+
+    void message(uint32_t field, const std::string& payload) {
+        varint((static_cast<uint64_t>(field) << 3) | 2);
+        varint(payload.size());
+        bytes += payload;
+    }
+
+    void packed(uint32_t field, const std::vector<uint64_t>& values) {
+        WrapperProtobufWriter payload;
+        for (uint64_t value : values) payload.varint(value);
+        message(field, payload.bytes);
+    }
+};
+
+static bool wrapper_process_has_ended(lldb::StateType state) {
+    return state == lldb::eStateExited || state == lldb::eStateDetached || state == lldb::eStateCrashed ||
+           state == lldb::eStateInvalid;
+}
+
+// How long a sample waits for the interrupted process to stop.
+static const std::chrono::milliseconds kWrapperProfilerStopTimeout(2000);
+
+// A sampling profiler. The sampling thread owns the trie until it exits;
+// the profile is symbolicated and encoded only after it has been joined.
+struct WrapperProfiler {
+    lldb::SBProcess process;
+    lldb::SBListener listener;
+    std::chrono::microseconds interval{0};
+    uint32_t max_depth = 0;
+    int32_t stop_signal = -1;
+    std::chrono::steady_clock::time_point started;
+    uint64_t started_unix_ns = 0;
+
+    std::vector<WrapperProfileNode> nodes;
+    std::unordered_map<std::pair<uint32_t, uint64_t>, uint32_t, WrapperProfileEdgeHash> children;
+
+    std::atomic<bool> running{true};
+    std::atomic<uint64_t> sample_count{0};
+    std::atomic<uint64_t> missed_count{0};
+    std::atomic<uint64_t> elapsed_ns{0};
+    std::atomic<uint64_t> paused_ns{0};
+    std::atomic<uint64_t> max_pause_ns{0};
+    std::atomic<uint64_t> node_count{1};
+
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    bool stop_requested = false;
+    std::mutex join_mutex;
+    std::thread worker;
+
+    bool symbolicated = false;
+    std::vector<WrapperProfileFunction> functions;
+    std::vector<WrapperProfileLocation> locations;
+    std::vector<uint32_t> node_locations;
+    std::string encoded[2];
+
+    WrapperProfiler() : listener("lldb-ruby.profiler"), nodes(1, WrapperProfileNode{0, UINT32_MAX, 0}) {}
+
+    ~WrapperProfiler() {
+        stop();
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop_requested = true;
+        }
+        wakeup.notify_all();
+        std::lock_guard<std::mutex> lock(join_mutex);
+        if (worker.joinable()) worker.join();
+    }
+
+    // Sleeps until `tick`; false once a stop was requested.
+    bool wait_for_tick(std::chrono::steady_clock::time_point tick) {
+        std::unique_lock<std::mutex> lock(mutex);
+        return !wakeup.wait_until(lock, tick, [this] { return stop_requested; });
+    }
+
+    void drain_events() {
+        lldb::SBEvent event;
+        while (listener.GetNextEvent(event)) {
+        }
+    }
+
+    // Waits for the state change an interrupt asked for. State events on the
+    // profiler's listener end the wait early; the process state decides.
+    lldb::StateType wait_for_stop(std::chrono::steady_clock::time_point deadline) {
+        std::chrono::microseconds backoff(20);
+        for (;;) {
+            lldb::StateType state = process.GetState();
+            if (state != lldb::eStateRunning || std::chrono::steady_clock::now() >= deadline) return state;
+
+            lldb::SBEvent event;
+            if (listener.GetNextEvent(event)) {
+                backoff = std::chrono::microseconds(20);
+                continue;
+            }
+            std::this_thread::sleep_for(backoff);
+            backoff = std::min(backoff * 2, std::chrono::microseconds(1000));
+        }
+    }
+
+    // Only stops caused by the interrupt are resumed; a breakpoint or a
+    // signal that arrives at the same time stays stopped for the user.
+    bool stopped_by_interrupt() {
+        uint32_t thread_count = process.GetNumThreads();
+        for (uint32_t index = 0; index < thread_count; ++index) {
+            lldb::SBThread thread = process.GetThreadAtIndex(index);
+            lldb::StopReason reason = thread.GetStopReason();
+            if (reason == lldb::eStopReasonNone || reason == lldb::eStopReasonInvalid) continue;
+            if (reason == lldb::eStopReasonSignal &&
+                static_cast<int32_t>(thread.GetStopReasonDataAtIndex(0)) == stop_signal) {
+                continue;
+            }
+            return false;
+        }
+        return true;
+    }
+
+    uint32_t child(uint32_t parent, uint64_t pc) {
+        auto inserted = children.emplace(std::make_pair(parent, pc), static_cast<uint32_t>(nodes.size()));
+        if (inserted.second) nodes.push_back(WrapperProfileNode{pc, parent, 0});
+        return inserted.first->second;
+    }
+
+    // Adds the stack of every thread. Inlined frames share the PC of the
+    // frame they are inlined into and fold into it.
+    void record() {
+        std::vector<uint64_t> stack;
+        size_t depth = max_depth == 0 ? SIZE_MAX : max_depth;
+        uint32_t thread_count = process.GetNumThreads();
+        for (uint32_t thread_index = 0; thread_index < thread_count; ++thread_index) {
+            lldb::SBThread thread = process.GetThreadAtIndex(thread_index);
+            stack.clear();
+            for (uint32_t index = 0; stack.size() < depth; ++index) {
+                lldb::SBFrame frame = thread.GetFrameAtIndex(index);
+                if (!frame.IsValid()) break;
+                if (frame.IsInlined()) continue;
+                uint64_t pc = frame.GetPC();
+                // Callers are at return addresses; the call is the byte before.
+                stack.push_back(stack.empty() || pc == 0 ? pc : pc - 1);
+            }
+            if (stack.empty()) continue;
+
+            uint32_t node = 0;
+            for (auto pc = stack.rbegin(); pc != stack.rend(); ++pc) node = child(node, *pc);
+            ++nodes[node].samples;
+        }
+        node_count = nodes.size();
+    }
+
+    void run() {
+        lldb::SBBroadcaster broadcaster = process.GetBroadcaster();
+        broadcaster.AddListener(listener, lldb::SBProcess::eBroadcastBitStateChanged);
+
+        // An interrupt whose stop has not been seen yet.
+        bool pending = false;
+        for (auto tick = started + interval; wait_for_tick(tick);
+             tick = std::max(tick + interval, std::chrono::steady_clock::now())) {
+            lldb::StateType state = process.GetState();
+            if (wrapper_process_has_ended(state)) break;
+            if (state != lldb::eStateRunning && !pending) {
+                ++missed_count;
+                continue;
+            }
+
+            auto pause_start = std::chrono::steady_clock::now();
+            if (!pending) {
+                drain_events();
+                process.SendAsyncInterrupt();
+            }
+            state = wait_for_stop(pause_start + kWrapperProfilerStopTimeout);
+            pending = state == lldb::eStateRunning;
+            if (wrapper_process_has_ended(state)) break;
+            if (state != lldb::eStateStopped || !stopped_by_interrupt()) {
+                ++missed_count;
+                continue;
+            }
+
+            record();
+            process.Continue();
+            ++sample_count;
+            uint64_t pause = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 std::chrono::steady_clock::now() - pause_start)
+                                 .count();
+            paused_ns += pause;
+            if (pause > max_pause_ns) max_pause_ns = pause;
+        }
+
+        if (pending &&
+            wait_for_stop(std::chrono::steady_clock::now() + kWrapperProfilerStopTimeout) == lldb::eStateStopped &&
+            stopped_by_interrupt()) {
+            process.Continue();
+        }
+        broadcaster.RemoveListener(listener, lldb::SBProcess::eBroadcastBitStateChanged);
+        elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started)
+                         .count();
+        running = false;
+    }
+
+    // Inlined scopes fold into the function they are inlined into, which is
+    // named with the line of the outermost call.
+    WrapperProfileLocation resolve(lldb::SBTarget& target,
+                                   uint64_t pc,
+                                   std::unordered_map<std::string, uint32_t>& function_ids) {
+        std::shared_ptr<const WrapperSymbolication> symbolication = wrapper_symbol_cache().lookup(target, pc);
+        WrapperProfileFunction function;
+        WrapperProfileLocation location{pc, 0, 0};
+        if (symbolication && !symbolication->scopes.back().function.empty()) {
+            const WrapperSymbolScope& scope = symbolication->scopes.back();
+            function.name = scope.function;
+            function.file = scope.file;
+            location.line = scope.line;
+        } else {
+            char hex[32];
+            std::snprintf(hex, sizeof(hex), "0x%llx", static_cast<unsigned long long>(pc));
+            function.name = symbolication && !symbolication->module.empty() ? symbolication->module + "`" + hex : hex;
+        }
+
+        std::string key = function.name + '\0' + function.file;
+        auto inserted = function_ids.emplace(key, static_cast<uint32_t>(functions.size()));
+        if (inserted.second) functions.push_back(std::move(function));
+        location.function = inserted.first->second;
+        return location;
+    }
+
+    // Resolves every distinct PC once, however many samples contain it.
+    void symbolicate() {
+        if (symbolicated) return;
+        lldb::SBTarget target = process.GetTarget();
+        wrapper_symbol_cache().sync(target);
+        std::unordered_map<uint64_t, uint32_t> location_ids;
+        std::unordered_map<std::string, uint32_t> function_ids;
+        node_locations.assign(nodes.size(), 0);
+        for (size_t node = 1; node < nodes.size(); ++node) {
+            auto found = location_ids.find(nodes[node].pc);
+            if (found == location_ids.end()) {
+                found = location_ids.emplace(nodes[node].pc, static_cast<uint32_t>(locations.size())).first;
+                locations.push_back(resolve(target, nodes[node].pc, function_ids));
+            }
+            node_locations[node] = found->second;
+        }
+        symbolicated = true;
+    }
+
+    const std::string& function_name(uint32_t node) const {
+        return functions[locations[node_locations[node]].function].name;
+    }
+
+    // Stacks that symbolicate to the same functions are merged, and lines
+    // are sorted so equal profiles encode identically.
+    std::string encode_folded() const {
+        std::unordered_map<std::string, uint64_t> counts;
+        std::vector<uint32_t> path;
+        std::string stack;
+        for (uint32_t node = 1; node < nodes.size(); ++node) {
+            if (nodes[node].samples == 0) continue;
+            path.clear();
+            for (uint32_t frame = node; frame != 0; frame = nodes[frame].parent) path.push_back(frame);
+            stack.clear();
+            for (auto frame = path.rbegin(); frame != path.rend(); ++frame) {
+                if (!stack.empty()) stack += ';';
+                stack += function_name(*frame);
+            }
+            counts[stack] += nodes[node].samples;
+        }
+
+        std::vector<std::pair<std::string, uint64_t>> lines(counts.begin(), counts.end());
+        std::sort(lines.begin(), lines.end());
+        std::string output;
+        for (const std::pair<std::string, uint64_t>& line : lines) {
+            output += line.first;
+            output += ' ';
+            output += std::to_string(line.second);
+            output += '\n';
+        }
+        return output;
+    }
+
+    // Samples carry a count and the wall time they stand for; location and
+    // function IDs are their indices plus one, since pprof reserves zero.
+    std::string encode_pprof() const {
+        std::vector<const std::string*> strings;
+        std::unordered_map<std::string, uint64_t> string_ids;
+        auto intern = [&](const std::string& value) {
+            auto inserted = string_ids.emplace(value, strings.size());
+            if (inserted.second) strings.push_back(&inserted.first->first);
+            return inserted.first->second;
+        };
+        auto value_type = [&](const char* type, const char* unit) {
+            WrapperProtobufWriter writer;
+            writer.integer(1, intern(type));
+            writer.integer(2, intern(unit));
+            return writer.bytes;
+        };
+        intern(std::string());
+
+        WrapperProtobufWriter profile;
+        const uint64_t period = std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count();
+        profile.message(1, value_type("samples", "count"));
+        profile.message(1, value_type("wall", "nanoseconds"));
+
+        std::vector<uint64_t> location_ids;
+        for (uint32_t node = 1; node < nodes.size(); ++node) {
+            if (nodes[node].samples == 0) continue;
+            location_ids.clear();
+            for (uint32_t frame = node; frame != 0; frame = nodes[frame].parent) {
+                location_ids.push_back(node_locations[frame] + 1);
+            }
+            WrapperProtobufWriter sample;
+            sample.packed(1, location_ids);
+            sample.packed(2, {nodes[node].samples, nodes[node].samples * period});
+            profile.message(2, sample.bytes);
+        }
+
+        for (size_t index = 0; index < locations.size(); ++index) {
+            WrapperProtobufWriter line;
+            line.integer(1, locations[index].function + 1);
+            line.integer(2, locations[index].line);
+            WrapperProtobufWriter location;
+            location.integer(1, index + 1);
+            location.integer(3, locations[index].pc);
+            location.message(4, line.bytes);
+            profile.message(4, location.bytes);
+        }
+
+        for (size_t index = 0; index < functions.size(); ++index) {
+            WrapperProtobufWriter function;
+            function.integer(1, index + 1);
+            function.integer(2, intern(functions[index].name));
+            function.integer(3, intern(functions[index].name));
+            function.integer(4, intern(functions[index].file));
+            profile.message(5, function.bytes);
+        }
+
+        profile.integer(9, started_unix_ns);
+        profile.integer(10, elapsed_ns);
+        profile.message(11, value_type("wall", "nanoseconds"));
+        profile.integer(12, period);
+        for (const std::string* value : strings) profile.message(6, *value);
+        return profile.bytes;
+    }
+};
+
+static_assert(sizeof(lldb_ruby_type_layout_field_t) == 24, "unexpected type layout field size");
+
+struct WrapperTypeLayoutField {
+    std::string name;
+    lldb_ruby_type_layout_field_t field;
+    size_t source_size;
+};
+
+// Scalar leaves of a type, flattened once and shared by every handle and
+// decode of that type.
+struct WrapperTypeLayout {
+    uint64_t byte_size = 0;
+    std::vector<WrapperTypeLayoutField> fields;
+};
+
+// Handles hold their own reference, so clearing the cache never frees a
+// layout that is still in use.
+struct WrapperTypeLayoutHandle {
+    std::shared_ptr<const WrapperTypeLayout> layout;
+};
+
+static std::mutex g_type_layouts_mutex;
+static std::unordered_map<std::string, std::shared_ptr<const WrapperTypeLayout>> g_type_layouts;
+
+// Large embedded arrays would otherwise flatten into unbounded field lists.
+static const size_t kWrapperMaxLayoutFields = 4096;
+static const uint32_t kWrapperMaxLayoutDepth = 64;
+
+static bool wrapper_element_is_signed(uint32_t element_type) {
+    return element_type == LLDB_RUBY_ELEMENT_INT8 || element_type == LLDB_RUBY_ELEMENT_INT16 ||
+           element_type == LLDB_RUBY_ELEMENT_INT32 || element_type == LLDB_RUBY_ELEMENT_INT64;
+}
+
+// Maps a canonical scalar type to an element type, or 0 when it has none.
+static uint32_t wrapper_scalar_element_type(lldb::SBType type) {
+    uint32_t flags = type.GetTypeFlags();
+    uint64_t size = type.GetByteSize();
+    if (flags & (lldb::eTypeIsPointer | lldb::eTypeIsReference)) {
+        return size == 4 || size == 8 ? LLDB_RUBY_ELEMENT_POINTER : 0;
+    }
+    if (flags & lldb::eTypeIsFloat) {
+        return size == 4 ? LLDB_RUBY_ELEMENT_FLOAT : size == 8 ? LLDB_RUBY_ELEMENT_DOUBLE : 0;
+    }
+    if (!(flags & (lldb::eTypeIsInteger | lldb::eTypeIsEnumeration))) return 0;
+
+    bool is_signed = (flags & lldb::eTypeIsSigned) != 0;
+    switch (size) {
+    case 1:
+        return is_signed ? LLDB_RUBY_ELEMENT_INT8 : LLDB_RUBY_ELEMENT_UINT8;
+    case 2:
+        return is_signed ? LLDB_RUBY_ELEMENT_INT16 : LLDB_RUBY_ELEMENT_UINT16;
+    case 4:
+        return is_signed ? LLDB_RUBY_ELEMENT_INT32 : LLDB_RUBY_ELEMENT_UINT32;
+    case 8:
+        return is_signed ? LLDB_RUBY_ELEMENT_INT64 : LLDB_RUBY_ELEMENT_UINT64;
+    default:
+        return 0;
+    }
+}
+
+// Appends the scalar leaves of `type`, placed at `offset`, to `layout`,
+// naming them by member path. Anonymous members add no path component, and
+// unnamed or zero-width bitfields, which only pad, are skipped.
+// Returns false with `reason` set when some leaf has no fixed-size layout.
+static bool wrapper_flatten_type(lldb::SBType declared,
+                                 const std::string& path,
+                                 uint64_t offset,
+                                 uint32_t depth,
+                                 WrapperTypeLayout& layout,
+                                 std::string& reason) {
+    lldb::SBType type = declared.GetCanonicalType();
+    uint32_t flags = type.GetTypeFlags();
+    if (depth > kWrapperMaxLayoutDepth || layout.fields.size() >= kWrapperMaxLayoutFields) {
+        reason = "type layout has too many fields";
+        return false;
+    }
+
+    if (flags & lldb::eTypeIsArray) {
+        lldb::SBType element = type.GetArrayElementType();
+        uint64_t element_size = element.GetByteSize();
+        if (element_size == 0) {
+            reason = "array " + path + " has no fixed element size";
+            return false;
+        }
+        uint64_t count = type.GetByteSize() / element_size;
+        for (uint64_t index = 0; index < count; ++index) {
+            if (!wrapper_flatten_type(element, path + "[" + std::to_string(index) + "]",
+                                      offset + index * element_size, depth + 1, layout, reason)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    if (flags & (lldb::eTypeIsStructUnion | lldb::eTypeIsClass)) {
+        if (type.GetNumberOfVirtualBaseClasses() > 0) {
+            reason = std::string(type.GetName() ? type.GetName() : "type") + " has virtual base classes";
+            return false;
+        }
+        for (uint32_t index = 0; index < type.GetNumberOfDirectBaseClasses(); ++index) {
+            lldb::SBTypeMember base = type.GetDirectBaseClassAtIndex(index);
+            if (!wrapper_flatten_type(base.GetType(), path, offset + base.GetOffsetInBytes(), depth + 1, layout, reason)) {
+                return false;
+            }
+        }
+        for (uint32_t index = 0; index < type.GetNumberOfFields(); ++index) {
+            lldb::SBTypeMember member = type.GetFieldAtIndex(index);
+            const char* member_name = member.GetName();
+            std::string name = !member_name || !*member_name ? path
+                               : path.empty() ? std::string(member_name)
+                                              : path + "." + member_name;
+            if (!member.IsBitfield()) {
+                if (!wrapper_flatten_type(member.GetType(), name, offset + member.GetOffsetInBytes(), depth + 1,
+                                          layout, reason)) {
+                    return false;
+                }
+                continue;
+            }
+            if (!member_name || !*member_name || member.GetBitfieldSizeInBits() == 0) continue;
+
+            WrapperTypeLayoutField leaf;
+            leaf.name = name;
+            leaf.field = {};
+            leaf.field.element_type = wrapper_scalar_element_type(member.GetType().GetCanonicalType());
+            uint64_t bit_position = offset * 8 + member.GetOffsetInBits();
+            leaf.field.byte_offset = bit_position / 8;
+            leaf.field.bit_offset = static_cast<uint32_t>(bit_position % 8);
+            leaf.field.bit_size = member.GetBitfieldSizeInBits();
+            leaf.source_size = (leaf.field.bit_offset + leaf.field.bit_size + 7) / 8;
+            if (leaf.field.element_type == 0 || leaf.field.element_type == LLDB_RUBY_ELEMENT_POINTER ||
+                leaf.field.element_type == LLDB_RUBY_ELEMENT_FLOAT ||
+                leaf.field.element_type == LLDB_RUBY_ELEMENT_DOUBLE || leaf.field.bit_size == 0 ||
+                leaf.source_size > 8) {
+                reason = "bitfield " + name + " has an unsupported storage type";
+                return false;
+            }
+            layout.fields.push_back(std::move(leaf));
+        }
+        return true;
+    }
+
+    WrapperTypeLayoutField leaf;
+    leaf.name = path;
+    leaf.field = {};
+    leaf.field.byte_offset = offset;
+    leaf.field.element_type = wrapper_scalar_element_type(type);
+    leaf.source_size = type.GetByteSize();
+    if (leaf.field.element_type == 0) {
+        reason = (path.empty() ? std::string("type") : path) + " of type " +
+                 (type.GetName() ? type.GetName() : "<unknown>") + " is not a fixed-size scalar";
+        return false;
+    }
+    layout.fields.push_back(std::move(leaf));
+    return true;
+}
+
+// A member hidden by a same-named member of a derived class flattens to a
+// repeated name; later repeats get a "#2", "#3", ... suffix so that every
+// field name is a distinct key.
+static void wrapper_unique_layout_names(WrapperTypeLayout& layout) {
+    std::unordered_map<std::string, uint32_t> seen;
+    for (WrapperTypeLayoutField& leaf : layout.fields) {
+        uint32_t& count = seen[leaf.name];
+        if (++count > 1) leaf.name += "#" + std::to_string(count);
+    }
+}
+
+// Builds the cache key for a layout: the defining module's UUID plus the
+// canonical name and size, so builds that declare a type differently never
+// share an entry. Returns false for types that must not be cached: unnamed
+// ones, and ones whose module has no UUID or cannot be determined.
+static bool wrapper_type_layout_key(lldb::SBType& type, lldb::SBType& canonical, std::string& key) {
+    const char* name = canonical.GetName();
+    if (!name || !*name || std::strstr(name, "(anonymous") || std::strstr(name, "(unnamed")) return false;
+#if LLDB_RUBY_HAVE_TYPE_GET_MODULE
+    lldb::SBModule module = type.GetModule();
+    const char* uuid = module.IsValid() ? module.GetUUIDString() : nullptr;
+    if (!uuid || !*uuid) return false;
+    key = std::string(uuid) + '\0' + name + '\0' + std::to_string(canonical.GetByteSize());
+    return true;
+#else
+    (void)type;
+    (void)key;
+    return false;
+#endif
+}
+
+static size_t wrapper_element_host_size(uint32_t element_type) {
+    return element_type == LLDB_RUBY_ELEMENT_POINTER ? sizeof(uint64_t) : wrapper_element_source_size(element_type, 0);
+}
+
+template <size_t Size>
+static void wrapper_gather_column(uint8_t* column, const uint8_t* source, uint64_t count, uint64_t stride) {
+    for (uint64_t index = 0; index < count; ++index) {
+        std::memcpy(column + index * Size, source + index * stride, Size);
+    }
+}
+
+static void wrapper_store_integer(uint8_t* destination, uint64_t value, size_t size) {
+    switch (size) {
+    case 1: {
+        uint8_t narrow = static_cast<uint8_t>(value);
+        std::memcpy(destination, &narrow, size);
+        break;
+    }
+    case 2: {
+        uint16_t narrow = static_cast<uint16_t>(value);
+        std::memcpy(destination, &narrow, size);
+        break;
+    }
+    case 4: {
+        uint32_t narrow = static_cast<uint32_t>(value);
+        std::memcpy(destination, &narrow, size);
+        break;
+    }
+    default:
+        std::memcpy(destination, &value, sizeof(value));
+        break;
+    }
+}
+
+// Decodes `count` elements starting at `data` into rows [first, first + count)
+// of the columns. Fields stored in host order are copied column by column
+// with fixed-size moves; only swapped, widened and bitfield leaves take the
+// per-element path.
+static void wrapper_decode_layout(const WrapperTypeLayout& layout,
+                                  const uint8_t* data,
+                                  uint64_t count,
+                                  uint64_t stride,
+                                  bool big_endian,
+                                  void* const* columns,
+                                  uint64_t first) {
+    bool swap = big_endian == wrapper_host_is_little_endian();
+    for (size_t index = 0; index < layout.fields.size(); ++index) {
+        const WrapperTypeLayoutField& leaf = layout.fields[index];
+        size_t host_size = wrapper_element_host_size(leaf.field.element_type);
+        uint8_t* column = static_cast<uint8_t*>(columns[index]) + first * host_size;
+        const uint8_t* source = data + leaf.field.byte_offset;
+
+        if (leaf.field.bit_size == 0 && host_size == leaf.source_size && (!swap || host_size == 1)) {
+            switch (host_size) {
+            case 1:
+                wrapper_gather_column<1>(column, source, count, stride);
+                break;
+            case 2:
+                wrapper_gather_column<2>(column, source, count, stride);
+                break;
+            case 4:
+                wrapper_gather_column<4>(column, source, count, stride);
+                break;
+            default:
+                wrapper_gather_column<8>(column, source, count, stride);
+                break;
+            }
+            continue;
+        }
+
+        if (leaf.field.bit_size == 0) {
+            for (uint64_t element = 0; element < count; ++element) {
+                wrapper_decode_element(source + element * stride, leaf.source_size, swap,
+                                       column + element * host_size, host_size);
+            }
+            continue;
+        }
+
+        uint32_t bit_size = leaf.field.bit_size;
+        uint64_t mask = bit_size >= 64 ? UINT64_MAX : (uint64_t{1} << bit_size) - 1;
+        bool sign_extend = wrapper_element_is_signed(leaf.field.element_type) && bit_size < 64;
+        for (uint64_t element = 0; element < count; ++element) {
+            const uint8_t* bytes = source + element * stride;
+            uint64_t word = 0;
+            uint64_t value;
+            if (big_endian) {
+                for (size_t byte = 0; byte < leaf.source_size; ++byte) word = (word << 8) | bytes[byte];
+                value = word >> (leaf.source_size * 8 - leaf.field.bit_offset - bit_size);
+            } else {
+                for (size_t byte = leaf.source_size; byte-- > 0;) word = (word << 8) | bytes[byte];
+                value = word >> leaf.field.bit_offset;
+            }
+            value &= mask;
+            if (sign_extend && (value >> (bit_size - 1)) & 1) value |= ~mask;
+            wrapper_store_integer(column + element * host_size, value, host_size);
+        }
+    }
+}
+
+// Iterates a value's children in batches. The encoded batch is kept until it
+// has been copied out, so a retry with a larger buffer returns the same
+// children and memory stays proportional to one batch.
+struct WrapperChildrenCursor {
+    lldb::SBValue value;
+    uint32_t flags = 0;
+    uint32_t num_children = 0;
+    uint32_t position = 0;
+    bool has_pending = false;
+    WrapperValueTreeWriter pending{0, 0, 0, {}, {}};
+};
+
+static_assert(sizeof(lldb_ruby_container_info_t) == 48, "unexpected container info size");
+
+// Where a recognized container keeps its elements. Hashed containers are
+// walked node by node: each node starts with the next pointer and holds its
+// element value_offset bytes in, with a map's mapped value mapped_offset
+// bytes into the element.
+struct WrapperContainer {
+    lldb_ruby_container_info_t info{};
+    uint64_t element_source_size = 0;
+    uint64_t mapped_source_size = 0;
+    uint64_t mapped_offset = 0;
+    uint64_t value_offset = 0;
+    uint32_t pointer_size = 0;
+};
+
+// Returns the template name of a std:: type with inline namespaces such as
+// __1 and __cxx11 removed, or an empty string for other types.
+static std::string wrapper_std_template_name(const char* name) {
+    if (!name || std::strncmp(name, "std::", 5) != 0) return std::string();
+    std::string qualified(name + 5);
+    qualified = qualified.substr(0, qualified.find('<'));
+    size_t start = 0;
+    while (qualified.compare(start, 2, "__") == 0) {
+        size_t separator = qualified.find("::", start);
+        if (separator == std::string::npos) break;
+        start = separator + 2;
+    }
+    if (qualified.find("::", start) != std::string::npos) return std::string();
+    return qualified.substr(start);
+}
+
+// Follows a dotted member path; the result is invalid when a member is missing.
+static lldb::SBValue wrapper_member_path(lldb::SBValue value, const char* path) {
+    const char* dot = std::strchr(path, '.');
+    if (!dot) return value.GetChildMemberWithName(path);
+    lldb::SBValue member = value.GetChildMemberWithName(std::string(path, dot).c_str());
+    if (!member.IsValid()) return member;
+    return wrapper_member_path(member, dot + 1);
+}
+
+// Returns the first of `paths` that resolves, covering layouts that changed
+// member names between library versions.
+static lldb::SBValue wrapper_first_member(lldb::SBValue value, std::initializer_list<const char*> paths) {
+    for (const char* path : paths) {
+        lldb::SBValue member = wrapper_member_path(value, path);
+        if (member.IsValid() && member.GetError().Success()) return member;
+    }
+    return lldb::SBValue();
+}
+
+// SBType has no alignment query, so it is inferred from the widest scalar
+// leaf, which is how the common ABIs align the types containers hold.
+static uint64_t wrapper_type_alignment(lldb::SBType declared, uint32_t depth) {
+    lldb::SBType type = declared.GetCanonicalType();
+    uint32_t flags = type.GetTypeFlags();
+    if (depth > kWrapperMaxLayoutDepth) return 8;
+    if (flags & lldb::eTypeIsArray) return wrapper_type_alignment(type.GetArrayElementType(), depth + 1);
+    if (flags & (lldb::eTypeIsStructUnion | lldb::eTypeIsClass)) {
+        uint64_t alignment = 1;
+        for (uint32_t index = 0; index < type.GetNumberOfDirectBaseClasses(); ++index) {
+            alignment = std::max(alignment, wrapper_type_alignment(type.GetDirectBaseClassAtIndex(index).GetType(),
+                                                                   depth + 1));
+        }
+        for (uint32_t index = 0; index < type.GetNumberOfFields(); ++index) {
+            alignment = std::max(alignment, wrapper_type_alignment(type.GetFieldAtIndex(index).GetType(), depth + 1));
+        }
+        return alignment;
+    }
+
+    uint64_t size = type.GetByteSize();
+    uint64_t alignment = 1;
+    while (alignment < size && alignment < 16) alignment *= 2;
+    return alignment;
+}
+
+// Describes how elements of `declared` are emitted; false for types without
+// a fixed size.
+static bool wrapper_container_component(lldb::SBType declared,
+                                        uint32_t& element_type,
+                                        uint64_t& source_size,
+                                        uint64_t& emitted_size) {
+    lldb::SBType type = declared.GetCanonicalType();
+    source_size = type.IsValid() ? type.GetByteSize() : 0;
+    if (source_size == 0) return false;
+    element_type = wrapper_scalar_element_type(type);
+    emitted_size = element_type ? wrapper_element_host_size(element_type) : source_size;
+    return true;
+}
+
+static void wrapper_emit_component(const uint8_t* source,
+                                   uint64_t source_size,
+                                   uint32_t element_type,
+                                   bool swap,
+                                   uint8_t* destination) {
+    if (element_type == 0) {
+        std::memcpy(destination, source, source_size);
+        return;
+    }
+    wrapper_decode_element(source, source_size, swap, destination, wrapper_element_host_size(element_type));
+}
+
+// Matches `value` against the libstdc++ and libc++ layouts of the supported
+// containers, reading their members without synthetic children.
+static bool wrapper_recognize_container(lldb::SBValue value, WrapperContainer& container) {
+    lldb::SBValue raw = value.GetNonSyntheticValue();
+    lldb::SBType type = raw.GetType().GetCanonicalType();
+    std::string name = wrapper_std_template_name(type.GetName());
+    if (name.empty() || type.GetNumberOfTemplateArguments() == 0) return false;
+
+    lldb_ruby_container_info_t& info = container.info;
+    lldb::SBType element = type.GetTemplateArgumentType(0);
+    container.pointer_size = raw.GetProcess().GetAddressByteSize();
+    if ((container.pointer_size != 4 && container.pointer_size != 8) ||
+        !wrapper_container_component(element, info.element_type, container.element_source_size, info.element_size)) {
+        return false;
+    }
+
+    if (name == "vector") {
+        // std::vector<bool> packs its elements into bits.
+        if (element.GetCanonicalType().GetBasicType() == lldb::eBasicTypeBool) return false;
+        lldb::SBValue begin = wrapper_first_member(raw, {"_M_impl._M_start", "__begin_"});
+        lldb::SBValue end = wrapper_first_member(raw, {"_M_impl._M_finish", "__end_"});
+        if (!begin.IsValid() || !end.IsValid()) return false;
+        uint64_t first = begin.GetValueAsUnsigned();
+        uint64_t last = end.GetValueAsUnsigned();
+        if (last < first) return false;
+        info.kind = LLDB_RUBY_CONTAINER_VECTOR;
+        info.data_address = first;
+        info.count = (last - first) / container.element_source_size;
+        return true;
+    }
+
+    if (name == "basic_string") {
+        lldb::SBValue data = wrapper_first_member(raw, {"_M_dataplus._M_p"});
+        lldb::SBValue length = wrapper_first_member(raw, {"_M_string_length"});
+        if (data.IsValid() && length.IsValid()) {
+            info.data_address = data.GetValueAsUnsigned();
+            info.count = length.GetValueAsUnsigned();
+        } else {
+            // libc++ tags long strings with __is_long_ since LLVM 15; older
+            // layouts are left to the synthetic children.
+            lldb::SBValue rep = wrapper_first_member(raw, {"__r_.__value_", "__r_.__first_", "__rep_"});
+            lldb::SBValue is_long = wrapper_member_path(rep, "__s.__is_long_");
+            if (!is_long.IsValid()) return false;
+            if (is_long.GetValueAsUnsigned() != 0) {
+                info.data_address = wrapper_member_path(rep, "__l.__data_").GetValueAsUnsigned();
+                info.count = wrapper_member_path(rep, "__l.__size_").GetValueAsUnsigned();
+            } else {
+                info.data_address = wrapper_member_path(rep, "__s.__data_").GetLoadAddress();
+                info.count = wrapper_member_path(rep, "__s.__size_").GetValueAsUnsigned();
+            }
+        }
+        if (info.data_address == LLDB_INVALID_ADDRESS ||
+            info.count > (UINT64_MAX - info.data_address) / container.element_source_size) {
+            return false;
+        }
+        info.kind = LLDB_RUBY_CONTAINER_STRING;
+        return true;
+    }
+
+    bool is_map = name == "unordered_map" || name == "unordered_multimap";
+    if (!is_map && name != "unordered_set" && name != "unordered_multiset") return false;
+
+    uint64_t alignment = wrapper_type_alignment(element, 0);
+    if (is_map) {
+        lldb::SBType mapped = type.GetTemplateArgumentType(1);
+        if (type.GetNumberOfTemplateArguments() < 2 ||
+            !wrapper_container_component(mapped, info.mapped_type, container.mapped_source_size, info.mapped_size)) {
+            return false;
+        }
+        uint64_t mapped_alignment = wrapper_type_alignment(mapped, 0);
+        container.mapped_offset = wrapper_align_up(container.element_source_size, mapped_alignment);
+        alignment = std::max(alignment, mapped_alignment);
+    }
+
+    // libstdc++ nodes hold the next pointer before the value; libc++ nodes
+    // also hold the cached hash.
+    bool libstdcxx = wrapper_member_path(raw, "_M_h").IsValid();
+    lldb::SBValue first = libstdcxx ? wrapper_first_member(raw, {"_M_h._M_before_begin._M_nxt"})
+                                    : wrapper_first_member(raw, {"__table_.__p1_.__value_.__next_",
+                                                                 "__table_.__p1_.__first_.__next_",
+                                                                 "__table_.__first_node_.__next_"});
+    lldb::SBValue size = libstdcxx ? wrapper_first_member(raw, {"_M_h._M_element_count"})
+                                   : wrapper_first_member(raw, {"__table_.__p2_.__value_", "__table_.__p2_.__first_",
+                                                                "__table_.__size_"});
+    if (!first.IsValid() || !size.IsValid()) return false;
+    container.value_offset = wrapper_align_up(libstdcxx ? container.pointer_size : 2 * container.pointer_size,
+                                              alignment);
+    info.kind = is_map ? LLDB_RUBY_CONTAINER_UNORDERED_MAP : LLDB_RUBY_CONTAINER_UNORDERED_SET;
+    info.data_address = first.GetValueAsUnsigned();
+    info.count = size.GetValueAsUnsigned();
+    return true;
+}
+
+// Emits `count` elements of `container` from `start` on and returns the
+// bytes written, which stop at the first element that cannot be read.
+static uint64_t wrapper_read_container(const WrapperContainer& container,
+                                       lldb::SBProcess& process,
+                                       uint64_t start,
+                                       uint64_t count,
+                                       uint8_t* output,
+                                       lldb::SBError& error) {
+    const lldb_ruby_container_info_t& info = container.info;
+    const uint64_t source_size = container.element_source_size;
+    bool swap = (process.GetByteOrder() == lldb::eByteOrderBig) == wrapper_host_is_little_endian();
+
+    if (info.kind == LLDB_RUBY_CONTAINER_VECTOR || info.kind == LLDB_RUBY_CONTAINER_STRING) {
+        uint64_t address = info.data_address + start * source_size;
+        // Contiguous storage is read straight into the caller's buffer.
+        if (info.element_size == source_size) {
+            size_t got = wrapper_read_process_memory(process, address, output, static_cast<size_t>(count * source_size),
+                                                     error);
+            uint64_t complete = got / source_size;
+            if (info.element_type != 0 && swap && source_size > 1) {
+                wrapper_swap_elements(output, static_cast<size_t>(source_size), static_cast<size_t>(complete));
+            }
+            return complete * source_size;
+        }
+
+        // 32-bit pointers are widened from windows of at most
+        // kWrapperMaxCoalescedRead bytes.
+        uint64_t per_window = std::max<uint64_t>(1, kWrapperMaxCoalescedRead / source_size);
+        std::vector<uint8_t> window;
+        for (uint64_t first = 0; first < count;) {
+            uint64_t elements = std::min(per_window, count - first);
+            window.resize(static_cast<size_t>(elements * source_size));
+            size_t got = wrapper_read_process_memory(process, address + first * source_size, window.data(),
+                                                     window.size(), error);
+            uint64_t complete = got / source_size;
+            for (uint64_t index = 0; index < complete; ++index) {
+                wrapper_emit_component(window.data() + index * source_size, source_size, info.element_type, swap,
+                                       output + (first + index) * info.element_size);
+            }
+            first += complete;
+            if (complete < elements) return first * info.element_size;
+        }
+        return count * info.element_size;
+    }
+
+    // Hashed containers are a singly linked list of nodes. Skipped nodes only
+    // need their next pointer; emitted ones are read whole.
+    uint64_t value_size = info.kind == LLDB_RUBY_CONTAINER_UNORDERED_MAP
+                              ? container.mapped_offset + container.mapped_source_size
+                              : source_size;
+    std::vector<uint8_t> node(static_cast<size_t>(container.value_offset + value_size));
+    uint64_t stride = info.element_size + info.mapped_size;
+    uint64_t address = info.data_address;
+    uint64_t written = 0;
+    for (uint64_t index = 0; address != 0 && index < start + count; ++index) {
+        size_t span = index < start ? container.pointer_size : node.size();
+        if (wrapper_read_process_memory(process, address, node.data(), span, error) < span) break;
+        if (index >= start) {
+            const uint8_t* element = node.data() + container.value_offset;
+            wrapper_emit_component(element, source_size, info.element_type, swap, output + written);
+            if (info.kind == LLDB_RUBY_CONTAINER_UNORDERED_MAP) {
+                wrapper_emit_component(element + container.mapped_offset, container.mapped_source_size,
+                                       info.mapped_type, swap, output + written + info.element_size);
+            }
+            written += stride;
+        }
+        address = wrapper_load_pointer(node.data(), container.pointer_size, swap);
+    }
+    return written;
+}
+
+static_assert(sizeof(lldb_ruby_value_change_t) == 40, "unexpected value change record size");
+
+struct WrapperWatchState {
+    bool known = false;
+    std::vector<uint8_t> bytes;
+};
+
+// Paths and the bytes seen for each at the last update. An update whose
+// result did not fit the caller's buffers is kept, with the state it would
+// commit, until a retry at the same stop and frame copies it out.
+struct WrapperValueWatchSet {
+    std::vector<std::string> paths;
+    std::vector<WrapperWatchState> states;
+
+    bool has_pending = false;
+    uint32_t pending_stop_id = 0;
+    uint64_t pending_cfa = 0;
+    uint32_t pending_frame_id = 0;
+    std::vector<lldb_ruby_value_change_t> pending_changes;
+    std::vector<uint8_t> pending_bytes;
+    std::vector<WrapperWatchState> pending_states;
+};
+
+// Reads the raw bytes behind `path` in `frame`; false when it does not resolve.
+static bool wrapper_read_watched_value(lldb::SBFrame& frame, const std::string& path, std::vector<uint8_t>& bytes) {
+    lldb::SBValue value = frame.GetValueForVariablePath(path.c_str());
+    if (!value.IsValid() || value.GetError().Fail()) return false;
+
+    lldb::SBData data = value.GetData();
+    if (!data.IsValid()) return false;
+    bytes.resize(data.GetByteSize());
+    if (bytes.empty()) return true;
+    lldb::SBError error;
+    return data.ReadRawData(error, 0, bytes.data(), bytes.size()) == bytes.size() && error.Success();
+}
+
+static void wrapper_record_watch_change(WrapperValueWatchSet& set,
+                                        uint32_t index,
+                                        const WrapperWatchState& previous,
+                                        const WrapperWatchState& current) {
+    lldb_ruby_value_change_t change{};
+    change.index = index;
+    if (!previous.known) change.flags |= LLDB_RUBY_VALUE_CHANGE_NEW;
+    if (!current.known) change.flags |= LLDB_RUBY_VALUE_CHANGE_UNAVAILABLE;
+    change.old_offset = set.pending_bytes.size();
+    change.old_size = previous.known ? previous.bytes.size() : 0;
+    if (previous.known) set.pending_bytes.insert(set.pending_bytes.end(), previous.bytes.begin(), previous.bytes.end());
+    change.new_offset = set.pending_bytes.size();
+    change.new_size = current.known ? current.bytes.size() : 0;
+    if (current.known) set.pending_bytes.insert(set.pending_bytes.end(), current.bytes.begin(), current.bytes.end());
+    set.pending_changes.push_back(change);
+}
+
+// Owns the SBValue and SBFrame handles allocated while it is active. std::deque
+// constructs elements in place inside fixed-size blocks and never relocates
+// them, so handles are carved out of a few slabs and destroyed together.
+struct WrapperHandleScope {
+    std::deque<lldb::SBValue> values;
+    std::deque<lldb::SBFrame> frames;
+};
+
+static thread_local WrapperHandleScope* g_active_scope = nullptr;
+
+static lldb_value_t wrapper_new_value(const lldb::SBValue& value) {
+    if (!g_active_scope) return static_cast<lldb_value_t>(new lldb::SBValue(value));
+    g_active_scope->values.push_back(value);
+    return static_cast<lldb_value_t>(&g_active_scope->values.back());
+}
+
+static lldb_frame_t wrapper_new_frame(const lldb::SBFrame& frame) {
+    if (!g_active_scope) return static_cast<lldb_frame_t>(new lldb::SBFrame(frame));
+    g_active_scope->frames.push_back(frame);
+    return static_cast<lldb_frame_t>(&g_active_scope->frames.back());
+}
+
+static_assert(LLDB_INVALID_ADDRESS == UINT64_MAX, "unexpected LLDB invalid address sentinel");
+static_assert(LLDB_INVALID_PROCESS_ID == 0, "unexpected LLDB invalid process sentinel");
+static_assert(LLDB_INVALID_THREAD_ID == 0, "unexpected LLDB invalid thread sentinel");
+static_assert(LLDB_INVALID_BREAK_ID == 0, "unexpected LLDB invalid breakpoint sentinel");
+static_assert(LLDB_INVALID_LINE_NUMBER == UINT32_MAX, "unexpected LLDB invalid line sentinel");
+
+extern "C" {
+
+// ============================================================================
+// Wrapper metadata and capabilities
+// ============================================================================
+
+uint32_t lldb_wrapper_abi_version(void)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    return LLDB_RUBY_WRAPPER_ABI_VERSION;
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+const char* lldb_wrapper_build_lldb_version(void)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    return LLDB_RUBY_BUILD_LLDB_VERSION;
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+const char* lldb_wrapper_runtime_lldb_version(void)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    return lldb::SBDebugger::GetVersionString();
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+int lldb_wrapper_has_capability(uint32_t capability)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    switch (capability) {
+        case LLDB_RUBY_CAPABILITY_WATCHPOINT_ACCESS_KIND:
+            return LLDB_RUBY_HAVE_WATCHPOINT_ACCESS_KIND;
+        default:
+            return 0;
+    }
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+const char* lldb_wrapper_last_error_message(void)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    return g_last_error_message;
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+int lldb_wrapper_last_error_code(void)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    return g_last_error_code;
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+void lldb_wrapper_clear_last_error(void)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    wrapper_clear_error_state();
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+    }
+}
+
+// ============================================================================
+// Initialization
+// ============================================================================
+
+lldb_ruby_status_t lldb_initialize(lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    wrapper_clear_error_state();
+    try {
+        lldb::SBError init_error = lldb::SBDebugger::InitializeWithErrorHandling();
+        return wrapper_status(init_error, error);
+    } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed during initialization");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception during initialization");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    }
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    }
+}
+
+void lldb_terminate(void)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    lldb::SBDebugger::Terminate();
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+    }
+}
+
+// ============================================================================
+// Handle scopes
+// ============================================================================
+
+lldb_scope_t lldb_scope_create(void)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    return static_cast<lldb_scope_t>(new WrapperHandleScope());
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+void lldb_scope_release(lldb_scope_t scope)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!scope) return;
+    if (g_active_scope == scope) g_active_scope = nullptr;
+    delete static_cast<WrapperHandleScope*>(scope);
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+    }
+}
+
+lldb_scope_t lldb_scope_activate(lldb_scope_t scope)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    WrapperHandleScope* previous = g_active_scope;
+    g_active_scope = static_cast<WrapperHandleScope*>(scope);
+    return static_cast<lldb_scope_t>(previous);
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+uint64_t lldb_scope_get_num_handles(lldb_scope_t scope)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!scope) return 0;
+    WrapperHandleScope* s = static_cast<WrapperHandleScope*>(scope);
+    return s->values.size() + s->frames.size();
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+// ============================================================================
+// SBDebugger
+// ============================================================================
+
+lldb_debugger_t lldb_debugger_create(void)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    return lldb_debugger_create_with_source_init_files(0);
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+lldb_debugger_t lldb_debugger_create_with_source_init_files(int source_init_files)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    lldb::SBDebugger* dbg = new lldb::SBDebugger(
+        lldb::SBDebugger::Create(source_init_files != 0));
+    return static_cast<lldb_debugger_t>(dbg);
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+void lldb_debugger_destroy(lldb_debugger_t dbg)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (dbg) {
+        lldb::SBDebugger* debugger = static_cast<lldb::SBDebugger*>(dbg);
+        if (debugger->IsValid()) {
+            lldb::SBDebugger::Destroy(*debugger);
+        }
+        delete debugger;
+    }
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+    }
+}
+
+int lldb_debugger_is_valid(lldb_debugger_t dbg)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!dbg) return 0;
+    return static_cast<lldb::SBDebugger*>(dbg)->IsValid() ? 1 : 0;
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+lldb_target_t lldb_debugger_create_target(lldb_debugger_t dbg,
+                                           const char* filename,
+                                           const char* arch,
+                                           const char* platform,
+                                           int add_dependent_modules,
+                                           lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!dbg) return nullptr;
+
+    lldb::SBDebugger* debugger = static_cast<lldb::SBDebugger*>(dbg);
+    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
+    lldb::SBError local_error;
+
+    lldb::SBTarget target = debugger->CreateTarget(
+        filename,
+        arch ? arch : "",
+        platform ? platform : "",
+        add_dependent_modules != 0,
+        err ? *err : local_error
+    );
+
+    if (!target.IsValid()) return nullptr;
+
+    return static_cast<lldb_target_t>(new lldb::SBTarget(target));
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+lldb_target_t lldb_debugger_create_target_simple(lldb_debugger_t dbg,
+                                                  const char* filename)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!dbg) return nullptr;
+
+    lldb::SBDebugger* debugger = static_cast<lldb::SBDebugger*>(dbg);
+    lldb::SBTarget target = debugger->CreateTarget(filename);
+
+    if (!target.IsValid()) return nullptr;
+
+    return static_cast<lldb_target_t>(new lldb::SBTarget(target));
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+uint32_t lldb_debugger_get_num_targets(lldb_debugger_t dbg)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!dbg) return 0;
+    return static_cast<lldb::SBDebugger*>(dbg)->GetNumTargets();
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+lldb_target_t lldb_debugger_get_target_at_index(lldb_debugger_t dbg, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!dbg) return nullptr;
+
+    lldb::SBDebugger* debugger = static_cast<lldb::SBDebugger*>(dbg);
+    lldb::SBTarget target = debugger->GetTargetAtIndex(index);
+
+    if (!target.IsValid()) return nullptr;
+
+    return static_cast<lldb_target_t>(new lldb::SBTarget(target));
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+lldb_target_t lldb_debugger_get_selected_target(lldb_debugger_t dbg)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!dbg) return nullptr;
+
+    lldb::SBDebugger* debugger = static_cast<lldb::SBDebugger*>(dbg);
+    lldb::SBTarget target = debugger->GetSelectedTarget();
+
+    if (!target.IsValid()) return nullptr;
+
+    return static_cast<lldb_target_t>(new lldb::SBTarget(target));
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+void lldb_debugger_set_async(lldb_debugger_t dbg, int async)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!dbg) return;
+    static_cast<lldb::SBDebugger*>(dbg)->SetAsync(async != 0);
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+    }
+}
+
+int lldb_debugger_get_async(lldb_debugger_t dbg)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!dbg) return 0;
+    return static_cast<lldb::SBDebugger*>(dbg)->GetAsync() ? 1 : 0;
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+void lldb_debugger_set_selected_target(lldb_debugger_t dbg, lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!dbg || !target) return;
+    lldb::SBDebugger* debugger = static_cast<lldb::SBDebugger*>(dbg);
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    debugger->SetSelectedTarget(*t);
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+    }
+}
+
+int lldb_debugger_delete_target(lldb_debugger_t dbg, lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!dbg || !target) return 0;
+    lldb::SBDebugger* debugger = static_cast<lldb::SBDebugger*>(dbg);
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    return debugger->DeleteTarget(*t) ? 1 : 0;
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+lldb_target_t lldb_debugger_find_target_with_process_id(lldb_debugger_t dbg, uint64_t pid)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!dbg) return nullptr;
+    lldb::SBDebugger* debugger = static_cast<lldb::SBDebugger*>(dbg);
+    lldb::SBTarget target = debugger->FindTargetWithProcessID(pid);
+    if (!target.IsValid()) return nullptr;
+    return static_cast<lldb_target_t>(new lldb::SBTarget(target));
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+const char* lldb_debugger_get_version_string(void)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    return lldb::SBDebugger::GetVersionString();
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+lldb_command_interpreter_t lldb_debugger_get_command_interpreter(lldb_debugger_t dbg)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!dbg) return nullptr;
+    lldb::SBDebugger* debugger = static_cast<lldb::SBDebugger*>(dbg);
+    lldb::SBCommandInterpreter interp = debugger->GetCommandInterpreter();
+    if (!interp.IsValid()) return nullptr;
+    return static_cast<lldb_command_interpreter_t>(new lldb::SBCommandInterpreter(interp));
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+void lldb_debugger_handle_command(lldb_debugger_t dbg, const char* command)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!dbg || !command) return;
+    lldb::SBDebugger* debugger = static_cast<lldb::SBDebugger*>(dbg);
+    debugger->HandleCommand(command);
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+    }
+}
+
+lldb_broadcaster_t lldb_debugger_get_broadcaster(lldb_debugger_t dbg)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!dbg) return nullptr;
+    lldb::SBBroadcaster broadcaster = static_cast<lldb::SBDebugger*>(dbg)->GetBroadcaster();
+    if (!broadcaster.IsValid()) return nullptr;
+    return static_cast<lldb_broadcaster_t>(new lldb::SBBroadcaster(broadcaster));
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+lldb_listener_t lldb_debugger_get_listener(lldb_debugger_t dbg)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!dbg) return nullptr;
+    lldb::SBListener listener = static_cast<lldb::SBDebugger*>(dbg)->GetListener();
+    if (!listener.IsValid()) return nullptr;
+    return static_cast<lldb_listener_t>(new lldb::SBListener(listener));
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+// ============================================================================
+// SBBroadcaster, SBListener, and SBEvent
+// ============================================================================
+
+lldb_broadcaster_t lldb_broadcaster_create(const char* name)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    return static_cast<lldb_broadcaster_t>(new lldb::SBBroadcaster(name));
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+void lldb_broadcaster_destroy(lldb_broadcaster_t broadcaster)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (broadcaster) delete static_cast<lldb::SBBroadcaster*>(broadcaster);
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+    }
+}
+
+int lldb_broadcaster_is_valid(lldb_broadcaster_t broadcaster)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    return broadcaster && static_cast<lldb::SBBroadcaster*>(broadcaster)->IsValid() ? 1 : 0;
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+const char* lldb_broadcaster_get_name(lldb_broadcaster_t broadcaster)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!broadcaster) return nullptr;
+    return static_cast<lldb::SBBroadcaster*>(broadcaster)->GetName();
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+uint32_t lldb_broadcaster_add_listener(lldb_broadcaster_t broadcaster,
+                                        lldb_listener_t listener,
+                                        uint32_t event_mask)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!broadcaster || !listener) return 0;
+    return static_cast<lldb::SBBroadcaster*>(broadcaster)->AddListener(
+        *static_cast<lldb::SBListener*>(listener), event_mask);
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+int lldb_broadcaster_remove_listener(lldb_broadcaster_t broadcaster,
+                                     lldb_listener_t listener,
+                                     uint32_t event_mask)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!broadcaster || !listener) return 0;
+    return static_cast<lldb::SBBroadcaster*>(broadcaster)->RemoveListener(
+               *static_cast<lldb::SBListener*>(listener), event_mask)
+               ? 1
+               : 0;
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+int lldb_broadcaster_event_type_has_listeners(lldb_broadcaster_t broadcaster,
+                                              uint32_t event_type)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!broadcaster) return 0;
+    return static_cast<lldb::SBBroadcaster*>(broadcaster)->EventTypeHasListeners(event_type) ? 1 : 0;
 
-static void wrapper_set_invalid_argument(lldb::SBError* error, const char* message) noexcept {
-    if (error) error->SetErrorString(message);
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
 }
 
-static void wrapper_copy_error(lldb_error_t output, const lldb::SBError& error) {
-    if (output) *static_cast<lldb::SBError*>(output) = error;
-}
+void lldb_broadcaster_broadcast_event_by_type(lldb_broadcaster_t broadcaster,
+                                               uint32_t event_type,
+                                               int unique)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!broadcaster) return;
+    static_cast<lldb::SBBroadcaster*>(broadcaster)->BroadcastEventByType(event_type, unique != 0);
 
-static lldb_ruby_status_t wrapper_status(lldb::SBError& error, lldb_error_t output) {
-    wrapper_copy_error(output, error);
-    return error.Success() ? LLDB_RUBY_STATUS_OK : LLDB_RUBY_STATUS_LLDB_ERROR;
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+    }
 }
 
-static bool wrapper_copy_file_spec_path(const lldb::SBFileSpec& file_spec,
-                                        std::string& output) {
-    size_t capacity = 256;
-    for (;;) {
-        output.resize(capacity);
-        uint32_t written = file_spec.GetPath(output.data(), output.size());
-        if (written < output.size() - 1) {
-            output.resize(written);
-            return written > 0;
-        }
+lldb_listener_t lldb_listener_create(const char* name)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    return static_cast<lldb_listener_t>(new lldb::SBListener(name));
 
-        capacity = std::max(capacity * 2, static_cast<size_t>(written) + 2);
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-static_assert(LLDB_INVALID_ADDRESS == UINT64_MAX, "unexpected LLDB invalid address sentinel");
-static_assert(LLDB_INVALID_PROCESS_ID == 0, "unexpected LLDB invalid process sentinel");
-static_assert(LLDB_INVALID_THREAD_ID == 0, "unexpected LLDB invalid thread sentinel");
-static_assert(LLDB_INVALID_BREAK_ID == 0, "unexpected LLDB invalid breakpoint sentinel");
-static_assert(LLDB_INVALID_LINE_NUMBER == UINT32_MAX, "unexpected LLDB invalid line sentinel");
-
-extern "C" {
+void lldb_listener_destroy(lldb_listener_t listener)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (listener) delete static_cast<lldb::SBListener*>(listener);
 
-// ============================================================================
-// Wrapper metadata and capabilities
-// ============================================================================
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+    }
+}
 
-uint32_t lldb_wrapper_abi_version(void)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_listener_is_valid(lldb_listener_t listener)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return LLDB_RUBY_WRAPPER_ABI_VERSION;
+    return listener && static_cast<lldb::SBListener*>(listener)->IsValid() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -82,9 +3769,13 @@ uint32_t lldb_wrapper_abi_version(void)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-const char* lldb_wrapper_build_lldb_version(void)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_listener_start_listening_for_events(lldb_listener_t listener,
+                                                  lldb_broadcaster_t broadcaster,
+                                                  uint32_t event_mask)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return LLDB_RUBY_BUILD_LLDB_VERSION;
+    if (!listener || !broadcaster) return 0;
+    return static_cast<lldb::SBListener*>(listener)->StartListeningForEvents(
+        *static_cast<lldb::SBBroadcaster*>(broadcaster), event_mask);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -98,9 +3789,15 @@ const char* lldb_wrapper_build_lldb_version(void)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-const char* lldb_wrapper_runtime_lldb_version(void)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_listener_stop_listening_for_events(lldb_listener_t listener,
+                                            lldb_broadcaster_t broadcaster,
+                                            uint32_t event_mask)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return lldb::SBDebugger::GetVersionString();
+    if (!listener || !broadcaster) return 0;
+    return static_cast<lldb::SBListener*>(listener)->StopListeningForEvents(
+               *static_cast<lldb::SBBroadcaster*>(broadcaster), event_mask)
+               ? 1
+               : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -114,14 +3811,12 @@ const char* lldb_wrapper_runtime_lldb_version(void)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-int lldb_wrapper_has_capability(uint32_t capability)  LLDB_WRAPPER_NOEXCEPT {
+lldb_event_t lldb_listener_wait_for_event(lldb_listener_t listener, uint32_t timeout_seconds)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    switch (capability) {
-        case LLDB_RUBY_CAPABILITY_WATCHPOINT_ACCESS_KIND:
-            return LLDB_RUBY_HAVE_WATCHPOINT_ACCESS_KIND;
-        default:
-            return 0;
-    }
+    if (!listener) return nullptr;
+    lldb::SBEvent event;
+    if (!static_cast<lldb::SBListener*>(listener)->WaitForEvent(timeout_seconds, event)) return nullptr;
+    return static_cast<lldb_event_t>(new lldb::SBEvent(event));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -135,9 +3830,12 @@ int lldb_wrapper_has_capability(uint32_t capability)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-const char* lldb_wrapper_last_error_message(void)  LLDB_WRAPPER_NOEXCEPT {
+lldb_event_t lldb_listener_peek_event(lldb_listener_t listener)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return g_last_error_message;
+    if (!listener) return nullptr;
+    lldb::SBEvent event;
+    if (!static_cast<lldb::SBListener*>(listener)->PeekAtNextEvent(event)) return nullptr;
+    return static_cast<lldb_event_t>(new lldb::SBEvent(event));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -151,9 +3849,12 @@ const char* lldb_wrapper_last_error_message(void)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-int lldb_wrapper_last_error_code(void)  LLDB_WRAPPER_NOEXCEPT {
+lldb_event_t lldb_listener_next_event(lldb_listener_t listener)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return g_last_error_code;
+    if (!listener) return nullptr;
+    lldb::SBEvent event;
+    if (!static_cast<lldb::SBListener*>(listener)->GetNextEvent(event)) return nullptr;
+    return static_cast<lldb_event_t>(new lldb::SBEvent(event));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -167,9 +3868,9 @@ int lldb_wrapper_last_error_code(void)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-void lldb_wrapper_clear_last_error(void)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_event_destroy(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    wrapper_clear_error_state();
+    if (event) delete static_cast<lldb::SBEvent*>(event);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -180,59 +3881,124 @@ void lldb_wrapper_clear_last_error(void)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-// ============================================================================
-// Initialization
-// ============================================================================
+int lldb_event_is_valid(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    return event && static_cast<lldb::SBEvent*>(event)->IsValid() ? 1 : 0;
 
-lldb_ruby_status_t lldb_initialize(lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+uint32_t lldb_event_get_type(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    wrapper_clear_error_state();
+    if (!event) return 0;
+    return static_cast<lldb::SBEvent*>(event)->GetType();
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+const char* lldb_event_get_data_flavor(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
     try {
-        lldb::SBError init_error = lldb::SBDebugger::InitializeWithErrorHandling();
-        return wrapper_status(init_error, error);
-    } catch (const std::bad_alloc&) {
-        wrapper_set_error_state("native allocation failed during initialization");
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    if (!event) return nullptr;
+    return static_cast<lldb::SBEvent*>(event)->GetDataFlavor();
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+        return {};
     } catch (...) {
-        wrapper_set_error_state("unknown native exception during initialization");
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
+}
+
+const char* lldb_event_get_broadcaster_class(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!event) return nullptr;
+    return static_cast<lldb::SBEvent*>(event)->GetBroadcasterClass();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+        return {};
     }
 }
 
-void lldb_terminate(void)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_event_get_description(lldb_event_t event, char* buffer, size_t length)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    lldb::SBDebugger::Terminate();
+    if (!event) return 0;
+    lldb::SBStream stream;
+    if (!static_cast<lldb::SBEvent*>(event)->GetDescription(stream)) return 0;
+    const char* description = stream.GetData();
+    if (!description) return 0;
+
+    size_t required = std::strlen(description);
+    if (!buffer || length == 0) return static_cast<uint32_t>(required);
+
+    size_t copied = std::min(required, length - 1);
+    std::memcpy(buffer, description, copied);
+    buffer[copied] = '\0';
+    return static_cast<uint32_t>(copied);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-// ============================================================================
-// SBDebugger
-// ============================================================================
+lldb_broadcaster_t lldb_event_get_broadcaster(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!event) return nullptr;
+    lldb::SBBroadcaster broadcaster = static_cast<lldb::SBEvent*>(event)->GetBroadcaster();
+    if (!broadcaster.IsValid()) return nullptr;
+    return static_cast<lldb_broadcaster_t>(new lldb::SBBroadcaster(broadcaster));
 
-lldb_debugger_t lldb_debugger_create(void)  LLDB_WRAPPER_NOEXCEPT {
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+int lldb_event_is_process_event(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return lldb_debugger_create_with_source_init_files(0);
+    if (!event) return 0;
+    return lldb::SBProcess::EventIsProcessEvent(*static_cast<lldb::SBEvent*>(event)) ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -246,11 +4012,10 @@ lldb_debugger_t lldb_debugger_create(void)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-lldb_debugger_t lldb_debugger_create_with_source_init_files(int source_init_files)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_event_get_process_state(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    lldb::SBDebugger* dbg = new lldb::SBDebugger(
-        lldb::SBDebugger::Create(source_init_files != 0));
-    return static_cast<lldb_debugger_t>(dbg);
+    if (!event) return 0;
+    return static_cast<int>(lldb::SBProcess::GetStateFromEvent(*static_cast<lldb::SBEvent*>(event)));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -264,29 +4029,27 @@ lldb_debugger_t lldb_debugger_create_with_source_init_files(int source_init_file
     }
 }
 
-void lldb_debugger_destroy(lldb_debugger_t dbg)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_event_get_restarted(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (dbg) {
-        lldb::SBDebugger* debugger = static_cast<lldb::SBDebugger*>(dbg);
-        if (debugger->IsValid()) {
-            lldb::SBDebugger::Destroy(*debugger);
-        }
-        delete debugger;
-    }
+    if (!event) return 0;
+    return lldb::SBProcess::GetRestartedFromEvent(*static_cast<lldb::SBEvent*>(event)) ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-int lldb_debugger_is_valid(lldb_debugger_t dbg)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_event_get_interrupted(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!dbg) return 0;
-    return static_cast<lldb::SBDebugger*>(dbg)->IsValid() ? 1 : 0;
+    if (!event) return 0;
+    return lldb::SBProcess::GetInterruptedFromEvent(*static_cast<lldb::SBEvent*>(event)) ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -300,30 +4063,13 @@ int lldb_debugger_is_valid(lldb_debugger_t dbg)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-lldb_target_t lldb_debugger_create_target(lldb_debugger_t dbg,
-                                           const char* filename,
-                                           const char* arch,
-                                           const char* platform,
-                                           int add_dependent_modules,
-                                           lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
+lldb_process_t lldb_event_get_process(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!dbg) return nullptr;
-
-    lldb::SBDebugger* debugger = static_cast<lldb::SBDebugger*>(dbg);
-    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
-    lldb::SBError local_error;
-
-    lldb::SBTarget target = debugger->CreateTarget(
-        filename,
-        arch ? arch : "",
-        platform ? platform : "",
-        add_dependent_modules != 0,
-        err ? *err : local_error
-    );
-
-    if (!target.IsValid()) return nullptr;
-
-    return static_cast<lldb_target_t>(new lldb::SBTarget(target));
+    if (!event) return nullptr;
+    lldb::SBProcess process = lldb::SBProcess::GetProcessFromEvent(
+        *static_cast<lldb::SBEvent*>(event));
+    if (!process.IsValid()) return nullptr;
+    return static_cast<lldb_process_t>(new lldb::SBProcess(process));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -337,34 +4083,29 @@ lldb_target_t lldb_debugger_create_target(lldb_debugger_t dbg,
     }
 }
 
-lldb_target_t lldb_debugger_create_target_simple(lldb_debugger_t dbg,
-                                                  const char* filename)  LLDB_WRAPPER_NOEXCEPT {
-    try {
-    if (!dbg) return nullptr;
-
-    lldb::SBDebugger* debugger = static_cast<lldb::SBDebugger*>(dbg);
-    lldb::SBTarget target = debugger->CreateTarget(filename);
-
-    if (!target.IsValid()) return nullptr;
+// ============================================================================
+// SBTarget
+// ============================================================================
 
-    return static_cast<lldb_target_t>(new lldb::SBTarget(target));
+void lldb_target_destroy(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (target) {
+        delete static_cast<lldb::SBTarget*>(target);
+    }
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-uint32_t lldb_debugger_get_num_targets(lldb_debugger_t dbg)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_target_is_valid(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!dbg) return 0;
-    return static_cast<lldb::SBDebugger*>(dbg)->GetNumTargets();
+    if (!target) return 0;
+    return static_cast<lldb::SBTarget*>(target)->IsValid() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -378,16 +4119,19 @@ uint32_t lldb_debugger_get_num_targets(lldb_debugger_t dbg)  LLDB_WRAPPER_NOEXCE
     }
 }
 
-lldb_target_t lldb_debugger_get_target_at_index(lldb_debugger_t dbg, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
+lldb_process_t lldb_target_launch_simple(lldb_target_t target,
+                                          const char** argv,
+                                          const char** envp,
+                                          const char* working_dir)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!dbg) return nullptr;
+    if (!target) return nullptr;
 
-    lldb::SBDebugger* debugger = static_cast<lldb::SBDebugger*>(dbg);
-    lldb::SBTarget target = debugger->GetTargetAtIndex(index);
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    lldb::SBProcess process = t->LaunchSimple(argv, envp, working_dir);
 
-    if (!target.IsValid()) return nullptr;
+    if (!process.IsValid()) return nullptr;
 
-    return static_cast<lldb_target_t>(new lldb::SBTarget(target));
+    return static_cast<lldb_process_t>(new lldb::SBProcess(process));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -401,16 +4145,22 @@ lldb_target_t lldb_debugger_get_target_at_index(lldb_debugger_t dbg, uint32_t in
     }
 }
 
-lldb_target_t lldb_debugger_get_selected_target(lldb_debugger_t dbg)  LLDB_WRAPPER_NOEXCEPT {
+lldb_process_t lldb_target_launch(lldb_target_t target,
+                                   lldb_launch_info_t launch_info,
+                                   lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!dbg) return nullptr;
+    if (!target || !launch_info) return nullptr;
 
-    lldb::SBDebugger* debugger = static_cast<lldb::SBDebugger*>(dbg);
-    lldb::SBTarget target = debugger->GetSelectedTarget();
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    lldb::SBLaunchInfo* info = static_cast<lldb::SBLaunchInfo*>(launch_info);
+    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
+    lldb::SBError local_error;
 
-    if (!target.IsValid()) return nullptr;
+    lldb::SBProcess process = t->Launch(*info, err ? *err : local_error);
 
-    return static_cast<lldb_target_t>(new lldb::SBTarget(target));
+    if (!process.IsValid()) return nullptr;
+
+    return static_cast<lldb_process_t>(new lldb::SBProcess(process));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -424,24 +4174,61 @@ lldb_target_t lldb_debugger_get_selected_target(lldb_debugger_t dbg)  LLDB_WRAPP
     }
 }
 
-void lldb_debugger_set_async(lldb_debugger_t dbg, int async)  LLDB_WRAPPER_NOEXCEPT {
+lldb_process_t lldb_target_attach_to_process_with_id(lldb_target_t target,
+                                                      uint64_t pid,
+                                                      lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!dbg) return;
-    static_cast<lldb::SBDebugger*>(dbg)->SetAsync(async != 0);
+    if (!target) return nullptr;
+
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
+    lldb::SBError local_error;
+    lldb::SBListener listener;
+
+    lldb::SBProcess process = t->AttachToProcessWithID(
+        listener,
+        pid,
+        err ? *err : local_error
+    );
+
+    if (!process.IsValid()) return nullptr;
+
+    return static_cast<lldb_process_t>(new lldb::SBProcess(process));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-int lldb_debugger_get_async(lldb_debugger_t dbg)  LLDB_WRAPPER_NOEXCEPT {
+lldb_process_t lldb_target_attach_to_process_with_name(lldb_target_t target,
+                                                        const char* name,
+                                                        int wait_for,
+                                                        lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!dbg) return 0;
-    return static_cast<lldb::SBDebugger*>(dbg)->GetAsync() ? 1 : 0;
+    if (!target || !name) return nullptr;
+
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
+    lldb::SBError local_error;
+    lldb::SBListener listener;
+
+    lldb::SBProcess process = t->AttachToProcessWithName(
+        listener,
+        name,
+        wait_for != 0,
+        err ? *err : local_error
+    );
+
+    if (!process.IsValid()) return nullptr;
+
+    return static_cast<lldb_process_t>(new lldb::SBProcess(process));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -455,28 +4242,45 @@ int lldb_debugger_get_async(lldb_debugger_t dbg)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-void lldb_debugger_set_selected_target(lldb_debugger_t dbg, lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+lldb_process_t lldb_target_attach_with_info(lldb_target_t target,
+                                             lldb_attach_info_t attach_info,
+                                             lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!dbg || !target) return;
-    lldb::SBDebugger* debugger = static_cast<lldb::SBDebugger*>(dbg);
+    if (!target || !attach_info) return nullptr;
+
     lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    debugger->SetSelectedTarget(*t);
+    lldb::SBAttachInfo* info = static_cast<lldb::SBAttachInfo*>(attach_info);
+    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
+    lldb::SBError local_error;
+    lldb::SBProcess process = t->Attach(*info, err ? *err : local_error);
+
+    if (!process.IsValid()) return nullptr;
+    return static_cast<lldb_process_t>(new lldb::SBProcess(process));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-int lldb_debugger_delete_target(lldb_debugger_t dbg, lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+lldb_breakpoint_t lldb_target_breakpoint_create_by_name(lldb_target_t target,
+                                                         const char* symbol_name,
+                                                         const char* module_name)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!dbg || !target) return 0;
-    lldb::SBDebugger* debugger = static_cast<lldb::SBDebugger*>(dbg);
+    if (!target || !symbol_name) return nullptr;
+
     lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    return debugger->DeleteTarget(*t) ? 1 : 0;
+    lldb::SBBreakpoint bp = t->BreakpointCreateByName(symbol_name, module_name);
+
+    if (!bp.IsValid()) return nullptr;
+
+    return static_cast<lldb_breakpoint_t>(new lldb::SBBreakpoint(bp));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -490,13 +4294,18 @@ int lldb_debugger_delete_target(lldb_debugger_t dbg, lldb_target_t target)  LLDB
     }
 }
 
-lldb_target_t lldb_debugger_find_target_with_process_id(lldb_debugger_t dbg, uint64_t pid)  LLDB_WRAPPER_NOEXCEPT {
+lldb_breakpoint_t lldb_target_breakpoint_create_by_location(lldb_target_t target,
+                                                             const char* file,
+                                                             uint32_t line)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!dbg) return nullptr;
-    lldb::SBDebugger* debugger = static_cast<lldb::SBDebugger*>(dbg);
-    lldb::SBTarget target = debugger->FindTargetWithProcessID(pid);
-    if (!target.IsValid()) return nullptr;
-    return static_cast<lldb_target_t>(new lldb::SBTarget(target));
+    if (!target || !file) return nullptr;
+
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    lldb::SBBreakpoint bp = t->BreakpointCreateByLocation(file, line);
+
+    if (!bp.IsValid()) return nullptr;
+
+    return static_cast<lldb_breakpoint_t>(new lldb::SBBreakpoint(bp));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -510,9 +4319,17 @@ lldb_target_t lldb_debugger_find_target_with_process_id(lldb_debugger_t dbg, uin
     }
 }
 
-const char* lldb_debugger_get_version_string(void)  LLDB_WRAPPER_NOEXCEPT {
+lldb_breakpoint_t lldb_target_breakpoint_create_by_address(lldb_target_t target,
+                                                            uint64_t address)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return lldb::SBDebugger::GetVersionString();
+    if (!target) return nullptr;
+
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    lldb::SBBreakpoint bp = t->BreakpointCreateByAddress(address);
+
+    if (!bp.IsValid()) return nullptr;
+
+    return static_cast<lldb_breakpoint_t>(new lldb::SBBreakpoint(bp));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -526,13 +4343,18 @@ const char* lldb_debugger_get_version_string(void)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-lldb_command_interpreter_t lldb_debugger_get_command_interpreter(lldb_debugger_t dbg)  LLDB_WRAPPER_NOEXCEPT {
+lldb_breakpoint_t lldb_target_breakpoint_create_by_regex(lldb_target_t target,
+                                                          const char* symbol_regex,
+                                                          const char* module_name)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!dbg) return nullptr;
-    lldb::SBDebugger* debugger = static_cast<lldb::SBDebugger*>(dbg);
-    lldb::SBCommandInterpreter interp = debugger->GetCommandInterpreter();
-    if (!interp.IsValid()) return nullptr;
-    return static_cast<lldb_command_interpreter_t>(new lldb::SBCommandInterpreter(interp));
+    if (!target || !symbol_regex) return nullptr;
+
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    lldb::SBBreakpoint bp = t->BreakpointCreateByRegex(symbol_regex, module_name);
+
+    if (!bp.IsValid()) return nullptr;
+
+    return static_cast<lldb_breakpoint_t>(new lldb::SBBreakpoint(bp));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -546,27 +4368,40 @@ lldb_command_interpreter_t lldb_debugger_get_command_interpreter(lldb_debugger_t
     }
 }
 
-void lldb_debugger_handle_command(lldb_debugger_t dbg, const char* command)  LLDB_WRAPPER_NOEXCEPT {
+lldb_breakpoint_t lldb_target_breakpoint_create_by_source_regex(lldb_target_t target,
+                                                                 const char* source_regex,
+                                                                 const char* source_file)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!dbg || !command) return;
-    lldb::SBDebugger* debugger = static_cast<lldb::SBDebugger*>(dbg);
-    debugger->HandleCommand(command);
+    if (!target || !source_regex) return nullptr;
+
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    lldb::SBFileSpecList module_list;
+    lldb::SBFileSpecList source_list;
+    if (source_file) {
+        source_list.Append(lldb::SBFileSpec(source_file));
+    }
+    lldb::SBBreakpoint bp = t->BreakpointCreateBySourceRegex(source_regex, module_list, source_list);
+
+    if (!bp.IsValid()) return nullptr;
+
+    return static_cast<lldb_breakpoint_t>(new lldb::SBBreakpoint(bp));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-lldb_broadcaster_t lldb_debugger_get_broadcaster(lldb_debugger_t dbg)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_target_delete_breakpoint(lldb_target_t target, int32_t breakpoint_id)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!dbg) return nullptr;
-    lldb::SBBroadcaster broadcaster = static_cast<lldb::SBDebugger*>(dbg)->GetBroadcaster();
-    if (!broadcaster.IsValid()) return nullptr;
-    return static_cast<lldb_broadcaster_t>(new lldb::SBBroadcaster(broadcaster));
+    if (!target) return 0;
+    return static_cast<lldb::SBTarget*>(target)->BreakpointDelete(breakpoint_id) ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -580,12 +4415,10 @@ lldb_broadcaster_t lldb_debugger_get_broadcaster(lldb_debugger_t dbg)  LLDB_WRAP
     }
 }
 
-lldb_listener_t lldb_debugger_get_listener(lldb_debugger_t dbg)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_target_delete_all_breakpoints(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!dbg) return nullptr;
-    lldb::SBListener listener = static_cast<lldb::SBDebugger*>(dbg)->GetListener();
-    if (!listener.IsValid()) return nullptr;
-    return static_cast<lldb_listener_t>(new lldb::SBListener(listener));
+    if (!target) return 0;
+    return static_cast<lldb::SBTarget*>(target)->DeleteAllBreakpoints() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -599,13 +4432,10 @@ lldb_listener_t lldb_debugger_get_listener(lldb_debugger_t dbg)  LLDB_WRAPPER_NO
     }
 }
 
-// ============================================================================
-// SBBroadcaster, SBListener, and SBEvent
-// ============================================================================
-
-lldb_broadcaster_t lldb_broadcaster_create(const char* name)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_target_enable_all_breakpoints(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return static_cast<lldb_broadcaster_t>(new lldb::SBBroadcaster(name));
+    if (!target) return 0;
+    return static_cast<lldb::SBTarget*>(target)->EnableAllBreakpoints() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -619,22 +4449,33 @@ lldb_broadcaster_t lldb_broadcaster_create(const char* name)  LLDB_WRAPPER_NOEXC
     }
 }
 
-void lldb_broadcaster_destroy(lldb_broadcaster_t broadcaster)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_target_disable_all_breakpoints(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (broadcaster) delete static_cast<lldb::SBBroadcaster*>(broadcaster);
+    if (!target) return 0;
+    return static_cast<lldb::SBTarget*>(target)->DisableAllBreakpoints() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-int lldb_broadcaster_is_valid(lldb_broadcaster_t broadcaster)  LLDB_WRAPPER_NOEXCEPT {
+lldb_breakpoint_t lldb_target_find_breakpoint_by_id(lldb_target_t target, int32_t id)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return broadcaster && static_cast<lldb::SBBroadcaster*>(broadcaster)->IsValid() ? 1 : 0;
+    if (!target) return nullptr;
+
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    lldb::SBBreakpoint bp = t->FindBreakpointByID(id);
+
+    if (!bp.IsValid()) return nullptr;
+
+    return static_cast<lldb_breakpoint_t>(new lldb::SBBreakpoint(bp));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -648,10 +4489,10 @@ int lldb_broadcaster_is_valid(lldb_broadcaster_t broadcaster)  LLDB_WRAPPER_NOEX
     }
 }
 
-const char* lldb_broadcaster_get_name(lldb_broadcaster_t broadcaster)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_target_get_num_breakpoints(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!broadcaster) return nullptr;
-    return static_cast<lldb::SBBroadcaster*>(broadcaster)->GetName();
+    if (!target) return 0;
+    return static_cast<lldb::SBTarget*>(target)->GetNumBreakpoints();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -665,13 +4506,16 @@ const char* lldb_broadcaster_get_name(lldb_broadcaster_t broadcaster)  LLDB_WRAP
     }
 }
 
-uint32_t lldb_broadcaster_add_listener(lldb_broadcaster_t broadcaster,
-                                        lldb_listener_t listener,
-                                        uint32_t event_mask)  LLDB_WRAPPER_NOEXCEPT {
+lldb_breakpoint_t lldb_target_get_breakpoint_at_index(lldb_target_t target, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!broadcaster || !listener) return 0;
-    return static_cast<lldb::SBBroadcaster*>(broadcaster)->AddListener(
-        *static_cast<lldb::SBListener*>(listener), event_mask);
+    if (!target) return nullptr;
+
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    lldb::SBBreakpoint bp = t->GetBreakpointAtIndex(index);
+
+    if (!bp.IsValid()) return nullptr;
+
+    return static_cast<lldb_breakpoint_t>(new lldb::SBBreakpoint(bp));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -685,15 +4529,16 @@ uint32_t lldb_broadcaster_add_listener(lldb_broadcaster_t broadcaster,
     }
 }
 
-int lldb_broadcaster_remove_listener(lldb_broadcaster_t broadcaster,
-                                     lldb_listener_t listener,
-                                     uint32_t event_mask)  LLDB_WRAPPER_NOEXCEPT {
+lldb_process_t lldb_target_get_process(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!broadcaster || !listener) return 0;
-    return static_cast<lldb::SBBroadcaster*>(broadcaster)->RemoveListener(
-               *static_cast<lldb::SBListener*>(listener), event_mask)
-               ? 1
-               : 0;
+    if (!target) return nullptr;
+
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    lldb::SBProcess process = t->GetProcess();
+
+    if (!process.IsValid()) return nullptr;
+
+    return static_cast<lldb_process_t>(new lldb::SBProcess(process));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -707,11 +4552,20 @@ int lldb_broadcaster_remove_listener(lldb_broadcaster_t broadcaster,
     }
 }
 
-int lldb_broadcaster_event_type_has_listeners(lldb_broadcaster_t broadcaster,
-                                              uint32_t event_type)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_target_get_executable_path(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!broadcaster) return 0;
-    return static_cast<lldb::SBBroadcaster*>(broadcaster)->EventTypeHasListeners(event_type) ? 1 : 0;
+    if (!target) return nullptr;
+
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    lldb::SBFileSpec spec = t->GetExecutable();
+
+    if (!spec.IsValid()) return nullptr;
+
+    if (wrapper_copy_file_spec_path(spec, g_temp_string)) {
+        return g_temp_string.c_str();
+    }
+
+    return nullptr;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -725,25 +4579,31 @@ int lldb_broadcaster_event_type_has_listeners(lldb_broadcaster_t broadcaster,
     }
 }
 
-void lldb_broadcaster_broadcast_event_by_type(lldb_broadcaster_t broadcaster,
-                                               uint32_t event_type,
-                                               int unique)  LLDB_WRAPPER_NOEXCEPT {
+lldb_file_spec_t lldb_target_get_executable_file(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!broadcaster) return;
-    static_cast<lldb::SBBroadcaster*>(broadcaster)->BroadcastEventByType(event_type, unique != 0);
+    if (!target) return nullptr;
+
+    lldb::SBFileSpec spec = static_cast<lldb::SBTarget*>(target)->GetExecutable();
+    if (!spec.IsValid()) return nullptr;
+
+    return static_cast<lldb_file_spec_t>(new lldb::SBFileSpec(spec));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-lldb_listener_t lldb_listener_create(const char* name)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_target_get_num_modules(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return static_cast<lldb_listener_t>(new lldb::SBListener(name));
+    if (!target) return 0;
+    return static_cast<lldb::SBTarget*>(target)->GetNumModules();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -757,22 +4617,39 @@ lldb_listener_t lldb_listener_create(const char* name)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-void lldb_listener_destroy(lldb_listener_t listener)  LLDB_WRAPPER_NOEXCEPT {
+lldb_module_t lldb_target_get_module_at_index(lldb_target_t target, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (listener) delete static_cast<lldb::SBListener*>(listener);
+    if (!target) return nullptr;
+
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    lldb::SBModule module = t->GetModuleAtIndex(index);
+
+    if (!module.IsValid()) return nullptr;
+
+    return static_cast<lldb_module_t>(new lldb::SBModule(module));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-int lldb_listener_is_valid(lldb_listener_t listener)  LLDB_WRAPPER_NOEXCEPT {
+lldb_value_t lldb_target_evaluate_expression(lldb_target_t target, const char* expr)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return listener && static_cast<lldb::SBListener*>(listener)->IsValid() ? 1 : 0;
+    if (!target || !expr) return nullptr;
+
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    lldb::SBValue value = t->EvaluateExpression(expr);
+
+    if (!value.IsValid()) return nullptr;
+
+    return wrapper_new_value(value);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -786,13 +4663,17 @@ int lldb_listener_is_valid(lldb_listener_t listener)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-uint32_t lldb_listener_start_listening_for_events(lldb_listener_t listener,
-                                                  lldb_broadcaster_t broadcaster,
-                                                  uint32_t event_mask)  LLDB_WRAPPER_NOEXCEPT {
+lldb_value_t lldb_target_evaluate_expression_with_options(lldb_target_t target,
+                                                          const char* expr,
+                                                          lldb_expression_options_t options)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!listener || !broadcaster) return 0;
-    return static_cast<lldb::SBListener*>(listener)->StartListeningForEvents(
-        *static_cast<lldb::SBBroadcaster*>(broadcaster), event_mask);
+    if (!target || !expr || !options) return nullptr;
+
+    lldb::SBValue value = static_cast<lldb::SBTarget*>(target)->EvaluateExpression(
+        expr, *static_cast<lldb::SBExpressionOptions*>(options));
+    if (!value.IsValid()) return nullptr;
+
+    return wrapper_new_value(value);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -806,15 +4687,20 @@ uint32_t lldb_listener_start_listening_for_events(lldb_listener_t listener,
     }
 }
 
-int lldb_listener_stop_listening_for_events(lldb_listener_t listener,
-                                            lldb_broadcaster_t broadcaster,
-                                            uint32_t event_mask)  LLDB_WRAPPER_NOEXCEPT {
+size_t lldb_target_read_memory(lldb_target_t target, uint64_t addr, void* buf, size_t size, lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!listener || !broadcaster) return 0;
-    return static_cast<lldb::SBListener*>(listener)->StopListeningForEvents(
-               *static_cast<lldb::SBBroadcaster*>(broadcaster), event_mask)
-               ? 1
-               : 0;
+    if (!target || !buf) return 0;
+
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
+    lldb::SBError local_error;
+    lldb::SBProcess process = t->GetProcess();
+    if (process.IsValid() && wrapper_find_page_cache(process)) {
+        return wrapper_read_process_memory(process, addr, buf, size, err ? *err : local_error);
+    }
+
+    lldb::SBAddress sb_addr(addr, *t);
+    return t->ReadMemory(sb_addr, buf, size, err ? *err : local_error);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -828,12 +4714,10 @@ int lldb_listener_stop_listening_for_events(lldb_listener_t listener,
     }
 }
 
-lldb_event_t lldb_listener_wait_for_event(lldb_listener_t listener, uint32_t timeout_seconds)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_target_get_address_byte_size(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!listener) return nullptr;
-    lldb::SBEvent event;
-    if (!static_cast<lldb::SBListener*>(listener)->WaitForEvent(timeout_seconds, event)) return nullptr;
-    return static_cast<lldb_event_t>(new lldb::SBEvent(event));
+    if (!target) return 0;
+    return static_cast<lldb::SBTarget*>(target)->GetAddressByteSize();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -847,12 +4731,10 @@ lldb_event_t lldb_listener_wait_for_event(lldb_listener_t listener, uint32_t tim
     }
 }
 
-lldb_event_t lldb_listener_peek_event(lldb_listener_t listener)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_target_get_triple(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!listener) return nullptr;
-    lldb::SBEvent event;
-    if (!static_cast<lldb::SBListener*>(listener)->PeekAtNextEvent(event)) return nullptr;
-    return static_cast<lldb_event_t>(new lldb::SBEvent(event));
+    if (!target) return nullptr;
+    return static_cast<lldb::SBTarget*>(target)->GetTriple();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -866,12 +4748,19 @@ lldb_event_t lldb_listener_peek_event(lldb_listener_t listener)  LLDB_WRAPPER_NO
     }
 }
 
-lldb_event_t lldb_listener_next_event(lldb_listener_t listener)  LLDB_WRAPPER_NOEXCEPT {
+lldb_watchpoint_t lldb_target_watch_address(lldb_target_t target, uint64_t addr, size_t size, int read, int write, lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!listener) return nullptr;
-    lldb::SBEvent event;
-    if (!static_cast<lldb::SBListener*>(listener)->GetNextEvent(event)) return nullptr;
-    return static_cast<lldb_event_t>(new lldb::SBEvent(event));
+    if (!target) return nullptr;
+
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
+    lldb::SBError local_error;
+
+    lldb::SBWatchpoint wp = t->WatchAddress(addr, size, read != 0, write != 0, err ? *err : local_error);
+
+    if (!wp.IsValid()) return nullptr;
+
+    return static_cast<lldb_watchpoint_t>(new lldb::SBWatchpoint(wp));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -885,22 +4774,27 @@ lldb_event_t lldb_listener_next_event(lldb_listener_t listener)  LLDB_WRAPPER_NO
     }
 }
 
-void lldb_event_destroy(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_target_delete_watchpoint(lldb_target_t target, int32_t watchpoint_id)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (event) delete static_cast<lldb::SBEvent*>(event);
+    if (!target) return 0;
+    return static_cast<lldb::SBTarget*>(target)->DeleteWatchpoint(watchpoint_id) ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-int lldb_event_is_valid(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_target_delete_all_watchpoints(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return event && static_cast<lldb::SBEvent*>(event)->IsValid() ? 1 : 0;
+    if (!target) return 0;
+    return static_cast<lldb::SBTarget*>(target)->DeleteAllWatchpoints() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -914,10 +4808,16 @@ int lldb_event_is_valid(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-uint32_t lldb_event_get_type(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
+lldb_watchpoint_t lldb_target_find_watchpoint_by_id(lldb_target_t target, int32_t id)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!event) return 0;
-    return static_cast<lldb::SBEvent*>(event)->GetType();
+    if (!target) return nullptr;
+
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    lldb::SBWatchpoint wp = t->FindWatchpointByID(id);
+
+    if (!wp.IsValid()) return nullptr;
+
+    return static_cast<lldb_watchpoint_t>(new lldb::SBWatchpoint(wp));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -931,10 +4831,10 @@ uint32_t lldb_event_get_type(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-const char* lldb_event_get_data_flavor(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_target_get_num_watchpoints(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!event) return nullptr;
-    return static_cast<lldb::SBEvent*>(event)->GetDataFlavor();
+    if (!target) return 0;
+    return static_cast<lldb::SBTarget*>(target)->GetNumWatchpoints();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -948,10 +4848,16 @@ const char* lldb_event_get_data_flavor(lldb_event_t event)  LLDB_WRAPPER_NOEXCEP
     }
 }
 
-const char* lldb_event_get_broadcaster_class(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
+lldb_watchpoint_t lldb_target_get_watchpoint_at_index(lldb_target_t target, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!event) return nullptr;
-    return static_cast<lldb::SBEvent*>(event)->GetBroadcasterClass();
+    if (!target) return nullptr;
+
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    lldb::SBWatchpoint wp = t->GetWatchpointAtIndex(index);
+
+    if (!wp.IsValid()) return nullptr;
+
+    return static_cast<lldb_watchpoint_t>(new lldb::SBWatchpoint(wp));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -965,74 +4871,125 @@ const char* lldb_event_get_broadcaster_class(lldb_event_t event)  LLDB_WRAPPER_N
     }
 }
 
-uint32_t lldb_event_get_description(lldb_event_t event, char* buffer, size_t length)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_target_symbolicate(lldb_target_t target,
+                                           const uint64_t* addresses,
+                                           size_t count,
+                                           void* buffer,
+                                           size_t buffer_size,
+                                           uint64_t* required_size)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!event) return 0;
-    lldb::SBStream stream;
-    if (!static_cast<lldb::SBEvent*>(event)->GetDescription(stream)) return 0;
-    const char* description = stream.GetData();
-    if (!description) return 0;
+    wrapper_clear_error_state();
+    if (!target) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    if (!required_size || (!addresses && count > 0) || (!buffer && buffer_size > 0) || count > UINT32_MAX) {
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+
+    lldb::SBTarget& sb_target = *static_cast<lldb::SBTarget*>(target);
+    if (!sb_target.IsValid()) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+
+    WrapperSymbolCache& cache = wrapper_symbol_cache();
+    cache.sync(sb_target);
+    std::vector<lldb_ruby_symbol_scope_t> scopes;
+    scopes.reserve(count);
+    WrapperStringTable strings;
+    for (size_t index = 0; index < count; ++index) {
+        lldb_ruby_symbol_scope_t record{};
+        record.address = addresses[index];
+        record.module = record.function = record.file = UINT32_MAX;
+        std::shared_ptr<const WrapperSymbolication> symbolication = cache.lookup(sb_target, addresses[index]);
+        if (!symbolication) {
+            scopes.push_back(record);
+            continue;
+        }
 
-    size_t required = std::strlen(description);
-    if (!buffer || length == 0) return static_cast<uint32_t>(required);
+        uint32_t module = symbolication->module.empty() ? UINT32_MAX : strings.intern(symbolication->module.c_str());
+        for (size_t depth = 0; depth < symbolication->scopes.size(); ++depth) {
+            const WrapperSymbolScope& scope = symbolication->scopes[depth];
+            record.module = module;
+            record.function = scope.function.empty() ? UINT32_MAX : strings.intern(scope.function.c_str());
+            record.file = scope.file.empty() ? UINT32_MAX : strings.intern(scope.file.c_str());
+            record.line = scope.line;
+            record.column = scope.column;
+            record.flags = depth + 1 < symbolication->scopes.size() ? LLDB_RUBY_SYMBOL_SCOPE_INLINED : 0;
+            scopes.push_back(record);
+        }
+    }
 
-    size_t copied = std::min(required, length - 1);
-    std::memcpy(buffer, description, copied);
-    buffer[copied] = '\0';
-    return static_cast<uint32_t>(copied);
+    lldb_ruby_symbolication_header_t header{};
+    header.address_count = static_cast<uint32_t>(count);
+    header.scope_count = static_cast<uint32_t>(scopes.size());
+    header.scope_size = sizeof(lldb_ruby_symbol_scope_t);
+    header.strings_offset = sizeof(header) + scopes.size() * sizeof(lldb_ruby_symbol_scope_t);
+    header.strings_size = strings.bytes.size();
+    *required_size = header.strings_offset + header.strings_size;
+    if (buffer_size < *required_size) return LLDB_RUBY_STATUS_OK;
+
+    uint8_t* output = static_cast<uint8_t*>(buffer);
+    std::memcpy(output, &header, sizeof(header));
+    if (!scopes.empty()) {
+        std::memcpy(output + sizeof(header), scopes.data(), scopes.size() * sizeof(lldb_ruby_symbol_scope_t));
+    }
+    std::memcpy(output + header.strings_offset, strings.bytes.data(), strings.bytes.size());
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-lldb_broadcaster_t lldb_event_get_broadcaster(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_symbol_cache_clear(void)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!event) return nullptr;
-    lldb::SBBroadcaster broadcaster = static_cast<lldb::SBEvent*>(event)->GetBroadcaster();
-    if (!broadcaster.IsValid()) return nullptr;
-    return static_cast<lldb_broadcaster_t>(new lldb::SBBroadcaster(broadcaster));
+    WrapperSymbolCache& cache = wrapper_symbol_cache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.clear();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-int lldb_event_is_process_event(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_symbol_cache_get_stats(uint64_t* hits, uint64_t* misses, uint64_t* entries)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!event) return 0;
-    return lldb::SBProcess::EventIsProcessEvent(*static_cast<lldb::SBEvent*>(event)) ? 1 : 0;
+    wrapper_clear_error_state();
+    if (!hits || !misses || !entries) return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+
+    WrapperSymbolCache& cache = wrapper_symbol_cache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    *hits = cache.hits;
+    *misses = cache.misses;
+    *entries = cache.entry_count;
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-int lldb_event_get_process_state(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
+// ============================================================================
+// SBLaunchInfo
+// ============================================================================
+
+lldb_launch_info_t lldb_launch_info_create(const char** argv)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!event) return 0;
-    return static_cast<int>(lldb::SBProcess::GetStateFromEvent(*static_cast<lldb::SBEvent*>(event)));
+    return static_cast<lldb_launch_info_t>(new lldb::SBLaunchInfo(argv));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1046,27 +5003,24 @@ int lldb_event_get_process_state(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-int lldb_event_get_restarted(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_launch_info_destroy(lldb_launch_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!event) return 0;
-    return lldb::SBProcess::GetRestartedFromEvent(*static_cast<lldb::SBEvent*>(event)) ? 1 : 0;
+    if (info) {
+        delete static_cast<lldb::SBLaunchInfo*>(info);
+    }
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-int lldb_event_get_interrupted(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_launch_info_get_num_arguments(lldb_launch_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!event) return 0;
-    return lldb::SBProcess::GetInterruptedFromEvent(*static_cast<lldb::SBEvent*>(event)) ? 1 : 0;
+    return info ? static_cast<lldb::SBLaunchInfo*>(info)->GetNumArguments() : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1080,13 +5034,10 @@ int lldb_event_get_interrupted(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-lldb_process_t lldb_event_get_process(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_launch_info_get_argument_at_index(lldb_launch_info_t info, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!event) return nullptr;
-    lldb::SBProcess process = lldb::SBProcess::GetProcessFromEvent(
-        *static_cast<lldb::SBEvent*>(event));
-    if (!process.IsValid()) return nullptr;
-    return static_cast<lldb_process_t>(new lldb::SBProcess(process));
+    if (!info) return nullptr;
+    return static_cast<lldb::SBLaunchInfo*>(info)->GetArgumentAtIndex(index);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1100,15 +5051,10 @@ lldb_process_t lldb_event_get_process(lldb_event_t event)  LLDB_WRAPPER_NOEXCEPT
     }
 }
 
-// ============================================================================
-// SBTarget
-// ============================================================================
-
-void lldb_target_destroy(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_launch_info_set_working_directory(lldb_launch_info_t info, const char* dir)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (target) {
-        delete static_cast<lldb::SBTarget*>(target);
-    }
+    if (!info) return;
+    static_cast<lldb::SBLaunchInfo*>(info)->SetWorkingDirectory(dir);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1119,10 +5065,10 @@ void lldb_target_destroy(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-int lldb_target_is_valid(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_launch_info_get_working_directory(lldb_launch_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return 0;
-    return static_cast<lldb::SBTarget*>(target)->IsValid() ? 1 : 0;
+    if (!info) return nullptr;
+    return static_cast<lldb::SBLaunchInfo*>(info)->GetWorkingDirectory();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1136,48 +5082,37 @@ int lldb_target_is_valid(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-lldb_process_t lldb_target_launch_simple(lldb_target_t target,
-                                          const char** argv,
-                                          const char** envp,
-                                          const char* working_dir)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_launch_info_set_environment_entries(lldb_launch_info_t info,
+                                               const char** envp,
+                                               int append)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return nullptr;
-
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBProcess process = t->LaunchSimple(argv, envp, working_dir);
-
-    if (!process.IsValid()) return nullptr;
-
-    return static_cast<lldb_process_t>(new lldb::SBProcess(process));
+    if (!info) return;
+    lldb::SBEnvironment env;
+    if (envp) {
+        for (const char** e = envp; *e != nullptr; ++e) {
+            std::string entry(*e);
+            size_t pos = entry.find('=');
+            if (pos != std::string::npos) {
+                env.Set(entry.substr(0, pos).c_str(),
+                       entry.substr(pos + 1).c_str(),
+                       true);
+            }
+        }
+    }
+    static_cast<lldb::SBLaunchInfo*>(info)->SetEnvironment(env, append != 0);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-lldb_process_t lldb_target_launch(lldb_target_t target,
-                                   lldb_launch_info_t launch_info,
-                                   lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_launch_info_get_num_environment_entries(lldb_launch_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target || !launch_info) return nullptr;
-
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBLaunchInfo* info = static_cast<lldb::SBLaunchInfo*>(launch_info);
-    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
-    lldb::SBError local_error;
-
-    lldb::SBProcess process = t->Launch(*info, err ? *err : local_error);
-
-    if (!process.IsValid()) return nullptr;
-
-    return static_cast<lldb_process_t>(new lldb::SBProcess(process));
+    return info ? static_cast<lldb::SBLaunchInfo*>(info)->GetNumEnvironmentEntries() : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1191,26 +5126,11 @@ lldb_process_t lldb_target_launch(lldb_target_t target,
     }
 }
 
-lldb_process_t lldb_target_attach_to_process_with_id(lldb_target_t target,
-                                                      uint64_t pid,
-                                                      lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_launch_info_get_environment_entry_at_index(lldb_launch_info_t info,
+                                                             uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return nullptr;
-
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
-    lldb::SBError local_error;
-    lldb::SBListener listener;
-
-    lldb::SBProcess process = t->AttachToProcessWithID(
-        listener,
-        pid,
-        err ? *err : local_error
-    );
-
-    if (!process.IsValid()) return nullptr;
-
-    return static_cast<lldb_process_t>(new lldb::SBProcess(process));
+    if (!info) return nullptr;
+    return static_cast<lldb::SBLaunchInfo*>(info)->GetEnvironmentEntryAtIndex(index);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1224,28 +5144,10 @@ lldb_process_t lldb_target_attach_to_process_with_id(lldb_target_t target,
     }
 }
 
-lldb_process_t lldb_target_attach_to_process_with_name(lldb_target_t target,
-                                                        const char* name,
-                                                        int wait_for,
-                                                        lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_launch_info_get_launch_flags(lldb_launch_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target || !name) return nullptr;
-
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
-    lldb::SBError local_error;
-    lldb::SBListener listener;
-
-    lldb::SBProcess process = t->AttachToProcessWithName(
-        listener,
-        name,
-        wait_for != 0,
-        err ? *err : local_error
-    );
-
-    if (!process.IsValid()) return nullptr;
-
-    return static_cast<lldb_process_t>(new lldb::SBProcess(process));
+    if (!info) return 0;
+    return static_cast<lldb::SBLaunchInfo*>(info)->GetLaunchFlags();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1259,45 +5161,40 @@ lldb_process_t lldb_target_attach_to_process_with_name(lldb_target_t target,
     }
 }
 
-lldb_process_t lldb_target_attach_with_info(lldb_target_t target,
-                                             lldb_attach_info_t attach_info,
-                                             lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_launch_info_set_launch_flags(lldb_launch_info_t info, uint32_t flags)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target || !attach_info) return nullptr;
-
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBAttachInfo* info = static_cast<lldb::SBAttachInfo*>(attach_info);
-    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
-    lldb::SBError local_error;
-    lldb::SBProcess process = t->Attach(*info, err ? *err : local_error);
-
-    if (!process.IsValid()) return nullptr;
-    return static_cast<lldb_process_t>(new lldb::SBProcess(process));
+    if (!info) return;
+    static_cast<lldb::SBLaunchInfo*>(info)->SetLaunchFlags(flags);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-lldb_breakpoint_t lldb_target_breakpoint_create_by_name(lldb_target_t target,
-                                                         const char* symbol_name,
-                                                         const char* module_name)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_launch_info_set_arguments(lldb_launch_info_t info, const char** argv, int append)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target || !symbol_name) return nullptr;
-
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBBreakpoint bp = t->BreakpointCreateByName(symbol_name, module_name);
+    if (!info) return;
+    static_cast<lldb::SBLaunchInfo*>(info)->SetArguments(argv, append != 0);
 
-    if (!bp.IsValid()) return nullptr;
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+    }
+}
 
-    return static_cast<lldb_breakpoint_t>(new lldb::SBBreakpoint(bp));
+lldb_file_spec_t lldb_launch_info_get_executable_file(lldb_launch_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!info) return nullptr;
+    lldb::SBFileSpec file = static_cast<lldb::SBLaunchInfo*>(info)->GetExecutableFile();
+    if (!file.IsValid()) return nullptr;
+    return static_cast<lldb_file_spec_t>(new lldb::SBFileSpec(file));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1311,42 +5208,29 @@ lldb_breakpoint_t lldb_target_breakpoint_create_by_name(lldb_target_t target,
     }
 }
 
-lldb_breakpoint_t lldb_target_breakpoint_create_by_location(lldb_target_t target,
-                                                             const char* file,
-                                                             uint32_t line)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_launch_info_set_executable_file(lldb_launch_info_t info,
+                                           lldb_file_spec_t file_spec,
+                                           int add_as_first_arg)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target || !file) return nullptr;
-
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBBreakpoint bp = t->BreakpointCreateByLocation(file, line);
-
-    if (!bp.IsValid()) return nullptr;
-
-    return static_cast<lldb_breakpoint_t>(new lldb::SBBreakpoint(bp));
+    if (!info || !file_spec) return;
+    static_cast<lldb::SBLaunchInfo*>(info)->SetExecutableFile(
+        *static_cast<lldb::SBFileSpec*>(file_spec), add_as_first_arg != 0);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-lldb_breakpoint_t lldb_target_breakpoint_create_by_address(lldb_target_t target,
-                                                            uint64_t address)  LLDB_WRAPPER_NOEXCEPT {
+lldb_listener_t lldb_launch_info_get_listener(lldb_launch_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return nullptr;
-
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBBreakpoint bp = t->BreakpointCreateByAddress(address);
-
-    if (!bp.IsValid()) return nullptr;
-
-    return static_cast<lldb_breakpoint_t>(new lldb::SBBreakpoint(bp));
+    if (!info) return nullptr;
+    lldb::SBListener listener = static_cast<lldb::SBLaunchInfo*>(info)->GetListener();
+    if (!listener.IsValid()) return nullptr;
+    return static_cast<lldb_listener_t>(new lldb::SBListener(listener));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1360,48 +5244,25 @@ lldb_breakpoint_t lldb_target_breakpoint_create_by_address(lldb_target_t target,
     }
 }
 
-lldb_breakpoint_t lldb_target_breakpoint_create_by_regex(lldb_target_t target,
-                                                          const char* symbol_regex,
-                                                          const char* module_name)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_launch_info_set_listener(lldb_launch_info_t info, lldb_listener_t listener)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target || !symbol_regex) return nullptr;
-
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBBreakpoint bp = t->BreakpointCreateByRegex(symbol_regex, module_name);
-
-    if (!bp.IsValid()) return nullptr;
-
-    return static_cast<lldb_breakpoint_t>(new lldb::SBBreakpoint(bp));
+    if (!info || !listener) return;
+    static_cast<lldb::SBLaunchInfo*>(info)->SetListener(
+        *static_cast<lldb::SBListener*>(listener));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-lldb_breakpoint_t lldb_target_breakpoint_create_by_source_regex(lldb_target_t target,
-                                                                 const char* source_regex,
-                                                                 const char* source_file)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_launch_info_get_process_plugin_name(lldb_launch_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target || !source_regex) return nullptr;
-
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBFileSpecList module_list;
-    lldb::SBFileSpecList source_list;
-    if (source_file) {
-        source_list.Append(lldb::SBFileSpec(source_file));
-    }
-    lldb::SBBreakpoint bp = t->BreakpointCreateBySourceRegex(source_regex, module_list, source_list);
-
-    if (!bp.IsValid()) return nullptr;
-
-    return static_cast<lldb_breakpoint_t>(new lldb::SBBreakpoint(bp));
+    if (!info) return nullptr;
+    return static_cast<lldb::SBLaunchInfo*>(info)->GetProcessPluginName();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1415,27 +5276,24 @@ lldb_breakpoint_t lldb_target_breakpoint_create_by_source_regex(lldb_target_t ta
     }
 }
 
-int lldb_target_delete_breakpoint(lldb_target_t target, int32_t breakpoint_id)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_launch_info_set_process_plugin_name(lldb_launch_info_t info, const char* name)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return 0;
-    return static_cast<lldb::SBTarget*>(target)->BreakpointDelete(breakpoint_id) ? 1 : 0;
+    if (!info || !name) return;
+    static_cast<lldb::SBLaunchInfo*>(info)->SetProcessPluginName(name);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-int lldb_target_delete_all_breakpoints(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_launch_info_get_shell(lldb_launch_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return 0;
-    return static_cast<lldb::SBTarget*>(target)->DeleteAllBreakpoints() ? 1 : 0;
+    if (!info) return nullptr;
+    return static_cast<lldb::SBLaunchInfo*>(info)->GetShell();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1449,27 +5307,23 @@ int lldb_target_delete_all_breakpoints(lldb_target_t target)  LLDB_WRAPPER_NOEXC
     }
 }
 
-int lldb_target_enable_all_breakpoints(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_launch_info_set_shell(lldb_launch_info_t info, const char* path)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return 0;
-    return static_cast<lldb::SBTarget*>(target)->EnableAllBreakpoints() ? 1 : 0;
+    if (!info || !path) return;
+    static_cast<lldb::SBLaunchInfo*>(info)->SetShell(path);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-int lldb_target_disable_all_breakpoints(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_launch_info_add_close_file_action(lldb_launch_info_t info, int fd)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return 0;
-    return static_cast<lldb::SBTarget*>(target)->DisableAllBreakpoints() ? 1 : 0;
+    return info && static_cast<lldb::SBLaunchInfo*>(info)->AddCloseFileAction(fd) ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1483,16 +5337,9 @@ int lldb_target_disable_all_breakpoints(lldb_target_t target)  LLDB_WRAPPER_NOEX
     }
 }
 
-lldb_breakpoint_t lldb_target_find_breakpoint_by_id(lldb_target_t target, int32_t id)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_launch_info_add_duplicate_file_action(lldb_launch_info_t info, int fd, int dup_fd)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return nullptr;
-
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBBreakpoint bp = t->FindBreakpointByID(id);
-
-    if (!bp.IsValid()) return nullptr;
-
-    return static_cast<lldb_breakpoint_t>(new lldb::SBBreakpoint(bp));
+    return info && static_cast<lldb::SBLaunchInfo*>(info)->AddDuplicateFileAction(fd, dup_fd) ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1506,10 +5353,16 @@ lldb_breakpoint_t lldb_target_find_breakpoint_by_id(lldb_target_t target, int32_
     }
 }
 
-uint32_t lldb_target_get_num_breakpoints(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_launch_info_add_open_file_action(lldb_launch_info_t info,
+                                          int fd,
+                                          const char* path,
+                                          int read,
+                                          int write)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return 0;
-    return static_cast<lldb::SBTarget*>(target)->GetNumBreakpoints();
+    return info && path && static_cast<lldb::SBLaunchInfo*>(info)->AddOpenFileAction(
+                               fd, path, read != 0, write != 0)
+               ? 1
+               : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1523,16 +5376,15 @@ uint32_t lldb_target_get_num_breakpoints(lldb_target_t target)  LLDB_WRAPPER_NOE
     }
 }
 
-lldb_breakpoint_t lldb_target_get_breakpoint_at_index(lldb_target_t target, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_launch_info_add_suppress_file_action(lldb_launch_info_t info,
+                                              int fd,
+                                              int read,
+                                              int write)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return nullptr;
-
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBBreakpoint bp = t->GetBreakpointAtIndex(index);
-
-    if (!bp.IsValid()) return nullptr;
-
-    return static_cast<lldb_breakpoint_t>(new lldb::SBBreakpoint(bp));
+    return info && static_cast<lldb::SBLaunchInfo*>(info)->AddSuppressFileAction(
+                               fd, read != 0, write != 0)
+               ? 1
+               : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1546,16 +5398,15 @@ lldb_breakpoint_t lldb_target_get_breakpoint_at_index(lldb_target_t target, uint
     }
 }
 
-lldb_process_t lldb_target_get_process(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
-    try {
-    if (!target) return nullptr;
-
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBProcess process = t->GetProcess();
-
-    if (!process.IsValid()) return nullptr;
+// ============================================================================
+// SBAttachInfo
+// ============================================================================
 
-    return static_cast<lldb_process_t>(new lldb::SBProcess(process));
+lldb_attach_info_t lldb_attach_info_create(uint64_t pid)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    lldb::SBAttachInfo info;
+    if (pid != 0) info.SetProcessID(pid);
+    return static_cast<lldb_attach_info_t>(new lldb::SBAttachInfo(info));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1569,41 +5420,22 @@ lldb_process_t lldb_target_get_process(lldb_target_t target)  LLDB_WRAPPER_NOEXC
     }
 }
 
-const char* lldb_target_get_executable_path(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_attach_info_destroy(lldb_attach_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return nullptr;
-
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBFileSpec spec = t->GetExecutable();
-
-    if (!spec.IsValid()) return nullptr;
-
-    if (wrapper_copy_file_spec_path(spec, g_temp_string)) {
-        return g_temp_string.c_str();
-    }
-
-    return nullptr;
+    if (info) delete static_cast<lldb::SBAttachInfo*>(info);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-lldb_file_spec_t lldb_target_get_executable_file(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+uint64_t lldb_attach_info_get_process_id(lldb_attach_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return nullptr;
-
-    lldb::SBFileSpec spec = static_cast<lldb::SBTarget*>(target)->GetExecutable();
-    if (!spec.IsValid()) return nullptr;
-
-    return static_cast<lldb_file_spec_t>(new lldb::SBFileSpec(spec));
+    return info ? static_cast<lldb::SBAttachInfo*>(info)->GetProcessID() : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1617,80 +5449,51 @@ lldb_file_spec_t lldb_target_get_executable_file(lldb_target_t target)  LLDB_WRA
     }
 }
 
-uint32_t lldb_target_get_num_modules(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_attach_info_set_process_id(lldb_attach_info_t info, uint64_t pid)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return 0;
-    return static_cast<lldb::SBTarget*>(target)->GetNumModules();
+    if (info) static_cast<lldb::SBAttachInfo*>(info)->SetProcessID(pid);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-lldb_module_t lldb_target_get_module_at_index(lldb_target_t target, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_attach_info_set_executable(lldb_attach_info_t info, const char* path)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return nullptr;
-
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBModule module = t->GetModuleAtIndex(index);
-
-    if (!module.IsValid()) return nullptr;
-
-    return static_cast<lldb_module_t>(new lldb::SBModule(module));
+    if (info && path) static_cast<lldb::SBAttachInfo*>(info)->SetExecutable(path);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-lldb_value_t lldb_target_evaluate_expression(lldb_target_t target, const char* expr)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_attach_info_set_executable_file(lldb_attach_info_t info, lldb_file_spec_t file_spec)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target || !expr) return nullptr;
-
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBValue value = t->EvaluateExpression(expr);
-
-    if (!value.IsValid()) return nullptr;
-
-    return static_cast<lldb_value_t>(new lldb::SBValue(value));
+    if (info && file_spec) {
+        static_cast<lldb::SBAttachInfo*>(info)->SetExecutable(
+            *static_cast<lldb::SBFileSpec*>(file_spec));
+    }
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-lldb_value_t lldb_target_evaluate_expression_with_options(lldb_target_t target,
-                                                          const char* expr,
-                                                          lldb_expression_options_t options)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_attach_info_get_wait_for_launch(lldb_attach_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target || !expr || !options) return nullptr;
-
-    lldb::SBValue value = static_cast<lldb::SBTarget*>(target)->EvaluateExpression(
-        expr, *static_cast<lldb::SBExpressionOptions*>(options));
-    if (!value.IsValid()) return nullptr;
-
-    return static_cast<lldb_value_t>(new lldb::SBValue(value));
+    return info && static_cast<lldb::SBAttachInfo*>(info)->GetWaitForLaunch() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1704,33 +5507,22 @@ lldb_value_t lldb_target_evaluate_expression_with_options(lldb_target_t target,
     }
 }
 
-size_t lldb_target_read_memory(lldb_target_t target, uint64_t addr, void* buf, size_t size, lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_attach_info_set_wait_for_launch(lldb_attach_info_t info, int wait_for)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target || !buf) return 0;
-
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
-    lldb::SBError local_error;
-    lldb::SBAddress sb_addr(addr, *t);
-
-    return t->ReadMemory(sb_addr, buf, size, err ? *err : local_error);
+    if (info) static_cast<lldb::SBAttachInfo*>(info)->SetWaitForLaunch(wait_for != 0);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-uint32_t lldb_target_get_address_byte_size(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_attach_info_get_ignore_existing(lldb_attach_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return 0;
-    return static_cast<lldb::SBTarget*>(target)->GetAddressByteSize();
+    return info && static_cast<lldb::SBAttachInfo*>(info)->GetIgnoreExisting() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1744,36 +5536,22 @@ uint32_t lldb_target_get_address_byte_size(lldb_target_t target)  LLDB_WRAPPER_N
     }
 }
 
-const char* lldb_target_get_triple(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_attach_info_set_ignore_existing(lldb_attach_info_t info, int ignore_existing)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return nullptr;
-    return static_cast<lldb::SBTarget*>(target)->GetTriple();
+    if (info) static_cast<lldb::SBAttachInfo*>(info)->SetIgnoreExisting(ignore_existing != 0);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-lldb_watchpoint_t lldb_target_watch_address(lldb_target_t target, uint64_t addr, size_t size, int read, int write, lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
-    try {
-    if (!target) return nullptr;
-
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
-    lldb::SBError local_error;
-
-    lldb::SBWatchpoint wp = t->WatchAddress(addr, size, read != 0, write != 0, err ? *err : local_error);
-
-    if (!wp.IsValid()) return nullptr;
-
-    return static_cast<lldb_watchpoint_t>(new lldb::SBWatchpoint(wp));
+uint32_t lldb_attach_info_get_resume_count(lldb_attach_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    return info ? static_cast<lldb::SBAttachInfo*>(info)->GetResumeCount() : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1787,27 +5565,23 @@ lldb_watchpoint_t lldb_target_watch_address(lldb_target_t target, uint64_t addr,
     }
 }
 
-int lldb_target_delete_watchpoint(lldb_target_t target, int32_t watchpoint_id)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_attach_info_set_resume_count(lldb_attach_info_t info, uint32_t count)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return 0;
-    return static_cast<lldb::SBTarget*>(target)->DeleteWatchpoint(watchpoint_id) ? 1 : 0;
+    if (info) static_cast<lldb::SBAttachInfo*>(info)->SetResumeCount(count);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-int lldb_target_delete_all_watchpoints(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_attach_info_get_process_plugin_name(lldb_attach_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return 0;
-    return static_cast<lldb::SBTarget*>(target)->DeleteAllWatchpoints() ? 1 : 0;
+    if (!info) return nullptr;
+    return static_cast<lldb::SBAttachInfo*>(info)->GetProcessPluginName();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1821,33 +5595,25 @@ int lldb_target_delete_all_watchpoints(lldb_target_t target)  LLDB_WRAPPER_NOEXC
     }
 }
 
-lldb_watchpoint_t lldb_target_find_watchpoint_by_id(lldb_target_t target, int32_t id)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_attach_info_set_process_plugin_name(lldb_attach_info_t info, const char* name)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return nullptr;
-
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBWatchpoint wp = t->FindWatchpointByID(id);
-
-    if (!wp.IsValid()) return nullptr;
-
-    return static_cast<lldb_watchpoint_t>(new lldb::SBWatchpoint(wp));
+    if (info && name) static_cast<lldb::SBAttachInfo*>(info)->SetProcessPluginName(name);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-uint32_t lldb_target_get_num_watchpoints(lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+lldb_listener_t lldb_attach_info_get_listener(lldb_attach_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return 0;
-    return static_cast<lldb::SBTarget*>(target)->GetNumWatchpoints();
+    if (!info) return nullptr;
+    lldb::SBListener listener = static_cast<lldb::SBAttachInfo*>(info)->GetListener();
+    if (!listener.IsValid()) return nullptr;
+    return static_cast<lldb_listener_t>(new lldb::SBListener(listener));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1861,36 +5627,29 @@ uint32_t lldb_target_get_num_watchpoints(lldb_target_t target)  LLDB_WRAPPER_NOE
     }
 }
 
-lldb_watchpoint_t lldb_target_get_watchpoint_at_index(lldb_target_t target, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_attach_info_set_listener(lldb_attach_info_t info, lldb_listener_t listener)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return nullptr;
-
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBWatchpoint wp = t->GetWatchpointAtIndex(index);
-
-    if (!wp.IsValid()) return nullptr;
-
-    return static_cast<lldb_watchpoint_t>(new lldb::SBWatchpoint(wp));
+    if (info && listener) {
+        static_cast<lldb::SBAttachInfo*>(info)->SetListener(
+            *static_cast<lldb::SBListener*>(listener));
+    }
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
 // ============================================================================
-// SBLaunchInfo
+// SBExpressionOptions
 // ============================================================================
 
-lldb_launch_info_t lldb_launch_info_create(const char** argv)  LLDB_WRAPPER_NOEXCEPT {
+lldb_expression_options_t lldb_expression_options_create(void)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return static_cast<lldb_launch_info_t>(new lldb::SBLaunchInfo(argv));
+    return static_cast<lldb_expression_options_t>(new lldb::SBExpressionOptions());
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1904,11 +5663,9 @@ lldb_launch_info_t lldb_launch_info_create(const char** argv)  LLDB_WRAPPER_NOEX
     }
 }
 
-void lldb_launch_info_destroy(lldb_launch_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_expression_options_destroy(lldb_expression_options_t options)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (info) {
-        delete static_cast<lldb::SBLaunchInfo*>(info);
-    }
+    if (options) delete static_cast<lldb::SBExpressionOptions*>(options);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1919,9 +5676,9 @@ void lldb_launch_info_destroy(lldb_launch_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-uint32_t lldb_launch_info_get_num_arguments(lldb_launch_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_expression_options_get_timeout(lldb_expression_options_t options)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return info ? static_cast<lldb::SBLaunchInfo*>(info)->GetNumArguments() : 0;
+    return options ? static_cast<lldb::SBExpressionOptions*>(options)->GetTimeoutInMicroSeconds() : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1935,10 +5692,22 @@ uint32_t lldb_launch_info_get_num_arguments(lldb_launch_info_t info)  LLDB_WRAPP
     }
 }
 
-const char* lldb_launch_info_get_argument_at_index(lldb_launch_info_t info, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_expression_options_set_timeout(lldb_expression_options_t options, uint32_t timeout)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return nullptr;
-    return static_cast<lldb::SBLaunchInfo*>(info)->GetArgumentAtIndex(index);
+    if (options) static_cast<lldb::SBExpressionOptions*>(options)->SetTimeoutInMicroSeconds(timeout);
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+    }
+}
+
+int lldb_expression_options_get_unwind_on_error(lldb_expression_options_t options)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    return options && static_cast<lldb::SBExpressionOptions*>(options)->GetUnwindOnError() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1952,10 +5721,9 @@ const char* lldb_launch_info_get_argument_at_index(lldb_launch_info_t info, uint
     }
 }
 
-void lldb_launch_info_set_working_directory(lldb_launch_info_t info, const char* dir)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_expression_options_set_unwind_on_error(lldb_expression_options_t options, int value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return;
-    static_cast<lldb::SBLaunchInfo*>(info)->SetWorkingDirectory(dir);
+    if (options) static_cast<lldb::SBExpressionOptions*>(options)->SetUnwindOnError(value != 0);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1966,10 +5734,9 @@ void lldb_launch_info_set_working_directory(lldb_launch_info_t info, const char*
     }
 }
 
-const char* lldb_launch_info_get_working_directory(lldb_launch_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_expression_options_get_ignore_breakpoints(lldb_expression_options_t options)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return nullptr;
-    return static_cast<lldb::SBLaunchInfo*>(info)->GetWorkingDirectory();
+    return options && static_cast<lldb::SBExpressionOptions*>(options)->GetIgnoreBreakpoints() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -1983,24 +5750,9 @@ const char* lldb_launch_info_get_working_directory(lldb_launch_info_t info)  LLD
     }
 }
 
-void lldb_launch_info_set_environment_entries(lldb_launch_info_t info,
-                                               const char** envp,
-                                               int append)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_expression_options_set_ignore_breakpoints(lldb_expression_options_t options, int value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return;
-    lldb::SBEnvironment env;
-    if (envp) {
-        for (const char** e = envp; *e != nullptr; ++e) {
-            std::string entry(*e);
-            size_t pos = entry.find('=');
-            if (pos != std::string::npos) {
-                env.Set(entry.substr(0, pos).c_str(),
-                       entry.substr(pos + 1).c_str(),
-                       true);
-            }
-        }
-    }
-    static_cast<lldb::SBLaunchInfo*>(info)->SetEnvironment(env, append != 0);
+    if (options) static_cast<lldb::SBExpressionOptions*>(options)->SetIgnoreBreakpoints(value != 0);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2011,9 +5763,9 @@ void lldb_launch_info_set_environment_entries(lldb_launch_info_t info,
     }
 }
 
-uint32_t lldb_launch_info_get_num_environment_entries(lldb_launch_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_expression_options_get_fetch_dynamic_value(lldb_expression_options_t options)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return info ? static_cast<lldb::SBLaunchInfo*>(info)->GetNumEnvironmentEntries() : 0;
+    return options ? static_cast<int>(static_cast<lldb::SBExpressionOptions*>(options)->GetFetchDynamicValue()) : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2027,28 +5779,25 @@ uint32_t lldb_launch_info_get_num_environment_entries(lldb_launch_info_t info)
     }
 }
 
-const char* lldb_launch_info_get_environment_entry_at_index(lldb_launch_info_t info,
-                                                             uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_expression_options_set_fetch_dynamic_value(lldb_expression_options_t options, int value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return nullptr;
-    return static_cast<lldb::SBLaunchInfo*>(info)->GetEnvironmentEntryAtIndex(index);
+    if (options) {
+        static_cast<lldb::SBExpressionOptions*>(options)->SetFetchDynamicValue(
+            static_cast<lldb::DynamicValueType>(value));
+    }
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-uint32_t lldb_launch_info_get_launch_flags(lldb_launch_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_expression_options_get_try_all_threads(lldb_expression_options_t options)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return 0;
-    return static_cast<lldb::SBLaunchInfo*>(info)->GetLaunchFlags();
+    return options && static_cast<lldb::SBExpressionOptions*>(options)->GetTryAllThreads() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2062,10 +5811,9 @@ uint32_t lldb_launch_info_get_launch_flags(lldb_launch_info_t info)  LLDB_WRAPPE
     }
 }
 
-void lldb_launch_info_set_launch_flags(lldb_launch_info_t info, uint32_t flags)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_expression_options_set_try_all_threads(lldb_expression_options_t options, int value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return;
-    static_cast<lldb::SBLaunchInfo*>(info)->SetLaunchFlags(flags);
+    if (options) static_cast<lldb::SBExpressionOptions*>(options)->SetTryAllThreads(value != 0);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2076,46 +5824,41 @@ void lldb_launch_info_set_launch_flags(lldb_launch_info_t info, uint32_t flags)
     }
 }
 
-void lldb_launch_info_set_arguments(lldb_launch_info_t info, const char** argv, int append)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_expression_options_get_stop_others(lldb_expression_options_t options)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return;
-    static_cast<lldb::SBLaunchInfo*>(info)->SetArguments(argv, append != 0);
+    return options && static_cast<lldb::SBExpressionOptions*>(options)->GetStopOthers() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-lldb_file_spec_t lldb_launch_info_get_executable_file(lldb_launch_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_expression_options_set_stop_others(lldb_expression_options_t options, int value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return nullptr;
-    lldb::SBFileSpec file = static_cast<lldb::SBLaunchInfo*>(info)->GetExecutableFile();
-    if (!file.IsValid()) return nullptr;
-    return static_cast<lldb_file_spec_t>(new lldb::SBFileSpec(file));
+    if (options) static_cast<lldb::SBExpressionOptions*>(options)->SetStopOthers(value != 0);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-void lldb_launch_info_set_executable_file(lldb_launch_info_t info,
-                                           lldb_file_spec_t file_spec,
-                                           int add_as_first_arg)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_expression_options_set_language(lldb_expression_options_t options, int value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info || !file_spec) return;
-    static_cast<lldb::SBLaunchInfo*>(info)->SetExecutableFile(
-        *static_cast<lldb::SBFileSpec*>(file_spec), add_as_first_arg != 0);
+    if (options) {
+        static_cast<lldb::SBExpressionOptions*>(options)->SetLanguage(
+            static_cast<lldb::LanguageType>(value));
+    }
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2126,12 +5869,9 @@ void lldb_launch_info_set_executable_file(lldb_launch_info_t info,
     }
 }
 
-lldb_listener_t lldb_launch_info_get_listener(lldb_launch_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_expression_options_get_suppress_persistent_result(lldb_expression_options_t options)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return nullptr;
-    lldb::SBListener listener = static_cast<lldb::SBLaunchInfo*>(info)->GetListener();
-    if (!listener.IsValid()) return nullptr;
-    return static_cast<lldb_listener_t>(new lldb::SBListener(listener));
+    return options && static_cast<lldb::SBExpressionOptions*>(options)->GetSuppressPersistentResult() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2145,11 +5885,11 @@ lldb_listener_t lldb_launch_info_get_listener(lldb_launch_info_t info)  LLDB_WRA
     }
 }
 
-void lldb_launch_info_set_listener(lldb_launch_info_t info, lldb_listener_t listener)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_expression_options_set_suppress_persistent_result(lldb_expression_options_t options, int value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info || !listener) return;
-    static_cast<lldb::SBLaunchInfo*>(info)->SetListener(
-        *static_cast<lldb::SBListener*>(listener));
+    if (options) {
+        static_cast<lldb::SBExpressionOptions*>(options)->SetSuppressPersistentResult(value != 0);
+    }
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2160,10 +5900,16 @@ void lldb_launch_info_set_listener(lldb_launch_info_t info, lldb_listener_t list
     }
 }
 
-const char* lldb_launch_info_get_process_plugin_name(lldb_launch_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+// ============================================================================
+// SBFileSpec
+// ============================================================================
+
+lldb_file_spec_t lldb_file_spec_create(const char* path, int resolve)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return nullptr;
-    return static_cast<lldb::SBLaunchInfo*>(info)->GetProcessPluginName();
+    if (path) {
+        return static_cast<lldb_file_spec_t>(new lldb::SBFileSpec(path, resolve != 0));
+    }
+    return static_cast<lldb_file_spec_t>(new lldb::SBFileSpec());
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2177,10 +5923,11 @@ const char* lldb_launch_info_get_process_plugin_name(lldb_launch_info_t info)  L
     }
 }
 
-void lldb_launch_info_set_process_plugin_name(lldb_launch_info_t info, const char* name)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_file_spec_destroy(lldb_file_spec_t file_spec)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info || !name) return;
-    static_cast<lldb::SBLaunchInfo*>(info)->SetProcessPluginName(name);
+    if (file_spec) {
+        delete static_cast<lldb::SBFileSpec*>(file_spec);
+    }
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2191,10 +5938,10 @@ void lldb_launch_info_set_process_plugin_name(lldb_launch_info_t info, const cha
     }
 }
 
-const char* lldb_launch_info_get_shell(lldb_launch_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_file_spec_is_valid(lldb_file_spec_t file_spec)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return nullptr;
-    return static_cast<lldb::SBLaunchInfo*>(info)->GetShell();
+    if (!file_spec) return 0;
+    return static_cast<lldb::SBFileSpec*>(file_spec)->IsValid() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2208,23 +5955,44 @@ const char* lldb_launch_info_get_shell(lldb_launch_info_t info)  LLDB_WRAPPER_NO
     }
 }
 
-void lldb_launch_info_set_shell(lldb_launch_info_t info, const char* path)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_file_spec_exists(lldb_file_spec_t file_spec)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info || !path) return;
-    static_cast<lldb::SBLaunchInfo*>(info)->SetShell(path);
+    if (!file_spec) return 0;
+    return static_cast<lldb::SBFileSpec*>(file_spec)->Exists() ? 1 : 0;
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+const char* lldb_file_spec_get_filename(lldb_file_spec_t file_spec)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!file_spec) return nullptr;
+    return static_cast<lldb::SBFileSpec*>(file_spec)->GetFilename();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-int lldb_launch_info_add_close_file_action(lldb_launch_info_t info, int fd)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_file_spec_get_directory(lldb_file_spec_t file_spec)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return info && static_cast<lldb::SBLaunchInfo*>(info)->AddCloseFileAction(fd) ? 1 : 0;
+    if (!file_spec) return nullptr;
+    return static_cast<lldb::SBFileSpec*>(file_spec)->GetDirectory();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2238,9 +6006,10 @@ int lldb_launch_info_add_close_file_action(lldb_launch_info_t info, int fd)  LLD
     }
 }
 
-int lldb_launch_info_add_duplicate_file_action(lldb_launch_info_t info, int fd, int dup_fd)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_file_spec_get_path(lldb_file_spec_t file_spec, char* buffer, size_t length)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return info && static_cast<lldb::SBLaunchInfo*>(info)->AddDuplicateFileAction(fd, dup_fd) ? 1 : 0;
+    if (!file_spec) return 0;
+    return static_cast<lldb::SBFileSpec*>(file_spec)->GetPath(buffer, length);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2254,60 +6023,41 @@ int lldb_launch_info_add_duplicate_file_action(lldb_launch_info_t info, int fd,
     }
 }
 
-int lldb_launch_info_add_open_file_action(lldb_launch_info_t info,
-                                          int fd,
-                                          const char* path,
-                                          int read,
-                                          int write)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_file_spec_set_filename(lldb_file_spec_t file_spec, const char* filename)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return info && path && static_cast<lldb::SBLaunchInfo*>(info)->AddOpenFileAction(
-                               fd, path, read != 0, write != 0)
-               ? 1
-               : 0;
+    if (!file_spec || !filename) return;
+    static_cast<lldb::SBFileSpec*>(file_spec)->SetFilename(filename);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-int lldb_launch_info_add_suppress_file_action(lldb_launch_info_t info,
-                                              int fd,
-                                              int read,
-                                              int write)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_file_spec_set_directory(lldb_file_spec_t file_spec, const char* directory)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return info && static_cast<lldb::SBLaunchInfo*>(info)->AddSuppressFileAction(
-                               fd, read != 0, write != 0)
-               ? 1
-               : 0;
+    if (!file_spec || !directory) return;
+    static_cast<lldb::SBFileSpec*>(file_spec)->SetDirectory(directory);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
 // ============================================================================
-// SBAttachInfo
+// SBFileSpecList
 // ============================================================================
 
-lldb_attach_info_t lldb_attach_info_create(uint64_t pid)  LLDB_WRAPPER_NOEXCEPT {
+lldb_file_spec_list_t lldb_file_spec_list_create(void)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    lldb::SBAttachInfo info;
-    if (pid != 0) info.SetProcessID(pid);
-    return static_cast<lldb_attach_info_t>(new lldb::SBAttachInfo(info));
+    return static_cast<lldb_file_spec_list_t>(new lldb::SBFileSpecList());
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2321,9 +6071,9 @@ lldb_attach_info_t lldb_attach_info_create(uint64_t pid)  LLDB_WRAPPER_NOEXCEPT
     }
 }
 
-void lldb_attach_info_destroy(lldb_attach_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_file_spec_list_destroy(lldb_file_spec_list_t list)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (info) delete static_cast<lldb::SBAttachInfo*>(info);
+    if (list) delete static_cast<lldb::SBFileSpecList*>(list);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2334,9 +6084,9 @@ void lldb_attach_info_destroy(lldb_attach_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-uint64_t lldb_attach_info_get_process_id(lldb_attach_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_file_spec_list_is_valid(lldb_file_spec_list_t list)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return info ? static_cast<lldb::SBAttachInfo*>(info)->GetProcessID() : 0;
+    return list ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2350,22 +6100,28 @@ uint64_t lldb_attach_info_get_process_id(lldb_attach_info_t info)  LLDB_WRAPPER_
     }
 }
 
-void lldb_attach_info_set_process_id(lldb_attach_info_t info, uint64_t pid)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_file_spec_list_get_size(lldb_file_spec_list_t list)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (info) static_cast<lldb::SBAttachInfo*>(info)->SetProcessID(pid);
+    if (!list) return 0;
+    return static_cast<lldb::SBFileSpecList*>(list)->GetSize();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-void lldb_attach_info_set_executable(lldb_attach_info_t info, const char* path)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_file_spec_list_append(lldb_file_spec_list_t list, lldb_file_spec_t file_spec)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (info && path) static_cast<lldb::SBAttachInfo*>(info)->SetExecutable(path);
+    if (!list || !file_spec) return;
+    static_cast<lldb::SBFileSpecList*>(list)->Append(
+        *static_cast<lldb::SBFileSpec*>(file_spec));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2376,54 +6132,68 @@ void lldb_attach_info_set_executable(lldb_attach_info_t info, const char* path)
     }
 }
 
-void lldb_attach_info_set_executable_file(lldb_attach_info_t info, lldb_file_spec_t file_spec)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_file_spec_list_append_if_unique(lldb_file_spec_list_t list,
+                                         lldb_file_spec_t file_spec)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (info && file_spec) {
-        static_cast<lldb::SBAttachInfo*>(info)->SetExecutable(
-            *static_cast<lldb::SBFileSpec*>(file_spec));
-    }
+    if (!list || !file_spec) return 0;
+    return static_cast<lldb::SBFileSpecList*>(list)->AppendIfUnique(
+               *static_cast<lldb::SBFileSpec*>(file_spec))
+               ? 1
+               : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-int lldb_attach_info_get_wait_for_launch(lldb_attach_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_file_spec_list_clear(lldb_file_spec_list_t list)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return info && static_cast<lldb::SBAttachInfo*>(info)->GetWaitForLaunch() ? 1 : 0;
+    if (list) static_cast<lldb::SBFileSpecList*>(list)->Clear();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-void lldb_attach_info_set_wait_for_launch(lldb_attach_info_t info, int wait_for)  LLDB_WRAPPER_NOEXCEPT {
+lldb_file_spec_t lldb_file_spec_list_get_file_spec_at_index(lldb_file_spec_list_t list,
+                                                             uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (info) static_cast<lldb::SBAttachInfo*>(info)->SetWaitForLaunch(wait_for != 0);
+    if (!list) return nullptr;
+    lldb::SBFileSpec file_spec =
+        static_cast<lldb::SBFileSpecList*>(list)->GetFileSpecAtIndex(index);
+    if (!file_spec.IsValid()) return nullptr;
+    return static_cast<lldb_file_spec_t>(new lldb::SBFileSpec(file_spec));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-int lldb_attach_info_get_ignore_existing(lldb_attach_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+// ============================================================================
+// SBAddress
+// ============================================================================
+
+lldb_address_t lldb_address_create(void)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return info && static_cast<lldb::SBAttachInfo*>(info)->GetIgnoreExisting() ? 1 : 0;
+    return static_cast<lldb_address_t>(new lldb::SBAddress());
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2437,52 +6207,58 @@ int lldb_attach_info_get_ignore_existing(lldb_attach_info_t info)  LLDB_WRAPPER_
     }
 }
 
-void lldb_attach_info_set_ignore_existing(lldb_attach_info_t info, int ignore_existing)  LLDB_WRAPPER_NOEXCEPT {
+lldb_address_t lldb_address_create_from_load_address(uint64_t address, lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (info) static_cast<lldb::SBAttachInfo*>(info)->SetIgnoreExisting(ignore_existing != 0);
+    if (!target) return nullptr;
+    return static_cast<lldb_address_t>(new lldb::SBAddress(
+        address, *static_cast<lldb::SBTarget*>(target)));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-uint32_t lldb_attach_info_get_resume_count(lldb_attach_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_address_destroy(lldb_address_t address)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return info ? static_cast<lldb::SBAttachInfo*>(info)->GetResumeCount() : 0;
+    if (address) delete static_cast<lldb::SBAddress*>(address);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-void lldb_attach_info_set_resume_count(lldb_attach_info_t info, uint32_t count)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_address_is_valid(lldb_address_t address)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (info) static_cast<lldb::SBAttachInfo*>(info)->SetResumeCount(count);
+    if (!address) return 0;
+    return static_cast<lldb::SBAddress*>(address)->IsValid() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-const char* lldb_attach_info_get_process_plugin_name(lldb_attach_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+uint64_t lldb_address_get_file_address(lldb_address_t address)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return nullptr;
-    return static_cast<lldb::SBAttachInfo*>(info)->GetProcessPluginName();
+    if (!address) return LLDB_INVALID_ADDRESS;
+    return static_cast<lldb::SBAddress*>(address)->GetFileAddress();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2496,25 +6272,28 @@ const char* lldb_attach_info_get_process_plugin_name(lldb_attach_info_t info)  L
     }
 }
 
-void lldb_attach_info_set_process_plugin_name(lldb_attach_info_t info, const char* name)  LLDB_WRAPPER_NOEXCEPT {
+uint64_t lldb_address_get_load_address(lldb_address_t address, lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (info && name) static_cast<lldb::SBAttachInfo*>(info)->SetProcessPluginName(name);
+    if (!address || !target) return LLDB_INVALID_ADDRESS;
+    return static_cast<lldb::SBAddress*>(address)->GetLoadAddress(
+        *static_cast<lldb::SBTarget*>(target));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-lldb_listener_t lldb_attach_info_get_listener(lldb_attach_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+uint64_t lldb_address_get_offset(lldb_address_t address)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return nullptr;
-    lldb::SBListener listener = static_cast<lldb::SBAttachInfo*>(info)->GetListener();
-    if (!listener.IsValid()) return nullptr;
-    return static_cast<lldb_listener_t>(new lldb::SBListener(listener));
+    if (!address) return 0;
+    return static_cast<lldb::SBAddress*>(address)->GetOffset();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2528,58 +6307,65 @@ lldb_listener_t lldb_attach_info_get_listener(lldb_attach_info_t info)  LLDB_WRA
     }
 }
 
-void lldb_attach_info_set_listener(lldb_attach_info_t info, lldb_listener_t listener)  LLDB_WRAPPER_NOEXCEPT {
+lldb_line_entry_t lldb_address_get_line_entry(lldb_address_t address)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (info && listener) {
-        static_cast<lldb::SBAttachInfo*>(info)->SetListener(
-            *static_cast<lldb::SBListener*>(listener));
-    }
+    if (!address) return nullptr;
+    lldb::SBLineEntry entry = static_cast<lldb::SBAddress*>(address)->GetLineEntry();
+    if (!entry.IsValid()) return nullptr;
+    return static_cast<lldb_line_entry_t>(new lldb::SBLineEntry(entry));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
 // ============================================================================
-// SBExpressionOptions
+// SBLineEntry
 // ============================================================================
 
-lldb_expression_options_t lldb_expression_options_create(void)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_line_entry_destroy(lldb_line_entry_t entry)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return static_cast<lldb_expression_options_t>(new lldb::SBExpressionOptions());
+    if (entry) delete static_cast<lldb::SBLineEntry*>(entry);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-void lldb_expression_options_destroy(lldb_expression_options_t options)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_line_entry_is_valid(lldb_line_entry_t entry)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (options) delete static_cast<lldb::SBExpressionOptions*>(options);
+    if (!entry) return 0;
+    return static_cast<lldb::SBLineEntry*>(entry)->IsValid() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-uint32_t lldb_expression_options_get_timeout(lldb_expression_options_t options)  LLDB_WRAPPER_NOEXCEPT {
+lldb_address_t lldb_line_entry_get_start_address(lldb_line_entry_t entry)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return options ? static_cast<lldb::SBExpressionOptions*>(options)->GetTimeoutInMicroSeconds() : 0;
+    if (!entry) return nullptr;
+    lldb::SBAddress address = static_cast<lldb::SBLineEntry*>(entry)->GetStartAddress();
+    if (!address.IsValid()) return nullptr;
+    return static_cast<lldb_address_t>(new lldb::SBAddress(address));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2593,22 +6379,31 @@ uint32_t lldb_expression_options_get_timeout(lldb_expression_options_t options)
     }
 }
 
-void lldb_expression_options_set_timeout(lldb_expression_options_t options, uint32_t timeout)  LLDB_WRAPPER_NOEXCEPT {
+lldb_address_t lldb_line_entry_get_end_address(lldb_line_entry_t entry)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (options) static_cast<lldb::SBExpressionOptions*>(options)->SetTimeoutInMicroSeconds(timeout);
+    if (!entry) return nullptr;
+    lldb::SBAddress address = static_cast<lldb::SBLineEntry*>(entry)->GetEndAddress();
+    if (!address.IsValid()) return nullptr;
+    return static_cast<lldb_address_t>(new lldb::SBAddress(address));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-int lldb_expression_options_get_unwind_on_error(lldb_expression_options_t options)  LLDB_WRAPPER_NOEXCEPT {
+lldb_file_spec_t lldb_line_entry_get_file_spec(lldb_line_entry_t entry)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return options && static_cast<lldb::SBExpressionOptions*>(options)->GetUnwindOnError() ? 1 : 0;
+    if (!entry) return nullptr;
+    lldb::SBFileSpec file_spec = static_cast<lldb::SBLineEntry*>(entry)->GetFileSpec();
+    if (!file_spec.IsValid()) return nullptr;
+    return static_cast<lldb_file_spec_t>(new lldb::SBFileSpec(file_spec));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2622,22 +6417,27 @@ int lldb_expression_options_get_unwind_on_error(lldb_expression_options_t option
     }
 }
 
-void lldb_expression_options_set_unwind_on_error(lldb_expression_options_t options, int value)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_line_entry_get_line(lldb_line_entry_t entry)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (options) static_cast<lldb::SBExpressionOptions*>(options)->SetUnwindOnError(value != 0);
+    if (!entry) return LLDB_INVALID_LINE_NUMBER;
+    return static_cast<lldb::SBLineEntry*>(entry)->GetLine();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-int lldb_expression_options_get_ignore_breakpoints(lldb_expression_options_t options)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_line_entry_get_column(lldb_line_entry_t entry)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return options && static_cast<lldb::SBExpressionOptions*>(options)->GetIgnoreBreakpoints() ? 1 : 0;
+    if (!entry) return 0;
+    return static_cast<lldb::SBLineEntry*>(entry)->GetColumn();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2651,9 +6451,15 @@ int lldb_expression_options_get_ignore_breakpoints(lldb_expression_options_t opt
     }
 }
 
-void lldb_expression_options_set_ignore_breakpoints(lldb_expression_options_t options, int value)  LLDB_WRAPPER_NOEXCEPT {
+// ============================================================================
+// SBProcess
+// ============================================================================
+
+void lldb_process_destroy(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (options) static_cast<lldb::SBExpressionOptions*>(options)->SetIgnoreBreakpoints(value != 0);
+    if (process) {
+        delete static_cast<lldb::SBProcess*>(process);
+    }
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2664,9 +6470,10 @@ void lldb_expression_options_set_ignore_breakpoints(lldb_expression_options_t op
     }
 }
 
-int lldb_expression_options_get_fetch_dynamic_value(lldb_expression_options_t options)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_process_is_valid(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return options ? static_cast<int>(static_cast<lldb::SBExpressionOptions*>(options)->GetFetchDynamicValue()) : 0;
+    if (!process) return 0;
+    return static_cast<lldb::SBProcess*>(process)->IsValid() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2680,137 +6487,179 @@ int lldb_expression_options_get_fetch_dynamic_value(lldb_expression_options_t op
     }
 }
 
-void lldb_expression_options_set_fetch_dynamic_value(lldb_expression_options_t options, int value)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_continue(lldb_process_t process, lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (options) {
-        static_cast<lldb::SBExpressionOptions*>(options)->SetFetchDynamicValue(
-            static_cast<lldb::DynamicValueType>(value));
+    wrapper_clear_error_state();
+    if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    try {
+        wrapper_cancel_prefetches(*static_cast<lldb::SBProcess*>(process));
+        lldb::SBError error = static_cast<lldb::SBProcess*>(process)->Continue();
+        return wrapper_status(error, output);
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception in process continue");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-int lldb_expression_options_get_try_all_threads(lldb_expression_options_t options)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_stop(lldb_process_t process, lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return options && static_cast<lldb::SBExpressionOptions*>(options)->GetTryAllThreads() ? 1 : 0;
-
-      } catch (const std::bad_alloc&) {
-        wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+    wrapper_clear_error_state();
+    if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    try {
+        lldb::SBError error = static_cast<lldb::SBProcess*>(process)->Stop();
+        return wrapper_status(error, output);
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
-        wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        wrapper_set_error_state("unknown native exception in process stop");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
-}
-
-void lldb_expression_options_set_try_all_threads(lldb_expression_options_t options, int value)  LLDB_WRAPPER_NOEXCEPT {
-    try {
-    if (options) static_cast<lldb::SBExpressionOptions*>(options)->SetTryAllThreads(value != 0);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-int lldb_expression_options_get_stop_others(lldb_expression_options_t options)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_kill(lldb_process_t process, lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return options && static_cast<lldb::SBExpressionOptions*>(options)->GetStopOthers() ? 1 : 0;
-
-      } catch (const std::bad_alloc&) {
-        wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+    wrapper_clear_error_state();
+    if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    try {
+        lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
+        wrapper_drop_page_cache(*p);
+        lldb::SBError error = p->Kill();
+        return wrapper_status(error, output);
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
-        wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        wrapper_set_error_state("unknown native exception in process kill");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
-}
-
-void lldb_expression_options_set_stop_others(lldb_expression_options_t options, int value)  LLDB_WRAPPER_NOEXCEPT {
-    try {
-    if (options) static_cast<lldb::SBExpressionOptions*>(options)->SetStopOthers(value != 0);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-void lldb_expression_options_set_language(lldb_expression_options_t options, int value)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_detach(lldb_process_t process, lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (options) {
-        static_cast<lldb::SBExpressionOptions*>(options)->SetLanguage(
-            static_cast<lldb::LanguageType>(value));
+    wrapper_clear_error_state();
+    if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    try {
+        lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
+        wrapper_drop_page_cache(*p);
+        lldb::SBError error = p->Detach();
+        return wrapper_status(error, output);
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception in process detach");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-int lldb_expression_options_get_suppress_persistent_result(lldb_expression_options_t options)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_destroy_process(lldb_process_t process, lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return options && static_cast<lldb::SBExpressionOptions*>(options)->GetSuppressPersistentResult() ? 1 : 0;
+    wrapper_clear_error_state();
+    if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    try {
+        lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
+        wrapper_drop_page_cache(*p);
+        lldb::SBError error = p->Destroy();
+        return wrapper_status(error, output);
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception in process destroy");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    }
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-void lldb_expression_options_set_suppress_persistent_result(lldb_expression_options_t options, int value)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_signal(lldb_process_t process, int signal, lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (options) {
-        static_cast<lldb::SBExpressionOptions*>(options)->SetSuppressPersistentResult(value != 0);
+    wrapper_clear_error_state();
+    if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    try {
+        lldb::SBError error = static_cast<lldb::SBProcess*>(process)->Signal(signal);
+        return wrapper_status(error, output);
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception in process signal");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-// ============================================================================
-// SBFileSpec
-// ============================================================================
-
-lldb_file_spec_t lldb_file_spec_create(const char* path, int resolve)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_process_get_state(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (path) {
-        return static_cast<lldb_file_spec_t>(new lldb::SBFileSpec(path, resolve != 0));
-    }
-    return static_cast<lldb_file_spec_t>(new lldb::SBFileSpec());
+    if (!process) return static_cast<int>(lldb::eStateInvalid);
+    return static_cast<int>(static_cast<lldb::SBProcess*>(process)->GetState());
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2824,25 +6673,33 @@ lldb_file_spec_t lldb_file_spec_create(const char* path, int resolve)  LLDB_WRAP
     }
 }
 
-void lldb_file_spec_destroy(lldb_file_spec_t file_spec)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_process_get_num_threads(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (file_spec) {
-        delete static_cast<lldb::SBFileSpec*>(file_spec);
-    }
+    if (!process) return 0;
+    return static_cast<lldb::SBProcess*>(process)->GetNumThreads();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-int lldb_file_spec_is_valid(lldb_file_spec_t file_spec)  LLDB_WRAPPER_NOEXCEPT {
+lldb_thread_t lldb_process_get_thread_at_index(lldb_process_t process, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!file_spec) return 0;
-    return static_cast<lldb::SBFileSpec*>(file_spec)->IsValid() ? 1 : 0;
+    if (!process) return nullptr;
+
+    lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
+    lldb::SBThread thread = p->GetThreadAtIndex(index);
+
+    if (!thread.IsValid()) return nullptr;
+
+    return static_cast<lldb_thread_t>(new lldb::SBThread(thread));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2856,10 +6713,16 @@ int lldb_file_spec_is_valid(lldb_file_spec_t file_spec)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-int lldb_file_spec_exists(lldb_file_spec_t file_spec)  LLDB_WRAPPER_NOEXCEPT {
+lldb_thread_t lldb_process_get_thread_by_id(lldb_process_t process, uint64_t tid)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!file_spec) return 0;
-    return static_cast<lldb::SBFileSpec*>(file_spec)->Exists() ? 1 : 0;
+    if (!process) return nullptr;
+
+    lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
+    lldb::SBThread thread = p->GetThreadByID(tid);
+
+    if (!thread.IsValid()) return nullptr;
+
+    return static_cast<lldb_thread_t>(new lldb::SBThread(thread));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2873,10 +6736,16 @@ int lldb_file_spec_exists(lldb_file_spec_t file_spec)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-const char* lldb_file_spec_get_filename(lldb_file_spec_t file_spec)  LLDB_WRAPPER_NOEXCEPT {
+lldb_thread_t lldb_process_get_thread_by_index_id(lldb_process_t process, uint32_t index_id)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!file_spec) return nullptr;
-    return static_cast<lldb::SBFileSpec*>(file_spec)->GetFilename();
+    if (!process) return nullptr;
+
+    lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
+    lldb::SBThread thread = p->GetThreadByIndexID(index_id);
+
+    if (!thread.IsValid()) return nullptr;
+
+    return static_cast<lldb_thread_t>(new lldb::SBThread(thread));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2890,10 +6759,16 @@ const char* lldb_file_spec_get_filename(lldb_file_spec_t file_spec)  LLDB_WRAPPE
     }
 }
 
-const char* lldb_file_spec_get_directory(lldb_file_spec_t file_spec)  LLDB_WRAPPER_NOEXCEPT {
+lldb_thread_t lldb_process_get_selected_thread(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!file_spec) return nullptr;
-    return static_cast<lldb::SBFileSpec*>(file_spec)->GetDirectory();
+    if (!process) return nullptr;
+
+    lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
+    lldb::SBThread thread = p->GetSelectedThread();
+
+    if (!thread.IsValid()) return nullptr;
+
+    return static_cast<lldb_thread_t>(new lldb::SBThread(thread));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2907,10 +6782,10 @@ const char* lldb_file_spec_get_directory(lldb_file_spec_t file_spec)  LLDB_WRAPP
     }
 }
 
-uint32_t lldb_file_spec_get_path(lldb_file_spec_t file_spec, char* buffer, size_t length)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_process_set_selected_thread_by_id(lldb_process_t process, uint64_t tid)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!file_spec) return 0;
-    return static_cast<lldb::SBFileSpec*>(file_spec)->GetPath(buffer, length);
+    if (!process) return 0;
+    return static_cast<lldb::SBProcess*>(process)->SetSelectedThreadByID(tid) ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2924,41 +6799,44 @@ uint32_t lldb_file_spec_get_path(lldb_file_spec_t file_spec, char* buffer, size_
     }
 }
 
-void lldb_file_spec_set_filename(lldb_file_spec_t file_spec, const char* filename)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_process_set_selected_thread_by_index_id(lldb_process_t process, uint32_t index_id)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!file_spec || !filename) return;
-    static_cast<lldb::SBFileSpec*>(file_spec)->SetFilename(filename);
+    if (!process) return 0;
+    return static_cast<lldb::SBProcess*>(process)->SetSelectedThreadByIndexID(index_id) ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-void lldb_file_spec_set_directory(lldb_file_spec_t file_spec, const char* directory)  LLDB_WRAPPER_NOEXCEPT {
+uint64_t lldb_process_get_process_id(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!file_spec || !directory) return;
-    static_cast<lldb::SBFileSpec*>(file_spec)->SetDirectory(directory);
+    if (!process) return 0;
+    return static_cast<lldb::SBProcess*>(process)->GetProcessID();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-// ============================================================================
-// SBFileSpecList
-// ============================================================================
-
-lldb_file_spec_list_t lldb_file_spec_list_create(void)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_process_get_exit_status(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return static_cast<lldb_file_spec_list_t>(new lldb::SBFileSpecList());
+    if (!process) return -1;
+    return static_cast<lldb::SBProcess*>(process)->GetExitStatus();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -2972,22 +6850,32 @@ lldb_file_spec_list_t lldb_file_spec_list_create(void)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-void lldb_file_spec_list_destroy(lldb_file_spec_list_t list)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_process_get_exit_description(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (list) delete static_cast<lldb::SBFileSpecList*>(list);
+    if (!process) return nullptr;
+    return static_cast<lldb::SBProcess*>(process)->GetExitDescription();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-int lldb_file_spec_list_is_valid(lldb_file_spec_list_t list)  LLDB_WRAPPER_NOEXCEPT {
+size_t lldb_process_read_memory(lldb_process_t process, uint64_t addr, void* buf, size_t size, lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return list ? 1 : 0;
+    if (!process || !buf) return 0;
+
+    lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
+    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
+    lldb::SBError local_error;
+
+    return wrapper_read_process_memory(*p, addr, buf, size, err ? *err : local_error);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3001,148 +6889,559 @@ int lldb_file_spec_list_is_valid(lldb_file_spec_list_t list)  LLDB_WRAPPER_NOEXC
     }
 }
 
-uint32_t lldb_file_spec_list_get_size(lldb_file_spec_list_t list)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_capture_backtraces(lldb_process_t process,
+                                                   uint32_t max_depth,
+                                                   uint32_t flags,
+                                                   void* buffer,
+                                                   size_t buffer_size,
+                                                   uint64_t* required_size)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!list) return 0;
-    return static_cast<lldb::SBFileSpecList*>(list)->GetSize();
+    wrapper_clear_error_state();
+    if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    if (!required_size || (!buffer && buffer_size > 0)) return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+
+    lldb::SBProcess& sb_process = *static_cast<lldb::SBProcess*>(process);
+    if (!sb_process.IsValid()) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+
+    uint32_t process_unique_id = sb_process.GetUniqueID();
+    uint32_t stop_id = sb_process.GetStopID(true);
+    std::unique_ptr<WrapperBacktraceCapture> capture = std::move(g_pending_backtraces);
+    if (!capture || capture->process_unique_id != process_unique_id || capture->stop_id != stop_id ||
+        capture->max_depth != max_depth || capture->flags != flags) {
+        capture.reset(new WrapperBacktraceCapture());
+        capture->process_unique_id = process_unique_id;
+        capture->stop_id = stop_id;
+        capture->max_depth = max_depth;
+        capture->flags = flags;
+        capture->capture(sb_process);
+    }
+
+    lldb_ruby_status_t status = capture->copy(buffer, buffer_size, required_size);
+    if (status == LLDB_RUBY_STATUS_OK && buffer_size < *required_size) g_pending_backtraces = std::move(capture);
+    return status;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-void lldb_file_spec_list_append(lldb_file_spec_list_t list, lldb_file_spec_t file_spec)  LLDB_WRAPPER_NOEXCEPT {
+lldb_profiler_t lldb_process_start_profiler(lldb_process_t process,
+                                           uint32_t interval_us,
+                                           uint32_t max_depth,
+                                           lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!list || !file_spec) return;
-    static_cast<lldb::SBFileSpecList*>(list)->Append(
-        *static_cast<lldb::SBFileSpec*>(file_spec));
+    wrapper_clear_error_state();
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
+    if (!process || interval_us == 0) {
+        wrapper_set_invalid_argument(error, "profiler requires a process and a positive interval");
+        return nullptr;
+    }
+
+    std::unique_ptr<WrapperProfiler> profiler(new WrapperProfiler());
+    profiler->process = *static_cast<lldb::SBProcess*>(process);
+    if (!profiler->process.IsValid() || wrapper_process_has_ended(profiler->process.GetState())) {
+        wrapper_set_invalid_argument(error, "profiler requires a live process");
+        return nullptr;
+    }
+    // A synchronous Continue would block the sampling thread until the next
+    // stop.
+    if (!profiler->process.GetTarget().GetDebugger().GetAsync()) {
+        wrapper_set_invalid_argument(error, "profiler requires an asynchronous debugger");
+        return nullptr;
+    }
+    profiler->interval = std::chrono::microseconds(interval_us);
+    profiler->max_depth = max_depth;
+    profiler->stop_signal = profiler->process.GetUnixSignals().GetSignalNumberFromName("SIGSTOP");
+    profiler->started = std::chrono::steady_clock::now();
+    profiler->started_unix_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+            .count();
+
+    WrapperProfiler* running = profiler.get();
+    running->worker = std::thread([running] {
+        try {
+            running->run();
+        } catch (...) {
+            // The samples taken so far are still reported.
+            running->running = false;
+        }
+    });
+    return profiler.release();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-int lldb_file_spec_list_append_if_unique(lldb_file_spec_list_t list,
-                                         lldb_file_spec_t file_spec)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_read_memory_batch(lldb_process_t process,
+                                                  const lldb_ruby_memory_range_t* ranges,
+                                                  size_t count,
+                                                  void* buffer,
+                                                  size_t buffer_size,
+                                                  uint64_t* bytes_read,
+                                                  lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!list || !file_spec) return 0;
-    return static_cast<lldb::SBFileSpecList*>(list)->AppendIfUnique(
-               *static_cast<lldb::SBFileSpec*>(file_spec))
-               ? 1
-               : 0;
+    wrapper_clear_error_state();
+    if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    if (count == 0) return LLDB_RUBY_STATUS_OK;
+
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
+    if (!ranges || !bytes_read || (!buffer && buffer_size > 0)) {
+        wrapper_set_invalid_argument(error, "batch read requires ranges, a buffer, and a result array");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+    for (size_t index = 0; index < count; ++index) {
+        if (!wrapper_memory_range_is_valid(ranges[index], buffer_size)) {
+            wrapper_set_invalid_argument(error, "batch read range does not fit the destination buffer");
+            return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+        }
+    }
+
+    lldb::SBError first_error;
+    wrapper_read_memory_ranges(*static_cast<lldb::SBProcess*>(process),
+                               ranges,
+                               count,
+                               static_cast<uint8_t*>(buffer),
+                               bytes_read,
+                               first_error);
+    wrapper_copy_error(output, first_error);
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-void lldb_file_spec_list_clear(lldb_file_spec_list_t list)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_write_memory_batch(lldb_process_t process,
+                                                   const lldb_ruby_memory_range_t* ranges,
+                                                   size_t count,
+                                                   const void* buffer,
+                                                   size_t buffer_size,
+                                                   uint64_t* bytes_written,
+                                                   uint64_t* first_failure,
+                                                   lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (list) static_cast<lldb::SBFileSpecList*>(list)->Clear();
+    wrapper_clear_error_state();
+    if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
+    if ((!ranges && count > 0) || !bytes_written || !first_failure || (!buffer && buffer_size > 0)) {
+        wrapper_set_invalid_argument(error, "batch write requires ranges, a buffer, and result arrays");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+    for (size_t index = 0; index < count; ++index) {
+        if (!wrapper_memory_range_is_valid(ranges[index], buffer_size)) {
+            wrapper_set_invalid_argument(error, "batch write range does not fit the source buffer");
+            return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+        }
+    }
+    *first_failure = UINT64_MAX;
+
+    lldb::SBProcess& sb_process = *static_cast<lldb::SBProcess*>(process);
+    std::shared_ptr<WrapperPageCache> cache = wrapper_find_page_cache(sb_process);
+    const uint8_t* source = static_cast<const uint8_t*>(buffer);
+    lldb::SBError first_error;
+    bool failed = false;
+    for (size_t index = 0; index < count; ++index) {
+        const lldb_ruby_memory_range_t& range = ranges[index];
+        bytes_written[index] = 0;
+        if (range.size == 0) continue;
+
+        lldb::SBError write_error;
+        bytes_written[index] = sb_process.WriteMemory(range.address, source + range.offset,
+                                                      static_cast<size_t>(range.size), write_error);
+        if (cache) {
+            std::lock_guard<std::mutex> lock(cache->mutex);
+            cache->invalidate(range.address, range.size);
+        }
+        if (bytes_written[index] == range.size) continue;
+
+        if (write_error.Success()) write_error.SetErrorString("memory write was incomplete");
+        if (!failed) *first_failure = index;
+        wrapper_record_first_error(first_error, failed, write_error);
+    }
+    wrapper_copy_error(output, first_error);
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-lldb_file_spec_t lldb_file_spec_list_get_file_spec_at_index(lldb_file_spec_list_t list,
-                                                             uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_read_structs(lldb_process_t process,
+                                             uint64_t addr,
+                                             lldb_type_layout_t layout,
+                                             uint64_t count,
+                                             uint64_t stride,
+                                             void* const* columns,
+                                             size_t column_count,
+                                             uint64_t* elements_read,
+                                             lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!list) return nullptr;
-    lldb::SBFileSpec file_spec =
-        static_cast<lldb::SBFileSpecList*>(list)->GetFileSpecAtIndex(index);
-    if (!file_spec.IsValid()) return nullptr;
-    return static_cast<lldb_file_spec_t>(new lldb::SBFileSpec(file_spec));
+    wrapper_clear_error_state();
+    if (!process || !layout) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
+    const WrapperTypeLayout& type_layout = *static_cast<WrapperTypeLayoutHandle*>(layout)->layout;
+    uint64_t size = type_layout.byte_size;
+    if (stride == 0) stride = size;
+    if (!elements_read || (!columns && count > 0) || column_count != type_layout.fields.size() || stride < size ||
+        addr > UINT64_MAX - size || (count > 0 && (count - 1) > (UINT64_MAX - addr - size) / stride)) {
+        wrapper_set_invalid_argument(error, "struct read requires one column per field and a fitting range");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+    for (size_t index = 0; index < column_count && count > 0; ++index) {
+        if (!columns[index]) {
+            wrapper_set_invalid_argument(error, "struct read requires one column per field and a fitting range");
+            return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+        }
+    }
+    *elements_read = 0;
+    if (count == 0) return LLDB_RUBY_STATUS_OK;
+
+    lldb::SBProcess& sb_process = *static_cast<lldb::SBProcess*>(process);
+    bool big_endian = sb_process.GetByteOrder() == lldb::eByteOrderBig;
+    // Elements are read in windows of at most kWrapperMaxCoalescedRead bytes
+    // and decoded straight from the window into the columns.
+    uint64_t per_window = size >= kWrapperMaxCoalescedRead ? 1 : (kWrapperMaxCoalescedRead - size) / stride + 1;
+    std::vector<uint8_t> window;
+    lldb::SBError read_error;
+    for (uint64_t first = 0; first < count;) {
+        uint64_t elements = std::min(per_window, count - first);
+        size_t span = static_cast<size_t>((elements - 1) * stride + size);
+        window.resize(span);
+        size_t got = wrapper_read_process_memory(sb_process, addr + first * stride, window.data(), span, read_error);
+        uint64_t complete = got < size ? 0 : std::min<uint64_t>(elements, (got - size) / stride + 1);
+        wrapper_decode_layout(type_layout, window.data(), complete, stride, big_endian, columns, first);
+        first += complete;
+        *elements_read = first;
+        if (complete < elements) break;
+    }
+    if (*elements_read == 0) return wrapper_status(read_error, output);
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-// ============================================================================
-// SBAddress
-// ============================================================================
-
-lldb_address_t lldb_address_create(void)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_read_array(lldb_process_t process,
+                                           uint64_t addr,
+                                           uint32_t element_type,
+                                           uint64_t count,
+                                           uint64_t stride,
+                                           void* buffer,
+                                           size_t buffer_size,
+                                           uint64_t* elements_read,
+                                           lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    return static_cast<lldb_address_t>(new lldb::SBAddress());
+    wrapper_clear_error_state();
+    if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
+    lldb::SBProcess& sb_process = *static_cast<lldb::SBProcess*>(process);
+    size_t source_size = wrapper_element_source_size(element_type, sb_process.GetAddressByteSize());
+    size_t destination_size = element_type == LLDB_RUBY_ELEMENT_POINTER ? sizeof(uint64_t) : source_size;
+    if (source_size == 0 || !elements_read) {
+        wrapper_set_invalid_argument(error, "array read requires a known element type and a result counter");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+    if (stride == 0) stride = source_size;
+    if (stride < source_size || (!buffer && count > 0) || count > buffer_size / destination_size ||
+        addr > UINT64_MAX - source_size ||
+        (count > 0 && (count - 1) > (UINT64_MAX - addr - source_size) / stride)) {
+        wrapper_set_invalid_argument(error, "array read does not fit the destination buffer or address space");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+    *elements_read = 0;
+    if (count == 0) return LLDB_RUBY_STATUS_OK;
+
+    lldb::ByteOrder order = sb_process.GetByteOrder();
+    bool swap = source_size > 1 &&
+                (order == lldb::eByteOrderBig) == wrapper_host_is_little_endian();
+    uint8_t* destination = static_cast<uint8_t*>(buffer);
+    lldb::SBError read_error;
+
+    // Densely packed elements are read straight into the caller's buffer.
+    if (stride == source_size && destination_size == source_size) {
+        size_t got = wrapper_read_process_memory(sb_process, addr, destination,
+                                                 static_cast<size_t>(count) * source_size, read_error);
+        *elements_read = got / source_size;
+        if (swap) wrapper_swap_elements(destination, source_size, static_cast<size_t>(*elements_read));
+    } else {
+        // Strided or widened elements are gathered from windows of at most
+        // kWrapperMaxCoalescedRead bytes.
+        uint64_t per_window = std::max<uint64_t>(1, (kWrapperMaxCoalescedRead - source_size) / stride + 1);
+        std::vector<uint8_t> window;
+        for (uint64_t first = 0; first < count;) {
+            uint64_t elements = std::min(per_window, count - first);
+            size_t span = static_cast<size_t>((elements - 1) * stride + source_size);
+            window.resize(span);
+            size_t got = wrapper_read_process_memory(sb_process, addr + first * stride, window.data(), span, read_error);
+            uint64_t complete = got < source_size ? 0 : std::min<uint64_t>(elements, (got - source_size) / stride + 1);
+            for (uint64_t index = 0; index < complete; ++index) {
+                wrapper_decode_element(window.data() + index * stride, source_size, swap,
+                                       destination + (first + index) * destination_size, destination_size);
+            }
+            first += complete;
+            *elements_read = first;
+            if (complete < elements) break;
+        }
+    }
+
+    if (*elements_read == 0) return wrapper_status(read_error, output);
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-lldb_address_t lldb_address_create_from_load_address(uint64_t address, lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_walk_links(lldb_process_t process,
+                                           uint64_t start,
+                                           const uint64_t* link_offsets,
+                                           size_t link_count,
+                                           uint64_t payload_offset,
+                                           uint64_t payload_size,
+                                           uint64_t max_nodes,
+                                           void* buffer,
+                                           size_t buffer_size,
+                                           uint64_t* node_count,
+                                           uint32_t* walk_flags,
+                                           lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!target) return nullptr;
-    return static_cast<lldb_address_t>(new lldb::SBAddress(
-        address, *static_cast<lldb::SBTarget*>(target)));
+    wrapper_clear_error_state();
+    if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
+    lldb::SBProcess& sb_process = *static_cast<lldb::SBProcess*>(process);
+    uint32_t pointer_size = sb_process.GetAddressByteSize();
+    if (!node_count || !walk_flags || (!link_offsets && link_count > 0) || (pointer_size != 4 && pointer_size != 8)) {
+        wrapper_set_invalid_argument(error, "link walk requires link offsets and result counters");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+    if ((!buffer && max_nodes > 0) || payload_size > buffer_size || payload_offset > UINT64_MAX - payload_size ||
+        max_nodes > buffer_size / (sizeof(uint64_t) + payload_size)) {
+        wrapper_set_invalid_argument(error, "link walk buffer cannot hold max_nodes records");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+    for (size_t index = 0; index < link_count; ++index) {
+        if (link_offsets[index] > UINT64_MAX - pointer_size) {
+            wrapper_set_invalid_argument(error, "link offset is out of range");
+            return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+        }
+    }
+
+    // Each node is fetched with one read spanning its payload and link fields.
+    uint64_t span_begin = payload_size > 0 ? payload_offset : UINT64_MAX;
+    uint64_t span_end = payload_size > 0 ? payload_offset + payload_size : 0;
+    for (size_t index = 0; index < link_count; ++index) {
+        span_begin = std::min(span_begin, link_offsets[index]);
+        span_end = std::max(span_end, link_offsets[index] + pointer_size);
+    }
+    if (span_begin == UINT64_MAX) span_begin = span_end = 0;
+    if (span_end - span_begin > kWrapperMaxCoalescedRead) {
+        wrapper_set_invalid_argument(error, "link walk node span is larger than 1 MiB");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+
+    uint64_t* addresses = static_cast<uint64_t*>(buffer);
+    uint8_t* payloads = reinterpret_cast<uint8_t*>(addresses + max_nodes);
+    bool swap = (sb_process.GetByteOrder() == lldb::eByteOrderBig) == wrapper_host_is_little_endian();
+    WrapperBlockReader reader(sb_process, kWrapperWalkBlockSize, kWrapperWalkMaxBlocks);
+    std::unordered_set<uint64_t> visited;
+    std::vector<uint64_t> pending;
+    std::vector<uint8_t> node(static_cast<size_t>(span_end - span_begin));
+    uint32_t flags = 0;
+    uint64_t count = 0;
+
+    if (start != 0) pending.push_back(start);
+    while (!pending.empty()) {
+        uint64_t address = pending.back();
+        pending.pop_back();
+        if (!visited.insert(address).second) {
+            flags |= LLDB_RUBY_WALK_REVISITED;
+            continue;
+        }
+        if (count == max_nodes) {
+            flags |= LLDB_RUBY_WALK_TRUNCATED;
+            break;
+        }
+        if (address > UINT64_MAX - span_end ||
+            reader.read(address + span_begin, node.data(), node.size()) < node.size()) {
+            flags |= LLDB_RUBY_WALK_READ_FAILED;
+            continue;
+        }
+
+        addresses[count] = address;
+        if (payload_size > 0) {
+            std::memcpy(payloads + count * payload_size, node.data() + (payload_offset - span_begin), payload_size);
+        }
+        ++count;
+
+        // Push children in reverse so the first link is visited first.
+        for (size_t index = link_count; index-- > 0;) {
+            uint8_t raw[8] = {0};
+            wrapper_decode_element(node.data() + (link_offsets[index] - span_begin), pointer_size, swap,
+                                   raw, sizeof(uint64_t));
+            uint64_t child;
+            std::memcpy(&child, raw, sizeof(child));
+            if (child != 0) pending.push_back(child);
+        }
+    }
+
+    *node_count = count;
+    *walk_flags = flags;
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-void lldb_address_destroy(lldb_address_t address)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_set_memory_cache(lldb_process_t process,
+                                                 uint32_t page_size,
+                                                 uint32_t max_pages,
+                                                 lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (address) delete static_cast<lldb::SBAddress*>(address);
+    wrapper_clear_error_state();
+    if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+
+    lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
+    if (max_pages == 0) {
+        wrapper_drop_page_cache(*p);
+        return LLDB_RUBY_STATUS_OK;
+    }
+    if (!wrapper_is_valid_page_size(page_size)) {
+        wrapper_set_invalid_argument(output ? static_cast<lldb::SBError*>(output) : nullptr,
+                                     "memory cache page size must be a power of two of at least 64");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+
+    wrapper_install_page_cache(*p, page_size, max_pages);
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-int lldb_address_is_valid(lldb_address_t address)  LLDB_WRAPPER_NOEXCEPT {
+lldb_memory_prefetch_t lldb_process_prefetch_memory(lldb_process_t process,
+                                                   const lldb_ruby_address_range_t* ranges,
+                                                   size_t count,
+                                                   lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!address) return 0;
-    return static_cast<lldb::SBAddress*>(address)->IsValid() ? 1 : 0;
+    wrapper_clear_error_state();
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
+    if (!process || (!ranges && count > 0)) {
+        wrapper_set_invalid_argument(error, "memory prefetch requires a process and ranges");
+        return nullptr;
+    }
+    for (size_t index = 0; index < count; ++index) {
+        if (ranges[index].size > 0 && ranges[index].address > UINT64_MAX - (ranges[index].size - 1)) {
+            wrapper_set_invalid_argument(error, "memory prefetch range wraps around the address space");
+            return nullptr;
+        }
+    }
+
+    std::unique_ptr<WrapperMemoryPrefetch> prefetch(new WrapperMemoryPrefetch());
+    prefetch->process = *static_cast<lldb::SBProcess*>(process);
+    lldb::StateType state = prefetch->process.GetState();
+    if (state != lldb::eStateStopped && state != lldb::eStateCrashed) {
+        wrapper_set_invalid_argument(error, "memory prefetch requires a stopped process");
+        return nullptr;
+    }
+
+    prefetch->cache = wrapper_find_page_cache(prefetch->process);
+    if (!prefetch->cache) {
+        prefetch->cache = wrapper_install_page_cache(prefetch->process, kWrapperPrefetchDefaultPageSize,
+                                                     kWrapperPrefetchDefaultMaxPages);
+    }
+    prefetch->stop_id = prefetch->process.GetStopID(true);
+    prefetch->generation = prefetch->cache->prefetch_generation;
+    {
+        std::lock_guard<std::mutex> lock(prefetch->cache->mutex);
+        if (prefetch->cache->stop_id != prefetch->stop_id) {
+            prefetch->cache->clear();
+            prefetch->cache->stop_id = prefetch->stop_id;
+        }
+    }
+    wrapper_prefetch_spans(ranges, count, prefetch->cache->page_size, prefetch->cache->max_pages, prefetch->spans);
+
+#if WRAPPER_HAVE_POSIX_FILES
+    if (pipe(prefetch->notify_fds) == 0) {
+        for (int fd : prefetch->notify_fds) fcntl(fd, F_SETFD, FD_CLOEXEC);
+    } else {
+        prefetch->notify_fds[0] = prefetch->notify_fds[1] = -1;
+    }
+#endif
+
+    WrapperMemoryPrefetch* running = prefetch.get();
+    running->worker = std::thread([running] {
+        try {
+            wrapper_run_prefetch(*running);
+        } catch (...) {
+            // A failed prefetch only means later reads go to LLDB.
+        }
+        running->finish();
+    });
+    return prefetch.release();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3156,45 +7455,71 @@ int lldb_address_is_valid(lldb_address_t address)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-uint64_t lldb_address_get_file_address(lldb_address_t address)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_get_memory_cache_stats(lldb_process_t process,
+                                                       uint64_t* hits,
+                                                       uint64_t* misses,
+                                                       uint64_t* cached_pages)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!address) return LLDB_INVALID_ADDRESS;
-    return static_cast<lldb::SBAddress*>(address)->GetFileAddress();
+    wrapper_clear_error_state();
+    if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    if (!hits || !misses || !cached_pages) return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+
+    *hits = 0;
+    *misses = 0;
+    *cached_pages = 0;
+    lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
+    std::shared_ptr<WrapperPageCache> cache = wrapper_find_page_cache(*p);
+    if (!cache) return LLDB_RUBY_STATUS_OK;
+    if (wrapper_page_cache_process_gone(*p)) {
+        wrapper_drop_page_cache(*p);
+        return LLDB_RUBY_STATUS_OK;
+    }
+
+    std::lock_guard<std::mutex> lock(cache->mutex);
+    *hits = cache->hits;
+    *misses = cache->misses;
+    *cached_pages = cache->pages.size();
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-uint64_t lldb_address_get_load_address(lldb_address_t address, lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_process_flush_memory_cache(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!address || !target) return LLDB_INVALID_ADDRESS;
-    return static_cast<lldb::SBAddress*>(address)->GetLoadAddress(
-        *static_cast<lldb::SBTarget*>(target));
+    if (!process) return;
+    wrapper_flush_page_cache(*static_cast<lldb::SBProcess*>(process));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-uint64_t lldb_address_get_offset(lldb_address_t address)  LLDB_WRAPPER_NOEXCEPT {
+size_t lldb_process_write_memory(lldb_process_t process, uint64_t addr, const void* buf, size_t size, lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!address) return 0;
-    return static_cast<lldb::SBAddress*>(address)->GetOffset();
+    if (!process || !buf) return 0;
+
+    lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
+    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
+    lldb::SBError local_error;
+
+    // Invalidate after the write so a concurrent prefetch cannot repopulate
+    // the pages with bytes read before the write landed.
+    size_t written = p->WriteMemory(addr, buf, size, err ? *err : local_error);
+    wrapper_invalidate_page_cache(*p, addr, size);
+    return written;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3208,12 +7533,15 @@ uint64_t lldb_address_get_offset(lldb_address_t address)  LLDB_WRAPPER_NOEXCEPT
     }
 }
 
-lldb_line_entry_t lldb_address_get_line_entry(lldb_address_t address)  LLDB_WRAPPER_NOEXCEPT {
+uint64_t lldb_process_allocate_memory(lldb_process_t process, size_t size, uint32_t permissions, lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!address) return nullptr;
-    lldb::SBLineEntry entry = static_cast<lldb::SBAddress*>(address)->GetLineEntry();
-    if (!entry.IsValid()) return nullptr;
-    return static_cast<lldb_line_entry_t>(new lldb::SBLineEntry(entry));
+    if (!process) return LLDB_INVALID_ADDRESS;
+
+    lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
+    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
+    lldb::SBError local_error;
+
+    return p->AllocateMemory(size, permissions, err ? *err : local_error);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3227,46 +7555,46 @@ lldb_line_entry_t lldb_address_get_line_entry(lldb_address_t address)  LLDB_WRAP
     }
 }
 
-// ============================================================================
-// SBLineEntry
-// ============================================================================
-
-void lldb_line_entry_destroy(lldb_line_entry_t entry)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_deallocate_memory(lldb_process_t process,
+                                                  uint64_t addr,
+                                                  lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (entry) delete static_cast<lldb::SBLineEntry*>(entry);
-
-      } catch (const std::bad_alloc&) {
-        wrapper_set_error_state("native allocation failed across the C ABI");
+    wrapper_clear_error_state();
+    if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    try {
+        lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
+        lldb::SBError error = p->DeallocateMemory(addr);
+        wrapper_flush_page_cache(*p);
+        return wrapper_status(error, output);
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
-        wrapper_set_error_state("unknown native exception across the C ABI");
+        wrapper_set_error_state("unknown native exception in process deallocate");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
-}
-
-int lldb_line_entry_is_valid(lldb_line_entry_t entry)  LLDB_WRAPPER_NOEXCEPT {
-    try {
-    if (!entry) return 0;
-    return static_cast<lldb::SBLineEntry*>(entry)->IsValid() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-lldb_address_t lldb_line_entry_get_start_address(lldb_line_entry_t entry)  LLDB_WRAPPER_NOEXCEPT {
+size_t lldb_process_read_cstring_from_memory(lldb_process_t process, uint64_t addr, void* buf, size_t size, lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!entry) return nullptr;
-    lldb::SBAddress address = static_cast<lldb::SBLineEntry*>(entry)->GetStartAddress();
-    if (!address.IsValid()) return nullptr;
-    return static_cast<lldb_address_t>(new lldb::SBAddress(address));
+    if (!process || !buf) return 0;
+
+    lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
+    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
+    lldb::SBError local_error;
+
+    return p->ReadCStringFromMemory(addr, buf, size, err ? *err : local_error);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3280,31 +7608,75 @@ lldb_address_t lldb_line_entry_get_start_address(lldb_line_entry_t entry)  LLDB_
     }
 }
 
-lldb_address_t lldb_line_entry_get_end_address(lldb_line_entry_t entry)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_read_cstrings(lldb_process_t process,
+                                              const uint64_t* addresses,
+                                              size_t count,
+                                              size_t max_len,
+                                              char* buffer,
+                                              size_t buffer_size,
+                                              uint64_t* offsets,
+                                              lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!entry) return nullptr;
-    lldb::SBAddress address = static_cast<lldb::SBLineEntry*>(entry)->GetEndAddress();
-    if (!address.IsValid()) return nullptr;
-    return static_cast<lldb_address_t>(new lldb::SBAddress(address));
+    wrapper_clear_error_state();
+    if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
+    if ((!addresses && count > 0) || !offsets || max_len == SIZE_MAX ||
+        (count > 0 && (!buffer || buffer_size / (max_len + 1) < count))) {
+        wrapper_set_invalid_argument(error, "batch C-string read buffer or offsets are missing or too small");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+
+    WrapperCStringPages pages(*static_cast<lldb::SBProcess*>(process));
+    const uint64_t mask = ~(kWrapperCStringPageSize - 1);
+    size_t used = 0;
+    for (size_t index = 0; index < count; ++index) {
+        offsets[index] = used;
+        uint64_t address = addresses[index];
+        size_t length = 0;
+        bool terminated = false;
+        while (length < max_len) {
+            const WrapperCStringPages::Page& page = pages.fetch(address & mask);
+            size_t start = static_cast<size_t>(address - page.address);
+            if (start >= page.size) break;
+
+            size_t take = std::min(page.size - start, max_len - length);
+            const uint8_t* source = page.bytes.data() + start;
+            const void* nul = std::memchr(source, 0, take);
+            size_t copied = nul ? static_cast<size_t>(static_cast<const uint8_t*>(nul) - source) : take;
+            std::memcpy(buffer + used + length, source, copied);
+            length += copied;
+            if (nul) {
+                terminated = true;
+                break;
+            }
+            if (page.size < kWrapperCStringPageSize || address > UINT64_MAX - copied) break;
+            address += copied;
+        }
+
+        if (length == 0 && !terminated) continue;
+        buffer[used + length] = '\0';
+        used += length + 1;
+    }
+    offsets[count] = used;
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-lldb_file_spec_t lldb_line_entry_get_file_spec(lldb_line_entry_t entry)  LLDB_WRAPPER_NOEXCEPT {
+size_t lldb_process_get_stdout(lldb_process_t process, char* buf, size_t size)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!entry) return nullptr;
-    lldb::SBFileSpec file_spec = static_cast<lldb::SBLineEntry*>(entry)->GetFileSpec();
-    if (!file_spec.IsValid()) return nullptr;
-    return static_cast<lldb_file_spec_t>(new lldb::SBFileSpec(file_spec));
+    if (!process || !buf) return 0;
+    return static_cast<lldb::SBProcess*>(process)->GetSTDOUT(buf, size);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3318,10 +7690,10 @@ lldb_file_spec_t lldb_line_entry_get_file_spec(lldb_line_entry_t entry)  LLDB_WR
     }
 }
 
-uint32_t lldb_line_entry_get_line(lldb_line_entry_t entry)  LLDB_WRAPPER_NOEXCEPT {
+size_t lldb_process_get_stderr(lldb_process_t process, char* buf, size_t size)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!entry) return LLDB_INVALID_LINE_NUMBER;
-    return static_cast<lldb::SBLineEntry*>(entry)->GetLine();
+    if (!process || !buf) return 0;
+    return static_cast<lldb::SBProcess*>(process)->GetSTDERR(buf, size);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3335,10 +7707,10 @@ uint32_t lldb_line_entry_get_line(lldb_line_entry_t entry)  LLDB_WRAPPER_NOEXCEP
     }
 }
 
-uint32_t lldb_line_entry_get_column(lldb_line_entry_t entry)  LLDB_WRAPPER_NOEXCEPT {
+size_t lldb_process_put_stdin(lldb_process_t process, const char* buf, size_t size)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!entry) return 0;
-    return static_cast<lldb::SBLineEntry*>(entry)->GetColumn();
+    if (!process || !buf) return 0;
+    return static_cast<lldb::SBProcess*>(process)->PutSTDIN(buf, size);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3352,15 +7724,10 @@ uint32_t lldb_line_entry_get_column(lldb_line_entry_t entry)  LLDB_WRAPPER_NOEXC
     }
 }
 
-// ============================================================================
-// SBProcess
-// ============================================================================
-
-void lldb_process_destroy(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_process_send_async_interrupt(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (process) {
-        delete static_cast<lldb::SBProcess*>(process);
-    }
+    if (!process) return;
+    static_cast<lldb::SBProcess*>(process)->SendAsyncInterrupt();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3371,10 +7738,12 @@ void lldb_process_destroy(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-int lldb_process_is_valid(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
+lldb_broadcaster_t lldb_process_get_broadcaster(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!process) return 0;
-    return static_cast<lldb::SBProcess*>(process)->IsValid() ? 1 : 0;
+    if (!process) return nullptr;
+    lldb::SBBroadcaster broadcaster = static_cast<lldb::SBProcess*>(process)->GetBroadcaster();
+    if (!broadcaster.IsValid()) return nullptr;
+    return static_cast<lldb_broadcaster_t>(new lldb::SBBroadcaster(broadcaster));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3388,18 +7757,22 @@ int lldb_process_is_valid(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-lldb_ruby_status_t lldb_process_continue(lldb_process_t process, lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_get_num_supported_hardware_watchpoints(lldb_process_t process,
+                                                                        uint32_t* result,
+                                                                        lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
     wrapper_clear_error_state();
-    if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    if (!process || !result) return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+
     try {
-        lldb::SBError error = static_cast<lldb::SBProcess*>(process)->Continue();
+        lldb::SBError error;
+        *result = static_cast<lldb::SBProcess*>(process)->GetNumSupportedHardwareWatchpoints(error);
         return wrapper_status(error, output);
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
         return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
-        wrapper_set_error_state("unknown native exception in process continue");
+        wrapper_set_error_state("unknown native exception in hardware watchpoint query");
         return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 
@@ -3415,75 +7788,82 @@ lldb_ruby_status_t lldb_process_continue(lldb_process_t process, lldb_error_t ou
     }
 }
 
-lldb_ruby_status_t lldb_process_stop(lldb_process_t process, lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
-    try {
-    wrapper_clear_error_state();
-    if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+uint32_t lldb_process_get_unique_id(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
     try {
-        lldb::SBError error = static_cast<lldb::SBProcess*>(process)->Stop();
-        return wrapper_status(error, output);
-    } catch (const std::exception& exception) {
-        wrapper_set_error_state(exception.what());
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
-    } catch (...) {
-        wrapper_set_error_state("unknown native exception in process stop");
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
-    }
+    if (!process) return 0;
+    return static_cast<lldb::SBProcess*>(process)->GetUniqueID();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+        return {};
     }
 }
 
-lldb_ruby_status_t lldb_process_kill(lldb_process_t process, lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
-    try {
-    wrapper_clear_error_state();
-    if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+lldb_memory_region_info_t lldb_process_get_memory_region_info(lldb_process_t process, uint64_t addr, lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
     try {
-        lldb::SBError error = static_cast<lldb::SBProcess*>(process)->Kill();
-        return wrapper_status(error, output);
-    } catch (const std::exception& exception) {
-        wrapper_set_error_state(exception.what());
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
-    } catch (...) {
-        wrapper_set_error_state("unknown native exception in process kill");
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    if (!process) return nullptr;
+
+    lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
+    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
+    lldb::SBError local_error;
+
+    lldb::SBMemoryRegionInfo* info = new lldb::SBMemoryRegionInfo();
+    lldb::SBError result = p->GetMemoryRegionInfo(addr, *info);
+
+    if (result.Fail()) {
+        if (err) *err = result;
+        delete info;
+        return nullptr;
     }
 
+    return static_cast<lldb_memory_region_info_t>(info);
+
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+        return {};
     }
 }
 
-lldb_ruby_status_t lldb_process_detach(lldb_process_t process, lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_get_memory_regions(lldb_process_t process,
+                                                   lldb_ruby_memory_region_t* regions,
+                                                   size_t region_capacity,
+                                                   uint64_t* region_count,
+                                                   char* names,
+                                                   size_t names_capacity,
+                                                   uint64_t* names_size)  LLDB_WRAPPER_NOEXCEPT {
     try {
     wrapper_clear_error_state();
     if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
-    try {
-        lldb::SBError error = static_cast<lldb::SBProcess*>(process)->Detach();
-        return wrapper_status(error, output);
-    } catch (const std::exception& exception) {
-        wrapper_set_error_state(exception.what());
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
-    } catch (...) {
-        wrapper_set_error_state("unknown native exception in process detach");
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    if (!region_count || !names_size || (!regions && region_capacity > 0) ||
+        (!names && names_capacity > 0)) {
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
     }
 
+    std::vector<lldb_ruby_memory_region_t> collected;
+    std::string table;
+    wrapper_collect_memory_regions(*static_cast<lldb::SBProcess*>(process), collected, &table);
+    *region_count = collected.size();
+    *names_size = table.size();
+    if (collected.size() > region_capacity || table.size() > names_capacity) {
+        return LLDB_RUBY_STATUS_OK;
+    }
+
+    std::copy(collected.begin(), collected.end(), regions);
+    if (!table.empty()) std::memcpy(names, table.data(), table.size());
+    return LLDB_RUBY_STATUS_OK;
+
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
         return LLDB_RUBY_STATUS_INTERNAL_ERROR;
@@ -3496,21 +7876,64 @@ lldb_ruby_status_t lldb_process_detach(lldb_process_t process, lldb_error_t outp
     }
 }
 
-lldb_ruby_status_t lldb_process_destroy_process(lldb_process_t process, lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_scan_memory(lldb_process_t process,
+                                            const void* pattern,
+                                            const void* mask,
+                                            size_t pattern_size,
+                                            const lldb_ruby_memory_scan_filter_t* filter,
+                                            uint64_t* hits,
+                                            size_t max_hits,
+                                            uint64_t* hit_count,
+                                            lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
     wrapper_clear_error_state();
     if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
-    try {
-        lldb::SBError error = static_cast<lldb::SBProcess*>(process)->Destroy();
-        return wrapper_status(error, output);
-    } catch (const std::exception& exception) {
-        wrapper_set_error_state(exception.what());
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
-    } catch (...) {
-        wrapper_set_error_state("unknown native exception in process destroy");
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
+    if (!pattern || pattern_size == 0 || !hits || max_hits == 0 || !hit_count) {
+        wrapper_set_invalid_argument(error, "memory scan requires a pattern and a hit array");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+    if (pattern_size > kWrapperScanChunkSize) {
+        wrapper_set_invalid_argument(error, "memory scan pattern is larger than the scan chunk");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+
+    WrapperBytePattern compiled;
+    if (!compiled.assign(static_cast<const uint8_t*>(pattern), static_cast<const uint8_t*>(mask), pattern_size)) {
+        wrapper_set_invalid_argument(error, "memory scan mask must select at least one bit");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+
+    lldb_ruby_memory_scan_filter_t bounds = filter ? *filter : lldb_ruby_memory_scan_filter_t{0, 0, 0, 0};
+    if (bounds.end == 0) bounds.end = UINT64_MAX;
+
+    lldb::SBProcess& sb_process = *static_cast<lldb::SBProcess*>(process);
+    std::vector<lldb_ruby_memory_region_t> regions;
+    wrapper_collect_memory_regions(sb_process, regions, nullptr);
+
+    size_t count = 0;
+    std::vector<uint8_t> buffer(kWrapperScanChunkSize + pattern_size - 1);
+    for (const lldb_ruby_memory_region_t& region : regions) {
+        if (!wrapper_region_matches_filter(region, bounds)) continue;
+        uint64_t begin = std::max(region.base, bounds.start);
+        uint64_t end = std::min(region.end, bounds.end);
+        if (begin >= end) continue;
+
+        bool more = wrapper_stream_memory(
+            sb_process, begin, end, pattern_size - 1, buffer,
+            [&](uint64_t base, const uint8_t* data, size_t size) {
+                return wrapper_find_pattern(data, size, compiled, [&](size_t offset) {
+                    hits[count++] = base + offset;
+                    return count < max_hits;
+                });
+            });
+        if (!more) break;
     }
 
+    *hit_count = count;
+    return LLDB_RUBY_STATUS_OK;
+
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
         return LLDB_RUBY_STATUS_INTERNAL_ERROR;
@@ -3523,20 +7946,110 @@ lldb_ruby_status_t lldb_process_destroy_process(lldb_process_t process, lldb_err
     }
 }
 
-lldb_ruby_status_t lldb_process_signal(lldb_process_t process, int signal, lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_snapshot_memory(lldb_process_t process,
+                                                const char* path,
+                                                const lldb_ruby_memory_scan_filter_t* filter,
+                                                uint64_t* region_count,
+                                                uint64_t* bytes_written,
+                                                lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
     wrapper_clear_error_state();
     if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
-    try {
-        lldb::SBError error = static_cast<lldb::SBProcess*>(process)->Signal(signal);
-        return wrapper_status(error, output);
-    } catch (const std::exception& exception) {
-        wrapper_set_error_state(exception.what());
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
-    } catch (...) {
-        wrapper_set_error_state("unknown native exception in process signal");
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
-    }
+
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
+    if (!path || !*path || !region_count || !bytes_written) {
+        wrapper_set_invalid_argument(error, "memory snapshot requires a path and result counters");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+    *region_count = 0;
+    *bytes_written = 0;
+
+#if WRAPPER_HAVE_POSIX_FILES
+    lldb::SBProcess& sb_process = *static_cast<lldb::SBProcess*>(process);
+    lldb::StateType state = sb_process.GetState();
+    if (state != lldb::eStateStopped && state != lldb::eStateCrashed) {
+        wrapper_set_invalid_argument(error, "memory snapshot requires a stopped process");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+
+    lldb_ruby_memory_scan_filter_t bounds = filter ? *filter : lldb_ruby_memory_scan_filter_t{0, 0, 0, 0};
+    if (bounds.end == 0) bounds.end = UINT64_MAX;
+    std::vector<lldb_ruby_memory_region_t> regions;
+    wrapper_collect_memory_regions(sb_process, regions, nullptr);
+
+    int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        lldb::SBError open_error;
+        open_error.SetErrorToErrno();
+        return wrapper_status(open_error, output);
+    }
+
+    std::vector<lldb_ruby_memory_snapshot_region_t> index;
+    std::vector<uint8_t> buffer(kWrapperSnapshotChunkSize);
+    uint64_t file_offset = kWrapperSnapshotAlignment;
+    uint64_t total_bytes = 0;
+    bool write_failed = false;
+    for (const lldb_ruby_memory_region_t& region : regions) {
+        if (!wrapper_region_matches_filter(region, bounds)) continue;
+        uint64_t begin = std::max(region.base, bounds.start);
+        uint64_t end = std::min(region.end, bounds.end);
+        if (begin >= end) continue;
+
+        uint64_t run_end = UINT64_MAX;
+        wrapper_stream_memory(sb_process, begin, end, 0, buffer,
+                              [&](uint64_t base, const uint8_t* data, size_t size) {
+            if (base != run_end) {
+                file_offset = wrapper_align_up(file_offset, kWrapperSnapshotAlignment);
+                index.push_back({base, 0, file_offset, region.permissions});
+            }
+            if (!wrapper_pwrite_all(fd, data, size, file_offset)) {
+                write_failed = true;
+                return false;
+            }
+            index.back().size += size;
+            file_offset += size;
+            total_bytes += size;
+            run_end = base + size;
+            return true;
+        });
+        if (write_failed) break;
+    }
+
+    lldb_ruby_memory_snapshot_header_t header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, LLDB_RUBY_MEMORY_SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = LLDB_RUBY_MEMORY_SNAPSHOT_VERSION;
+    header.header_size = sizeof(header);
+    header.region_count = index.size();
+    header.index_offset = wrapper_align_up(file_offset, alignof(lldb_ruby_memory_snapshot_region_t));
+    header.data_alignment = kWrapperSnapshotAlignment;
+    header.address_byte_size = sb_process.GetAddressByteSize();
+    header.byte_order = static_cast<uint32_t>(sb_process.GetByteOrder());
+    header.total_bytes = total_bytes;
+
+    if (!write_failed) {
+        write_failed = !wrapper_pwrite_all(fd, index.data(), index.size() * sizeof(index[0]), header.index_offset) ||
+                       !wrapper_pwrite_all(fd, &header, sizeof(header), 0);
+    }
+    lldb::SBError write_error;
+    if (write_failed) write_error.SetErrorToErrno();
+    if (::close(fd) != 0 && !write_failed) {
+        write_failed = true;
+        write_error.SetErrorToErrno();
+    }
+    if (write_failed) {
+        ::unlink(path);
+        return wrapper_status(write_error, output);
+    }
+
+    *region_count = index.size();
+    *bytes_written = total_bytes;
+    return LLDB_RUBY_STATUS_OK;
+#else
+    (void)filter;
+    wrapper_set_invalid_argument(error, "memory snapshots are not supported on this platform");
+    return LLDB_RUBY_STATUS_UNSUPPORTED;
+#endif
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3550,27 +8063,37 @@ lldb_ruby_status_t lldb_process_signal(lldb_process_t process, int signal, lldb_
     }
 }
 
-int lldb_process_get_state(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
+lldb_memory_tracker_t lldb_process_create_memory_tracker(lldb_process_t process,
+                                                         const lldb_ruby_memory_scan_filter_t* filter,
+                                                         uint32_t page_size,
+                                                         uint32_t flags,
+                                                         lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!process) return static_cast<int>(lldb::eStateInvalid);
-    return static_cast<int>(static_cast<lldb::SBProcess*>(process)->GetState());
+    wrapper_clear_error_state();
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
+    if (!process) {
+        wrapper_set_invalid_argument(error, "memory tracker requires a process");
+        return nullptr;
+    }
+    if (!wrapper_is_valid_page_size(page_size)) {
+        wrapper_set_invalid_argument(error, "memory tracker page size must be a power of two of at least 64");
+        return nullptr;
+    }
 
-      } catch (const std::bad_alloc&) {
-        wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
-    } catch (const std::exception& exception) {
-        wrapper_set_error_state(exception.what());
-        return {};
-    } catch (...) {
-        wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+    std::unique_ptr<WrapperMemoryTracker> tracker(new WrapperMemoryTracker());
+    tracker->process = *static_cast<lldb::SBProcess*>(process);
+    lldb::StateType state = tracker->process.GetState();
+    if (state != lldb::eStateStopped && state != lldb::eStateCrashed) {
+        wrapper_set_invalid_argument(error, "memory tracker requires a stopped process");
+        return nullptr;
     }
-}
 
-uint32_t lldb_process_get_num_threads(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
-    try {
-    if (!process) return 0;
-    return static_cast<lldb::SBProcess*>(process)->GetNumThreads();
+    tracker->filter = filter ? *filter : lldb_ruby_memory_scan_filter_t{0, 0, 0, 0};
+    if (tracker->filter.end == 0) tracker->filter.end = UINT64_MAX;
+    tracker->page_size = page_size;
+    tracker->byte_diff = (flags & LLDB_RUBY_MEMORY_TRACKER_BYTE_DIFF) != 0;
+    wrapper_capture_pages(*tracker, tracker->baseline);
+    return tracker.release();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3584,39 +8107,60 @@ uint32_t lldb_process_get_num_threads(lldb_process_t process)  LLDB_WRAPPER_NOEX
     }
 }
 
-lldb_thread_t lldb_process_get_thread_at_index(lldb_process_t process, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
+lldb_value_search_t lldb_process_create_value_search(lldb_process_t process,
+                                                     const lldb_ruby_memory_scan_filter_t* filter,
+                                                     uint32_t element_type,
+                                                     const void* value,
+                                                     lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!process) return nullptr;
-
-    lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
-    lldb::SBThread thread = p->GetThreadAtIndex(index);
-
-    if (!thread.IsValid()) return nullptr;
-
-    return static_cast<lldb_thread_t>(new lldb::SBThread(thread));
-
-      } catch (const std::bad_alloc&) {
-        wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
-    } catch (const std::exception& exception) {
-        wrapper_set_error_state(exception.what());
-        return {};
-    } catch (...) {
-        wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+    wrapper_clear_error_state();
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
+    if (!process || !value) {
+        wrapper_set_invalid_argument(error, "value search requires a process and a value");
+        return nullptr;
+    }
+    size_t element_size = wrapper_element_source_size(element_type, 0);
+    if (element_size == 0 || element_type == LLDB_RUBY_ELEMENT_POINTER) {
+        wrapper_set_invalid_argument(error, "value search requires an integer or floating-point element type");
+        return nullptr;
     }
-}
 
-lldb_thread_t lldb_process_get_thread_by_id(lldb_process_t process, uint64_t tid)  LLDB_WRAPPER_NOEXCEPT {
-    try {
-    if (!process) return nullptr;
+    std::unique_ptr<WrapperValueSearch> search(new WrapperValueSearch());
+    search->process = *static_cast<lldb::SBProcess*>(process);
+    lldb::StateType state = search->process.GetState();
+    if (state != lldb::eStateStopped && state != lldb::eStateCrashed) {
+        wrapper_set_invalid_argument(error, "value search requires a stopped process");
+        return nullptr;
+    }
 
-    lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
-    lldb::SBThread thread = p->GetThreadByID(tid);
+    search->element_type = element_type;
+    search->element_size = element_size;
+    search->swap = element_size > 1 &&
+                   (search->process.GetByteOrder() == lldb::eByteOrderBig) == wrapper_host_is_little_endian();
+    std::memcpy(search->initial, value, element_size);
 
-    if (!thread.IsValid()) return nullptr;
+    // Match the target representation; a floating-point zero also matches its
+    // negative, so the sign bit is left out of the comparison.
+    uint8_t bytes[8];
+    uint8_t mask[8];
+    std::memcpy(bytes, value, element_size);
+    std::memset(mask, 0xFF, element_size);
+    const uint8_t zero[8] = {0};
+    bool is_float = element_type == LLDB_RUBY_ELEMENT_FLOAT || element_type == LLDB_RUBY_ELEMENT_DOUBLE;
+    if (is_float && wrapper_compare_elements(element_type, bytes, zero) == 0) {
+        mask[wrapper_host_is_little_endian() ? element_size - 1 : 0] = 0x7F;
+    }
+    if (search->swap) {
+        std::reverse(bytes, bytes + element_size);
+        std::reverse(mask, mask + element_size);
+    }
 
-    return static_cast<lldb_thread_t>(new lldb::SBThread(thread));
+    lldb_ruby_memory_scan_filter_t bounds = filter ? *filter : lldb_ruby_memory_scan_filter_t{0, 0, 0, 0};
+    if (bounds.end == 0) bounds.end = UINT64_MAX;
+    WrapperValuePattern pattern;
+    pattern.assign(bytes, mask, element_size);
+    wrapper_value_search_scan(*search, bounds, pattern);
+    return search.release();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3630,56 +8174,119 @@ lldb_thread_t lldb_process_get_thread_by_id(lldb_process_t process, uint64_t tid
     }
 }
 
-lldb_thread_t lldb_process_get_thread_by_index_id(lldb_process_t process, uint32_t index_id)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_process_find_references(lldb_process_t process,
+                                                const lldb_ruby_address_range_t* ranges,
+                                                size_t range_count,
+                                                const lldb_ruby_memory_scan_filter_t* filter,
+                                                lldb_ruby_memory_reference_t* references,
+                                                size_t capacity,
+                                                uint64_t* reference_count,
+                                                lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!process) return nullptr;
-
-    lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
-    lldb::SBThread thread = p->GetThreadByIndexID(index_id);
+    wrapper_clear_error_state();
+    if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
 
-    if (!thread.IsValid()) return nullptr;
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
+    lldb::SBProcess& sb_process = *static_cast<lldb::SBProcess*>(process);
+    uint32_t pointer_size = sb_process.GetAddressByteSize();
+    if ((!ranges && range_count > 0) || (!references && capacity > 0) || !reference_count ||
+        (pointer_size != 4 && pointer_size != 8)) {
+        wrapper_set_invalid_argument(error, "reference scan requires ranges, a result array, and a counter");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+    for (size_t index = 0; index < range_count; ++index) {
+        if (ranges[index].address > UINT64_MAX - ranges[index].size) {
+            wrapper_set_invalid_argument(error, "reference scan range wraps around the address space");
+            return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+        }
+    }
+    *reference_count = 0;
+
+    WrapperIntervalIndex index;
+    index.assign(ranges, range_count);
+    if (index.ids.empty()) return LLDB_RUBY_STATUS_OK;
+
+    lldb_ruby_memory_scan_filter_t bounds = filter ? *filter : lldb_ruby_memory_scan_filter_t{0, 0, 0, 0};
+    if (bounds.end == 0) bounds.end = UINT64_MAX;
+    std::vector<lldb_ruby_memory_region_t> regions;
+    wrapper_collect_memory_regions(sb_process, regions, nullptr);
+
+    const bool swap = (sb_process.GetByteOrder() == lldb::eByteOrderBig) == wrapper_host_is_little_endian();
+    uint64_t found = 0;
+    std::vector<uint8_t> buffer(kWrapperReferenceChunkSize);
+    std::vector<std::vector<lldb_ruby_memory_reference_t>> task_references;
+    WrapperWorkerPool pool;
+    for (const lldb_ruby_memory_region_t& region : regions) {
+        if (!wrapper_region_matches_filter(region, bounds)) continue;
+        uint64_t begin = wrapper_align_up(std::max(region.base, bounds.start), pointer_size);
+        uint64_t end = std::min(region.end, bounds.end);
+        if (begin >= end) continue;
+
+        wrapper_stream_memory(sb_process, begin, end, 0, buffer,
+                              [&](uint64_t base, const uint8_t* data, size_t size) {
+            size_t words = size / pointer_size;
+            size_t words_per_task = kWrapperReferenceTaskSize / pointer_size;
+            size_t tasks = (words + words_per_task - 1) / words_per_task;
+            task_references.assign(tasks, {});
+            pool.run(tasks, [&, base, data, words, words_per_task](size_t task) {
+                std::vector<lldb_ruby_memory_reference_t>& local = task_references[task];
+                size_t last = std::min(words, (task + 1) * words_per_task);
+                for (size_t word = task * words_per_task; word < last; ++word) {
+                    uint64_t value = wrapper_load_pointer(data + word * pointer_size, pointer_size, swap);
+                    index.find(value, [&](uint64_t range_index) {
+                        local.push_back({base + word * pointer_size, value, range_index});
+                    });
+                }
+            });
+
+            for (const std::vector<lldb_ruby_memory_reference_t>& local : task_references) {
+                for (const lldb_ruby_memory_reference_t& reference : local) {
+                    if (found < capacity) references[found] = reference;
+                    ++found;
+                }
+            }
+            return true;
+        });
+    }
 
-    return static_cast<lldb_thread_t>(new lldb::SBThread(thread));
+    *reference_count = found;
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-lldb_thread_t lldb_process_get_selected_thread(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
-    try {
-    if (!process) return nullptr;
-
-    lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
-    lldb::SBThread thread = p->GetSelectedThread();
-
-    if (!thread.IsValid()) return nullptr;
+// ============================================================================
+// SBMemoryRegionInfo
+// ============================================================================
 
-    return static_cast<lldb_thread_t>(new lldb::SBThread(thread));
+void lldb_memory_region_info_destroy(lldb_memory_region_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (info) {
+        delete static_cast<lldb::SBMemoryRegionInfo*>(info);
+    }
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-int lldb_process_set_selected_thread_by_id(lldb_process_t process, uint64_t tid)  LLDB_WRAPPER_NOEXCEPT {
+uint64_t lldb_memory_region_info_get_region_base(lldb_memory_region_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!process) return 0;
-    return static_cast<lldb::SBProcess*>(process)->SetSelectedThreadByID(tid) ? 1 : 0;
+    if (!info) return 0;
+    return static_cast<lldb::SBMemoryRegionInfo*>(info)->GetRegionBase();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3693,10 +8300,10 @@ int lldb_process_set_selected_thread_by_id(lldb_process_t process, uint64_t tid)
     }
 }
 
-int lldb_process_set_selected_thread_by_index_id(lldb_process_t process, uint32_t index_id)  LLDB_WRAPPER_NOEXCEPT {
+uint64_t lldb_memory_region_info_get_region_end(lldb_memory_region_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!process) return 0;
-    return static_cast<lldb::SBProcess*>(process)->SetSelectedThreadByIndexID(index_id) ? 1 : 0;
+    if (!info) return 0;
+    return static_cast<lldb::SBMemoryRegionInfo*>(info)->GetRegionEnd();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3710,10 +8317,10 @@ int lldb_process_set_selected_thread_by_index_id(lldb_process_t process, uint32_
     }
 }
 
-uint64_t lldb_process_get_process_id(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_memory_region_info_is_readable(lldb_memory_region_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!process) return 0;
-    return static_cast<lldb::SBProcess*>(process)->GetProcessID();
+    if (!info) return 0;
+    return static_cast<lldb::SBMemoryRegionInfo*>(info)->IsReadable() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3727,10 +8334,10 @@ uint64_t lldb_process_get_process_id(lldb_process_t process)  LLDB_WRAPPER_NOEXC
     }
 }
 
-int lldb_process_get_exit_status(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_memory_region_info_is_writable(lldb_memory_region_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!process) return -1;
-    return static_cast<lldb::SBProcess*>(process)->GetExitStatus();
+    if (!info) return 0;
+    return static_cast<lldb::SBMemoryRegionInfo*>(info)->IsWritable() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3744,10 +8351,10 @@ int lldb_process_get_exit_status(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT
     }
 }
 
-const char* lldb_process_get_exit_description(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_memory_region_info_is_executable(lldb_memory_region_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!process) return nullptr;
-    return static_cast<lldb::SBProcess*>(process)->GetExitDescription();
+    if (!info) return 0;
+    return static_cast<lldb::SBMemoryRegionInfo*>(info)->IsExecutable() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3761,15 +8368,10 @@ const char* lldb_process_get_exit_description(lldb_process_t process)  LLDB_WRAP
     }
 }
 
-size_t lldb_process_read_memory(lldb_process_t process, uint64_t addr, void* buf, size_t size, lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_memory_region_info_is_mapped(lldb_memory_region_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!process || !buf) return 0;
-
-    lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
-    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
-    lldb::SBError local_error;
-
-    return p->ReadMemory(addr, buf, size, err ? *err : local_error);
+    if (!info) return 0;
+    return static_cast<lldb::SBMemoryRegionInfo*>(info)->IsMapped() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3783,15 +8385,10 @@ size_t lldb_process_read_memory(lldb_process_t process, uint64_t addr, void* buf
     }
 }
 
-size_t lldb_process_write_memory(lldb_process_t process, uint64_t addr, const void* buf, size_t size, lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_memory_region_info_get_name(lldb_memory_region_info_t info)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!process || !buf) return 0;
-
-    lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
-    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
-    lldb::SBError local_error;
-
-    return p->WriteMemory(addr, buf, size, err ? *err : local_error);
+    if (!info) return nullptr;
+    return static_cast<lldb::SBMemoryRegionInfo*>(info)->GetName();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3805,15 +8402,48 @@ size_t lldb_process_write_memory(lldb_process_t process, uint64_t addr, const vo
     }
 }
 
-uint64_t lldb_process_allocate_memory(lldb_process_t process, size_t size, uint32_t permissions, lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
+// ============================================================================
+// Memory snapshots
+// ============================================================================
+
+lldb_memory_snapshot_t lldb_memory_snapshot_open(const char* path, lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!process) return LLDB_INVALID_ADDRESS;
+    wrapper_clear_error_state();
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
+    if (!path || !*path) {
+        wrapper_set_invalid_argument(error, "memory snapshot path is required");
+        return nullptr;
+    }
 
-    lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
-    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
-    lldb::SBError local_error;
+#if WRAPPER_HAVE_POSIX_FILES
+    int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    struct stat info;
+    if (fd < 0 || ::fstat(fd, &info) != 0) {
+        if (error) error->SetErrorToErrno();
+        if (fd >= 0) ::close(fd);
+        return nullptr;
+    }
 
-    return p->AllocateMemory(size, permissions, err ? *err : local_error);
+    std::unique_ptr<WrapperMemorySnapshot> snapshot(new WrapperMemorySnapshot());
+    snapshot->mapping_size = static_cast<size_t>(info.st_size);
+    if (snapshot->mapping_size > 0) {
+        snapshot->mapping = ::mmap(nullptr, snapshot->mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    if (snapshot->mapping == MAP_FAILED && snapshot->mapping_size > 0 && error) error->SetErrorToErrno();
+    ::close(fd);
+    if (snapshot->mapping == MAP_FAILED) {
+        if (snapshot->mapping_size == 0) wrapper_set_invalid_argument(error, "memory snapshot file is empty");
+        return nullptr;
+    }
+    if (!snapshot->validate()) {
+        wrapper_set_invalid_argument(error, "file is not a valid memory snapshot");
+        return nullptr;
+    }
+    return snapshot.release();
+#else
+    wrapper_set_invalid_argument(error, "memory snapshots are not supported on this platform");
+    return nullptr;
+#endif
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3827,22 +8457,41 @@ uint64_t lldb_process_allocate_memory(lldb_process_t process, size_t size, uint3
     }
 }
 
-lldb_ruby_status_t lldb_process_deallocate_memory(lldb_process_t process,
-                                                  uint64_t addr,
-                                                  lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
-    try {
-    wrapper_clear_error_state();
-    if (!process) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+void lldb_memory_snapshot_destroy(lldb_memory_snapshot_t snapshot)  LLDB_WRAPPER_NOEXCEPT {
     try {
-        lldb::SBError error = static_cast<lldb::SBProcess*>(process)->DeallocateMemory(addr);
-        return wrapper_status(error, output);
+#if WRAPPER_HAVE_POSIX_FILES
+    delete static_cast<WrapperMemorySnapshot*>(snapshot);
+#else
+    (void)snapshot;
+#endif
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
-        wrapper_set_error_state("unknown native exception in process deallocate");
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+        wrapper_set_error_state("unknown native exception across the C ABI");
     }
+}
+
+lldb_ruby_status_t lldb_memory_snapshot_get_regions(lldb_memory_snapshot_t snapshot,
+                                                    lldb_ruby_memory_snapshot_region_t* regions,
+                                                    size_t capacity,
+                                                    uint64_t* region_count)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    wrapper_clear_error_state();
+    if (!snapshot) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    if (!region_count || (!regions && capacity > 0)) return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+
+#if WRAPPER_HAVE_POSIX_FILES
+    const WrapperMemorySnapshot* mapped = static_cast<WrapperMemorySnapshot*>(snapshot);
+    uint64_t count = mapped->header->region_count;
+    *region_count = count;
+    if (count <= capacity) std::copy(mapped->regions, mapped->regions + count, regions);
+    return LLDB_RUBY_STATUS_OK;
+#else
+    return LLDB_RUBY_STATUS_UNSUPPORTED;
+#endif
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3856,15 +8505,56 @@ lldb_ruby_status_t lldb_process_deallocate_memory(lldb_process_t process,
     }
 }
 
-size_t lldb_process_read_cstring_from_memory(lldb_process_t process, uint64_t addr, void* buf, size_t size, lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
+size_t lldb_memory_snapshot_read_memory(lldb_memory_snapshot_t snapshot,
+                                        uint64_t addr,
+                                        void* buffer,
+                                        size_t size,
+                                        lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!process || !buf) return 0;
-
-    lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
-    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
-    lldb::SBError local_error;
-
-    return p->ReadCStringFromMemory(addr, buf, size, err ? *err : local_error);
+    wrapper_clear_error_state();
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
+    if (!snapshot || (!buffer && size > 0)) {
+        wrapper_set_invalid_argument(error, "memory snapshot read requires a snapshot and a buffer");
+        return 0;
+    }
+
+#if WRAPPER_HAVE_POSIX_FILES
+    const WrapperMemorySnapshot* mapped = static_cast<WrapperMemorySnapshot*>(snapshot);
+    const lldb_ruby_memory_snapshot_region_t* begin = mapped->regions;
+    const lldb_ruby_memory_snapshot_region_t* end = begin + mapped->header->region_count;
+    const lldb_ruby_memory_snapshot_region_t* region = std::upper_bound(
+        begin, end, addr, [](uint64_t address, const lldb_ruby_memory_snapshot_region_t& candidate) {
+            return address < candidate.address;
+        });
+
+    // Copy from the containing region and keep going while the next record
+    // continues at exactly the following address.
+    size_t copied = 0;
+    if (region != begin) {
+        --region;
+        uint64_t address = addr;
+        while (copied < size && region != end && address >= region->address &&
+               address - region->address < region->size) {
+            uint64_t relative = address - region->address;
+            size_t length = static_cast<size_t>(std::min<uint64_t>(size - copied, region->size - relative));
+            std::memcpy(static_cast<uint8_t*>(buffer) + copied,
+                        mapped->bytes() + region->file_offset + relative,
+                        length);
+            copied += length;
+            address += length;
+            ++region;
+        }
+    }
+    if (copied == 0 && size > 0 && error) {
+        error->SetErrorStringWithFormat("memory read failed for 0x%llx: not captured in snapshot",
+                                        static_cast<unsigned long long>(addr));
+    }
+    return copied;
+#else
+    (void)addr;
+    wrapper_set_invalid_argument(error, "memory snapshots are not supported on this platform");
+    return 0;
+#endif
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3878,27 +8568,27 @@ size_t lldb_process_read_cstring_from_memory(lldb_process_t process, uint64_t ad
     }
 }
 
-size_t lldb_process_get_stdout(lldb_process_t process, char* buf, size_t size)  LLDB_WRAPPER_NOEXCEPT {
+// ============================================================================
+// Memory trackers
+// ============================================================================
+
+void lldb_memory_tracker_destroy(lldb_memory_tracker_t tracker)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!process || !buf) return 0;
-    return static_cast<lldb::SBProcess*>(process)->GetSTDOUT(buf, size);
+    delete static_cast<WrapperMemoryTracker*>(tracker);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-size_t lldb_process_get_stderr(lldb_process_t process, char* buf, size_t size)  LLDB_WRAPPER_NOEXCEPT {
+uint64_t lldb_memory_tracker_get_num_pages(lldb_memory_tracker_t tracker)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!process || !buf) return 0;
-    return static_cast<lldb::SBProcess*>(process)->GetSTDERR(buf, size);
+    if (!tracker) return 0;
+    return static_cast<WrapperMemoryTracker*>(tracker)->baseline.addresses.size();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3912,74 +8602,118 @@ size_t lldb_process_get_stderr(lldb_process_t process, char* buf, size_t size)
     }
 }
 
-size_t lldb_process_put_stdin(lldb_process_t process, const char* buf, size_t size)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_memory_tracker_update(lldb_memory_tracker_t tracker,
+                                              uint64_t* change_count,
+                                              lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!process || !buf) return 0;
-    return static_cast<lldb::SBProcess*>(process)->PutSTDIN(buf, size);
+    wrapper_clear_error_state();
+    if (!tracker) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
+    if (!change_count) {
+        wrapper_set_invalid_argument(error, "memory tracker update requires a change counter");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+
+    WrapperMemoryTracker* memory_tracker = static_cast<WrapperMemoryTracker*>(tracker);
+    lldb::StateType state = memory_tracker->process.GetState();
+    if (state != lldb::eStateStopped && state != lldb::eStateCrashed) {
+        wrapper_set_invalid_argument(error, "memory tracker requires a stopped process");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+
+    WrapperPageDigest current;
+    wrapper_capture_pages(*memory_tracker, current);
+    wrapper_diff_pages(*memory_tracker, memory_tracker->baseline, current, memory_tracker->changes);
+    memory_tracker->baseline = std::move(current);
+    *change_count = memory_tracker->changes.size();
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-void lldb_process_send_async_interrupt(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_memory_tracker_get_changes(lldb_memory_tracker_t tracker,
+                                                   lldb_ruby_memory_change_t* changes,
+                                                   size_t capacity,
+                                                   uint64_t* change_count)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!process) return;
-    static_cast<lldb::SBProcess*>(process)->SendAsyncInterrupt();
+    wrapper_clear_error_state();
+    if (!tracker) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    if (!change_count || (!changes && capacity > 0)) return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+
+    const std::vector<lldb_ruby_memory_change_t>& recorded = static_cast<WrapperMemoryTracker*>(tracker)->changes;
+    *change_count = recorded.size();
+    if (recorded.size() <= capacity) std::copy(recorded.begin(), recorded.end(), changes);
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-lldb_broadcaster_t lldb_process_get_broadcaster(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
+// ============================================================================
+// Memory prefetches
+// ============================================================================
+
+void lldb_memory_prefetch_destroy(lldb_memory_prefetch_t prefetch)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!process) return nullptr;
-    lldb::SBBroadcaster broadcaster = static_cast<lldb::SBProcess*>(process)->GetBroadcaster();
-    if (!broadcaster.IsValid()) return nullptr;
-    return static_cast<lldb_broadcaster_t>(new lldb::SBBroadcaster(broadcaster));
+    delete static_cast<WrapperMemoryPrefetch*>(prefetch);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-lldb_ruby_status_t lldb_process_get_num_supported_hardware_watchpoints(lldb_process_t process,
-                                                                        uint32_t* result,
-                                                                        lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_memory_prefetch_cancel(lldb_memory_prefetch_t prefetch)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    wrapper_clear_error_state();
-    if (!process || !result) return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    if (!prefetch) return;
+    static_cast<WrapperMemoryPrefetch*>(prefetch)->cancel_requested = true;
 
-    try {
-        lldb::SBError error;
-        *result = static_cast<lldb::SBProcess*>(process)->GetNumSupportedHardwareWatchpoints(error);
-        return wrapper_status(error, output);
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
-        wrapper_set_error_state("unknown native exception in hardware watchpoint query");
-        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+        wrapper_set_error_state("unknown native exception across the C ABI");
+    }
+}
+
+lldb_ruby_status_t lldb_memory_prefetch_wait(lldb_memory_prefetch_t prefetch, int64_t timeout_ms, int* completed)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    wrapper_clear_error_state();
+    if (!prefetch) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    if (!completed) return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+
+    WrapperMemoryPrefetch& memory_prefetch = *static_cast<WrapperMemoryPrefetch*>(prefetch);
+    std::unique_lock<std::mutex> lock(memory_prefetch.mutex);
+    auto is_done = [&memory_prefetch] { return memory_prefetch.done; };
+    if (timeout_ms < 0) {
+        memory_prefetch.finished.wait(lock, is_done);
+    } else {
+        memory_prefetch.finished.wait_for(lock, std::chrono::milliseconds(timeout_ms), is_done);
     }
+    *completed = memory_prefetch.done ? 1 : 0;
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -3993,10 +8727,10 @@ lldb_ruby_status_t lldb_process_get_num_supported_hardware_watchpoints(lldb_proc
     }
 }
 
-uint32_t lldb_process_get_unique_id(lldb_process_t process)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_memory_prefetch_get_fd(lldb_memory_prefetch_t prefetch)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!process) return 0;
-    return static_cast<lldb::SBProcess*>(process)->GetUniqueID();
+    if (!prefetch) return -1;
+    return static_cast<WrapperMemoryPrefetch*>(prefetch)->notify_fds[0];
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4010,24 +8744,10 @@ uint32_t lldb_process_get_unique_id(lldb_process_t process)  LLDB_WRAPPER_NOEXCE
     }
 }
 
-lldb_memory_region_info_t lldb_process_get_memory_region_info(lldb_process_t process, uint64_t addr, lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
+uint64_t lldb_memory_prefetch_get_num_pages(lldb_memory_prefetch_t prefetch)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!process) return nullptr;
-
-    lldb::SBProcess* p = static_cast<lldb::SBProcess*>(process);
-    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
-    lldb::SBError local_error;
-
-    lldb::SBMemoryRegionInfo* info = new lldb::SBMemoryRegionInfo();
-    lldb::SBError result = p->GetMemoryRegionInfo(addr, *info);
-
-    if (result.Fail()) {
-        if (err) *err = result;
-        delete info;
-        return nullptr;
-    }
-
-    return static_cast<lldb_memory_region_info_t>(info);
+    if (!prefetch) return 0;
+    return static_cast<WrapperMemoryPrefetch*>(prefetch)->pages_loaded;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4041,29 +8761,47 @@ lldb_memory_region_info_t lldb_process_get_memory_region_info(lldb_process_t pro
     }
 }
 
+
 // ============================================================================
-// SBMemoryRegionInfo
+// Sampling profilers
 // ============================================================================
 
-void lldb_memory_region_info_destroy(lldb_memory_region_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_profiler_destroy(lldb_profiler_t profiler)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (info) {
-        delete static_cast<lldb::SBMemoryRegionInfo*>(info);
+    delete static_cast<WrapperProfiler*>(profiler);
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
     }
+}
+
+lldb_ruby_status_t lldb_profiler_stop(lldb_profiler_t profiler)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    wrapper_clear_error_state();
+    if (!profiler) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    static_cast<WrapperProfiler*>(profiler)->stop();
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-uint64_t lldb_memory_region_info_get_region_base(lldb_memory_region_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_profiler_is_running(lldb_profiler_t profiler)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return 0;
-    return static_cast<lldb::SBMemoryRegionInfo*>(info)->GetRegionBase();
+    if (!profiler) return 0;
+    return static_cast<WrapperProfiler*>(profiler)->running ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4077,61 +8815,102 @@ uint64_t lldb_memory_region_info_get_region_base(lldb_memory_region_info_t info)
     }
 }
 
-uint64_t lldb_memory_region_info_get_region_end(lldb_memory_region_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_profiler_get_stats(lldb_profiler_t profiler, lldb_ruby_profiler_stats_t* stats)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return 0;
-    return static_cast<lldb::SBMemoryRegionInfo*>(info)->GetRegionEnd();
+    wrapper_clear_error_state();
+    if (!profiler) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    if (!stats) return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+
+    WrapperProfiler& sampler = *static_cast<WrapperProfiler*>(profiler);
+    stats->sample_count = sampler.sample_count;
+    stats->missed_count = sampler.missed_count;
+    stats->elapsed_ns = sampler.running ? std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                              std::chrono::steady_clock::now() - sampler.started)
+                                              .count()
+                                        : sampler.elapsed_ns.load();
+    stats->paused_ns = sampler.paused_ns;
+    stats->max_pause_ns = sampler.max_pause_ns;
+    stats->node_count = sampler.node_count;
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-int lldb_memory_region_info_is_readable(lldb_memory_region_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_profiler_write_profile(lldb_profiler_t profiler,
+                                               uint32_t format,
+                                               void* buffer,
+                                               size_t buffer_size,
+                                               uint64_t* required_size,
+                                               lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return 0;
-    return static_cast<lldb::SBMemoryRegionInfo*>(info)->IsReadable() ? 1 : 0;
+    wrapper_clear_error_state();
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
+    if (!profiler) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    if (!required_size || (!buffer && buffer_size > 0)) return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    if (format != LLDB_RUBY_PROFILE_FOLDED && format != LLDB_RUBY_PROFILE_PPROF) {
+        wrapper_set_invalid_argument(error, "unknown profile format");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+
+    WrapperProfiler& sampler = *static_cast<WrapperProfiler*>(profiler);
+    if (sampler.running) {
+        wrapper_set_invalid_argument(error, "profiler is still sampling");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+    sampler.stop();
+
+    std::lock_guard<std::mutex> lock(sampler.mutex);
+    std::string& encoded = sampler.encoded[format];
+    if (encoded.empty()) {
+        sampler.symbolicate();
+        encoded = format == LLDB_RUBY_PROFILE_FOLDED ? sampler.encode_folded() : sampler.encode_pprof();
+    }
+    *required_size = encoded.size();
+    if (buffer_size >= encoded.size()) std::memcpy(buffer, encoded.data(), encoded.size());
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-int lldb_memory_region_info_is_writable(lldb_memory_region_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+// ============================================================================
+// Value searches
+// ============================================================================
+
+void lldb_value_search_destroy(lldb_value_search_t search)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return 0;
-    return static_cast<lldb::SBMemoryRegionInfo*>(info)->IsWritable() ? 1 : 0;
+    delete static_cast<WrapperValueSearch*>(search);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-int lldb_memory_region_info_is_executable(lldb_memory_region_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+uint64_t lldb_value_search_get_count(lldb_value_search_t search)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return 0;
-    return static_cast<lldb::SBMemoryRegionInfo*>(info)->IsExecutable() ? 1 : 0;
+    if (!search) return 0;
+    return static_cast<WrapperValueSearch*>(search)->offsets.size();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4145,37 +8924,81 @@ int lldb_memory_region_info_is_executable(lldb_memory_region_info_t info)  LLDB_
     }
 }
 
-int lldb_memory_region_info_is_mapped(lldb_memory_region_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_value_search_narrow(lldb_value_search_t search,
+                                           uint32_t predicate,
+                                           const void* operand,
+                                           uint64_t* remaining,
+                                           lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return 0;
-    return static_cast<lldb::SBMemoryRegionInfo*>(info)->IsMapped() ? 1 : 0;
+    wrapper_clear_error_state();
+    if (!search) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
+    bool needs_operand = predicate <= LLDB_RUBY_VALUE_SEARCH_LESS;
+    if (predicate > LLDB_RUBY_VALUE_SEARCH_DECREASED || (needs_operand && !operand) || !remaining) {
+        wrapper_set_invalid_argument(error, "value search narrow requires a known predicate and its operand");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+
+    WrapperValueSearch* value_search = static_cast<WrapperValueSearch*>(search);
+    lldb::StateType state = value_search->process.GetState();
+    if (state != lldb::eStateStopped && state != lldb::eStateCrashed) {
+        wrapper_set_invalid_argument(error, "value search requires a stopped process");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+
+    wrapper_value_search_narrow(*value_search, predicate,
+                                needs_operand ? static_cast<const uint8_t*>(operand) : nullptr);
+    *remaining = value_search->offsets.size();
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-const char* lldb_memory_region_info_get_name(lldb_memory_region_info_t info)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_value_search_get_results(lldb_value_search_t search,
+                                                uint64_t* addresses,
+                                                void* values,
+                                                size_t capacity,
+                                                uint64_t* count)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!info) return nullptr;
-    return static_cast<lldb::SBMemoryRegionInfo*>(info)->GetName();
+    wrapper_clear_error_state();
+    if (!search) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    if (!count || (!addresses && capacity > 0)) return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+
+    const WrapperValueSearch& value_search = *static_cast<WrapperValueSearch*>(search);
+    *count = value_search.offsets.size();
+    size_t copied = 0;
+    for (const WrapperValueSearchPage& page : value_search.pages) {
+        for (uint64_t candidate = page.first; candidate < page.first + page.count && copied < capacity; ++candidate) {
+            addresses[copied] = page.address + value_search.offsets[candidate];
+            if (values) {
+                std::memcpy(static_cast<uint8_t*>(values) + copied * value_search.element_size,
+                            value_search.previous(static_cast<size_t>(candidate)), value_search.element_size);
+            }
+            ++copied;
+        }
+        if (copied == capacity) break;
+    }
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
@@ -4221,6 +9044,7 @@ lldb_ruby_status_t lldb_thread_step_over(lldb_thread_t thread, int run_mode, lld
     if (!thread) return LLDB_RUBY_STATUS_INVALID_HANDLE;
     try {
         lldb::SBError error;
+        wrapper_cancel_thread_prefetches(*static_cast<lldb::SBThread*>(thread));
         static_cast<lldb::SBThread*>(thread)->StepOver(static_cast<lldb::RunMode>(run_mode), error);
         return wrapper_status(error, output);
     } catch (const std::exception& exception) {
@@ -4253,6 +9077,7 @@ lldb_ruby_status_t lldb_thread_step_into(lldb_thread_t thread,
     if (!thread) return LLDB_RUBY_STATUS_INVALID_HANDLE;
     try {
         lldb::SBError error;
+        wrapper_cancel_thread_prefetches(*static_cast<lldb::SBThread*>(thread));
         static_cast<lldb::SBThread*>(thread)->StepInto(
             target_name,
             end_line,
@@ -4286,6 +9111,7 @@ lldb_ruby_status_t lldb_thread_step_out(lldb_thread_t thread, lldb_error_t outpu
     if (!thread) return LLDB_RUBY_STATUS_INVALID_HANDLE;
     try {
         lldb::SBError error;
+        wrapper_cancel_thread_prefetches(*static_cast<lldb::SBThread*>(thread));
         static_cast<lldb::SBThread*>(thread)->StepOut(error);
         return wrapper_status(error, output);
     } catch (const std::exception& exception) {
@@ -4316,6 +9142,7 @@ lldb_ruby_status_t lldb_thread_step_instruction(lldb_thread_t thread,
     if (!thread) return LLDB_RUBY_STATUS_INVALID_HANDLE;
     try {
         lldb::SBError error;
+        wrapper_cancel_thread_prefetches(*static_cast<lldb::SBThread*>(thread));
         static_cast<lldb::SBThread*>(thread)->StepInstruction(step_over != 0, error);
         return wrapper_status(error, output);
     } catch (const std::exception& exception) {
@@ -4346,6 +9173,7 @@ lldb_ruby_status_t lldb_thread_run_to_address(lldb_thread_t thread,
     if (!thread) return LLDB_RUBY_STATUS_INVALID_HANDLE;
     try {
         lldb::SBError error;
+        wrapper_cancel_thread_prefetches(*static_cast<lldb::SBThread*>(thread));
         static_cast<lldb::SBThread*>(thread)->RunToAddress(addr, error);
         return wrapper_status(error, output);
     } catch (const std::exception& exception) {
@@ -4394,7 +9222,252 @@ lldb_frame_t lldb_thread_get_frame_at_index(lldb_thread_t thread, uint32_t index
 
     if (!frame.IsValid()) return nullptr;
 
-    return static_cast<lldb_frame_t>(new lldb::SBFrame(frame));
+    return wrapper_new_frame(frame);
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+lldb_frame_t lldb_thread_get_selected_frame(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!thread) return nullptr;
+
+    lldb::SBThread* t = static_cast<lldb::SBThread*>(thread);
+    lldb::SBFrame frame = t->GetSelectedFrame();
+
+    if (!frame.IsValid()) return nullptr;
+
+    return wrapper_new_frame(frame);
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+int lldb_thread_set_selected_frame(lldb_thread_t thread, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!thread) return 0;
+    lldb::SBFrame frame = static_cast<lldb::SBThread*>(thread)->SetSelectedFrame(index);
+    return frame.IsValid() ? 1 : 0;
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+uint64_t lldb_thread_get_thread_id(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!thread) return 0;
+    return static_cast<lldb::SBThread*>(thread)->GetThreadID();
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+uint32_t lldb_thread_get_index_id(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!thread) return 0;
+    return static_cast<lldb::SBThread*>(thread)->GetIndexID();
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+const char* lldb_thread_get_name(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!thread) return nullptr;
+    return static_cast<lldb::SBThread*>(thread)->GetName();
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+const char* lldb_thread_get_queue_name(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!thread) return nullptr;
+    return static_cast<lldb::SBThread*>(thread)->GetQueueName();
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+int lldb_thread_get_stop_reason(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!thread) return static_cast<int>(lldb::eStopReasonInvalid);
+    return static_cast<int>(static_cast<lldb::SBThread*>(thread)->GetStopReason());
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+size_t lldb_thread_get_stop_description(lldb_thread_t thread, char* buffer, size_t length)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!thread) return 0;
+    return static_cast<lldb::SBThread*>(thread)->GetStopDescription(buffer, length);
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+uint64_t lldb_thread_get_stop_reason_data_count(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!thread) return 0;
+    return static_cast<lldb::SBThread*>(thread)->GetStopReasonDataCount();
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+uint64_t lldb_thread_get_stop_reason_data_at_index(lldb_thread_t thread, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!thread) return 0;
+    return static_cast<lldb::SBThread*>(thread)->GetStopReasonDataAtIndex(index);
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+int lldb_thread_is_stopped(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!thread) return 0;
+    return static_cast<lldb::SBThread*>(thread)->IsStopped() ? 1 : 0;
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+int lldb_thread_is_suspended(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!thread) return 0;
+    return static_cast<lldb::SBThread*>(thread)->IsSuspended() ? 1 : 0;
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+int lldb_thread_suspend(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!thread) return 0;
+    return static_cast<lldb::SBThread*>(thread)->Suspend() ? 1 : 0;
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+int lldb_thread_resume(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!thread) return 0;
+    return static_cast<lldb::SBThread*>(thread)->Resume() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4408,16 +9481,16 @@ lldb_frame_t lldb_thread_get_frame_at_index(lldb_thread_t thread, uint32_t index
     }
 }
 
-lldb_frame_t lldb_thread_get_selected_frame(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+lldb_process_t lldb_thread_get_process(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
     try {
     if (!thread) return nullptr;
 
     lldb::SBThread* t = static_cast<lldb::SBThread*>(thread);
-    lldb::SBFrame frame = t->GetSelectedFrame();
+    lldb::SBProcess process = t->GetProcess();
 
-    if (!frame.IsValid()) return nullptr;
+    if (!process.IsValid()) return nullptr;
 
-    return static_cast<lldb_frame_t>(new lldb::SBFrame(frame));
+    return static_cast<lldb_process_t>(new lldb::SBProcess(process));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4431,28 +9504,29 @@ lldb_frame_t lldb_thread_get_selected_frame(lldb_thread_t thread)  LLDB_WRAPPER_
     }
 }
 
-int lldb_thread_set_selected_frame(lldb_thread_t thread, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
+// ============================================================================
+// SBFrame
+// ============================================================================
+
+void lldb_frame_destroy(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!thread) return 0;
-    lldb::SBFrame frame = static_cast<lldb::SBThread*>(thread)->SetSelectedFrame(index);
-    return frame.IsValid() ? 1 : 0;
+    if (frame) {
+        delete static_cast<lldb::SBFrame*>(frame);
+    }
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-uint64_t lldb_thread_get_thread_id(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_frame_is_valid(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!thread) return 0;
-    return static_cast<lldb::SBThread*>(thread)->GetThreadID();
+    if (!frame) return 0;
+    return static_cast<lldb::SBFrame*>(frame)->IsValid() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4466,10 +9540,10 @@ uint64_t lldb_thread_get_thread_id(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT
     }
 }
 
-uint32_t lldb_thread_get_index_id(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_frame_get_function_name(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!thread) return 0;
-    return static_cast<lldb::SBThread*>(thread)->GetIndexID();
+    if (!frame) return nullptr;
+    return static_cast<lldb::SBFrame*>(frame)->GetFunctionName();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4483,10 +9557,10 @@ uint32_t lldb_thread_get_index_id(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-const char* lldb_thread_get_name(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_frame_get_display_function_name(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!thread) return nullptr;
-    return static_cast<lldb::SBThread*>(thread)->GetName();
+    if (!frame) return nullptr;
+    return static_cast<lldb::SBFrame*>(frame)->GetDisplayFunctionName();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4500,10 +9574,11 @@ const char* lldb_thread_get_name(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-const char* lldb_thread_get_queue_name(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_frame_get_line(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!thread) return nullptr;
-    return static_cast<lldb::SBThread*>(thread)->GetQueueName();
+    if (!frame) return 0;
+    lldb::SBLineEntry line_entry = static_cast<lldb::SBFrame*>(frame)->GetLineEntry();
+    return line_entry.GetLine();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4517,10 +9592,21 @@ const char* lldb_thread_get_queue_name(lldb_thread_t thread)  LLDB_WRAPPER_NOEXC
     }
 }
 
-int lldb_thread_get_stop_reason(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_frame_get_file_path(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!thread) return static_cast<int>(lldb::eStopReasonInvalid);
-    return static_cast<int>(static_cast<lldb::SBThread*>(thread)->GetStopReason());
+    if (!frame) return nullptr;
+
+    lldb::SBFrame* f = static_cast<lldb::SBFrame*>(frame);
+    lldb::SBLineEntry line_entry = f->GetLineEntry();
+    lldb::SBFileSpec file_spec = line_entry.GetFileSpec();
+
+    if (!file_spec.IsValid()) return nullptr;
+
+    if (wrapper_copy_file_spec_path(file_spec, g_temp_string)) {
+        return g_temp_string.c_str();
+    }
+
+    return nullptr;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4534,10 +9620,14 @@ int lldb_thread_get_stop_reason(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-size_t lldb_thread_get_stop_description(lldb_thread_t thread, char* buffer, size_t length)  LLDB_WRAPPER_NOEXCEPT {
+lldb_file_spec_t lldb_frame_get_file_spec(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!thread) return 0;
-    return static_cast<lldb::SBThread*>(thread)->GetStopDescription(buffer, length);
+    if (!frame) return nullptr;
+
+    lldb::SBFileSpec file_spec = static_cast<lldb::SBFrame*>(frame)->GetLineEntry().GetFileSpec();
+    if (!file_spec.IsValid()) return nullptr;
+
+    return static_cast<lldb_file_spec_t>(new lldb::SBFileSpec(file_spec));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4551,10 +9641,14 @@ size_t lldb_thread_get_stop_description(lldb_thread_t thread, char* buffer, size
     }
 }
 
-uint64_t lldb_thread_get_stop_reason_data_count(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+lldb_line_entry_t lldb_frame_get_line_entry(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!thread) return 0;
-    return static_cast<lldb::SBThread*>(thread)->GetStopReasonDataCount();
+    if (!frame) return nullptr;
+
+    lldb::SBLineEntry line_entry = static_cast<lldb::SBFrame*>(frame)->GetLineEntry();
+    if (!line_entry.IsValid()) return nullptr;
+
+    return static_cast<lldb_line_entry_t>(new lldb::SBLineEntry(line_entry));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4568,10 +9662,11 @@ uint64_t lldb_thread_get_stop_reason_data_count(lldb_thread_t thread)  LLDB_WRAP
     }
 }
 
-uint64_t lldb_thread_get_stop_reason_data_at_index(lldb_thread_t thread, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_frame_get_column(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!thread) return 0;
-    return static_cast<lldb::SBThread*>(thread)->GetStopReasonDataAtIndex(index);
+    if (!frame) return 0;
+    lldb::SBLineEntry line_entry = static_cast<lldb::SBFrame*>(frame)->GetLineEntry();
+    return line_entry.GetColumn();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4585,10 +9680,10 @@ uint64_t lldb_thread_get_stop_reason_data_at_index(lldb_thread_t thread, uint32_
     }
 }
 
-int lldb_thread_is_stopped(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+uint64_t lldb_frame_get_pc(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!thread) return 0;
-    return static_cast<lldb::SBThread*>(thread)->IsStopped() ? 1 : 0;
+    if (!frame) return LLDB_INVALID_ADDRESS;
+    return static_cast<lldb::SBFrame*>(frame)->GetPC();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4602,10 +9697,10 @@ int lldb_thread_is_stopped(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-int lldb_thread_is_suspended(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_frame_set_pc(lldb_frame_t frame, uint64_t new_pc)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!thread) return 0;
-    return static_cast<lldb::SBThread*>(thread)->IsSuspended() ? 1 : 0;
+    if (!frame) return 0;
+    return static_cast<lldb::SBFrame*>(frame)->SetPC(new_pc) ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4619,10 +9714,10 @@ int lldb_thread_is_suspended(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-int lldb_thread_suspend(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+uint64_t lldb_frame_get_sp(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!thread) return 0;
-    return static_cast<lldb::SBThread*>(thread)->Suspend() ? 1 : 0;
+    if (!frame) return LLDB_INVALID_ADDRESS;
+    return static_cast<lldb::SBFrame*>(frame)->GetSP();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4636,10 +9731,10 @@ int lldb_thread_suspend(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-int lldb_thread_resume(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+uint64_t lldb_frame_get_fp(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!thread) return 0;
-    return static_cast<lldb::SBThread*>(thread)->Resume() ? 1 : 0;
+    if (!frame) return LLDB_INVALID_ADDRESS;
+    return static_cast<lldb::SBFrame*>(frame)->GetFP();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4653,16 +9748,16 @@ int lldb_thread_resume(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-lldb_process_t lldb_thread_get_process(lldb_thread_t thread)  LLDB_WRAPPER_NOEXCEPT {
+lldb_value_t lldb_frame_find_variable(lldb_frame_t frame, const char* name)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!thread) return nullptr;
+    if (!frame || !name) return nullptr;
 
-    lldb::SBThread* t = static_cast<lldb::SBThread*>(thread);
-    lldb::SBProcess process = t->GetProcess();
+    lldb::SBFrame* f = static_cast<lldb::SBFrame*>(frame);
+    lldb::SBValue value = f->FindVariable(name);
 
-    if (!process.IsValid()) return nullptr;
+    if (!value.IsValid()) return nullptr;
 
-    return static_cast<lldb_process_t>(new lldb::SBProcess(process));
+    return wrapper_new_value(value);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4676,29 +9771,16 @@ lldb_process_t lldb_thread_get_process(lldb_thread_t thread)  LLDB_WRAPPER_NOEXC
     }
 }
 
-// ============================================================================
-// SBFrame
-// ============================================================================
-
-void lldb_frame_destroy(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+lldb_value_t lldb_frame_evaluate_expression(lldb_frame_t frame, const char* expr)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (frame) {
-        delete static_cast<lldb::SBFrame*>(frame);
-    }
+    if (!frame || !expr) return nullptr;
 
-      } catch (const std::bad_alloc&) {
-        wrapper_set_error_state("native allocation failed across the C ABI");
-    } catch (const std::exception& exception) {
-        wrapper_set_error_state(exception.what());
-    } catch (...) {
-        wrapper_set_error_state("unknown native exception across the C ABI");
-    }
-}
+    lldb::SBFrame* f = static_cast<lldb::SBFrame*>(frame);
+    lldb::SBValue value = f->EvaluateExpression(expr);
 
-int lldb_frame_is_valid(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
-    try {
-    if (!frame) return 0;
-    return static_cast<lldb::SBFrame*>(frame)->IsValid() ? 1 : 0;
+    if (!value.IsValid()) return nullptr;
+
+    return wrapper_new_value(value);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4712,10 +9794,17 @@ int lldb_frame_is_valid(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-const char* lldb_frame_get_function_name(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+lldb_value_t lldb_frame_evaluate_expression_with_options(lldb_frame_t frame,
+                                                         const char* expr,
+                                                         lldb_expression_options_t options)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame) return nullptr;
-    return static_cast<lldb::SBFrame*>(frame)->GetFunctionName();
+    if (!frame || !expr || !options) return nullptr;
+
+    lldb::SBValue value = static_cast<lldb::SBFrame*>(frame)->EvaluateExpression(
+        expr, *static_cast<lldb::SBExpressionOptions*>(options));
+    if (!value.IsValid()) return nullptr;
+
+    return wrapper_new_value(value);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4729,10 +9818,16 @@ const char* lldb_frame_get_function_name(lldb_frame_t frame)  LLDB_WRAPPER_NOEXC
     }
 }
 
-const char* lldb_frame_get_display_function_name(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+lldb_value_t lldb_frame_get_value_for_variable_path(lldb_frame_t frame, const char* path)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame) return nullptr;
-    return static_cast<lldb::SBFrame*>(frame)->GetDisplayFunctionName();
+    if (!frame || !path) return nullptr;
+
+    lldb::SBFrame* f = static_cast<lldb::SBFrame*>(frame);
+    lldb::SBValue value = f->GetValueForVariablePath(path);
+
+    if (!value.IsValid()) return nullptr;
+
+    return wrapper_new_value(value);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4746,11 +9841,10 @@ const char* lldb_frame_get_display_function_name(lldb_frame_t frame)  LLDB_WRAPP
     }
 }
 
-uint32_t lldb_frame_get_line(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_frame_get_frame_id(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
     if (!frame) return 0;
-    lldb::SBLineEntry line_entry = static_cast<lldb::SBFrame*>(frame)->GetLineEntry();
-    return line_entry.GetLine();
+    return static_cast<lldb::SBFrame*>(frame)->GetFrameID();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4764,21 +9858,16 @@ uint32_t lldb_frame_get_line(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-const char* lldb_frame_get_file_path(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+lldb_thread_t lldb_frame_get_thread(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
     if (!frame) return nullptr;
 
     lldb::SBFrame* f = static_cast<lldb::SBFrame*>(frame);
-    lldb::SBLineEntry line_entry = f->GetLineEntry();
-    lldb::SBFileSpec file_spec = line_entry.GetFileSpec();
-
-    if (!file_spec.IsValid()) return nullptr;
+    lldb::SBThread thread = f->GetThread();
 
-    if (wrapper_copy_file_spec_path(file_spec, g_temp_string)) {
-        return g_temp_string.c_str();
-    }
+    if (!thread.IsValid()) return nullptr;
 
-    return nullptr;
+    return static_cast<lldb_thread_t>(new lldb::SBThread(thread));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4792,14 +9881,12 @@ const char* lldb_frame_get_file_path(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT
     }
 }
 
-lldb_file_spec_t lldb_frame_get_file_spec(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+lldb_function_t lldb_frame_get_function(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
     if (!frame) return nullptr;
-
-    lldb::SBFileSpec file_spec = static_cast<lldb::SBFrame*>(frame)->GetLineEntry().GetFileSpec();
-    if (!file_spec.IsValid()) return nullptr;
-
-    return static_cast<lldb_file_spec_t>(new lldb::SBFileSpec(file_spec));
+    lldb::SBFunction function = static_cast<lldb::SBFrame*>(frame)->GetFunction();
+    if (!function.IsValid()) return nullptr;
+    return static_cast<lldb_function_t>(new lldb::SBFunction(function));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4813,14 +9900,12 @@ lldb_file_spec_t lldb_frame_get_file_spec(lldb_frame_t frame)  LLDB_WRAPPER_NOEX
     }
 }
 
-lldb_line_entry_t lldb_frame_get_line_entry(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+lldb_symbol_t lldb_frame_get_symbol(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
     if (!frame) return nullptr;
-
-    lldb::SBLineEntry line_entry = static_cast<lldb::SBFrame*>(frame)->GetLineEntry();
-    if (!line_entry.IsValid()) return nullptr;
-
-    return static_cast<lldb_line_entry_t>(new lldb::SBLineEntry(line_entry));
+    lldb::SBSymbol symbol = static_cast<lldb::SBFrame*>(frame)->GetSymbol();
+    if (!symbol.IsValid()) return nullptr;
+    return static_cast<lldb_symbol_t>(new lldb::SBSymbol(symbol));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4834,11 +9919,12 @@ lldb_line_entry_t lldb_frame_get_line_entry(lldb_frame_t frame)  LLDB_WRAPPER_NO
     }
 }
 
-uint32_t lldb_frame_get_column(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+lldb_compile_unit_t lldb_frame_get_compile_unit(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame) return 0;
-    lldb::SBLineEntry line_entry = static_cast<lldb::SBFrame*>(frame)->GetLineEntry();
-    return line_entry.GetColumn();
+    if (!frame) return nullptr;
+    lldb::SBCompileUnit unit = static_cast<lldb::SBFrame*>(frame)->GetCompileUnit();
+    if (!unit.IsValid()) return nullptr;
+    return static_cast<lldb_compile_unit_t>(new lldb::SBCompileUnit(unit));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4852,10 +9938,12 @@ uint32_t lldb_frame_get_column(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-uint64_t lldb_frame_get_pc(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+lldb_block_t lldb_frame_get_block(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame) return LLDB_INVALID_ADDRESS;
-    return static_cast<lldb::SBFrame*>(frame)->GetPC();
+    if (!frame) return nullptr;
+    lldb::SBBlock block = static_cast<lldb::SBFrame*>(frame)->GetBlock();
+    if (!block.IsValid()) return nullptr;
+    return static_cast<lldb_block_t>(new lldb::SBBlock(block));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4869,10 +9957,24 @@ uint64_t lldb_frame_get_pc(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-int lldb_frame_set_pc(lldb_frame_t frame, uint64_t new_pc)  LLDB_WRAPPER_NOEXCEPT {
+lldb_instruction_list_t lldb_frame_get_instruction_list(lldb_frame_t frame,
+                                                         lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame) return 0;
-    return static_cast<lldb::SBFrame*>(frame)->SetPC(new_pc) ? 1 : 0;
+    if (!frame || !target) return nullptr;
+
+    lldb::SBFrame* f = static_cast<lldb::SBFrame*>(frame);
+    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
+    lldb::SBInstructionList instructions;
+    lldb::SBFunction function = f->GetFunction();
+    if (function.IsValid()) {
+        instructions = function.GetInstructions(*t);
+    } else {
+        lldb::SBSymbol symbol = f->GetSymbol();
+        if (symbol.IsValid()) instructions = symbol.GetInstructions(*t);
+    }
+
+    if (!instructions.IsValid()) return nullptr;
+    return static_cast<lldb_instruction_list_t>(new lldb::SBInstructionList(instructions));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4886,10 +9988,14 @@ int lldb_frame_set_pc(lldb_frame_t frame, uint64_t new_pc)  LLDB_WRAPPER_NOEXCEP
     }
 }
 
-uint64_t lldb_frame_get_sp(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+lldb_symbol_context_t lldb_frame_get_symbol_context(lldb_frame_t frame, uint32_t scope)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame) return LLDB_INVALID_ADDRESS;
-    return static_cast<lldb::SBFrame*>(frame)->GetSP();
+    if (!frame) return nullptr;
+
+    lldb::SBFrame* f = static_cast<lldb::SBFrame*>(frame);
+    lldb::SBSymbolContext ctx = f->GetSymbolContext(scope);
+
+    return static_cast<lldb_symbol_context_t>(new lldb::SBSymbolContext(ctx));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4903,10 +10009,14 @@ uint64_t lldb_frame_get_sp(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-uint64_t lldb_frame_get_fp(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+lldb_value_list_t lldb_frame_get_variables(lldb_frame_t frame, int arguments, int locals, int statics, int in_scope_only)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame) return LLDB_INVALID_ADDRESS;
-    return static_cast<lldb::SBFrame*>(frame)->GetFP();
+    if (!frame) return nullptr;
+
+    lldb::SBFrame* f = static_cast<lldb::SBFrame*>(frame);
+    lldb::SBValueList list = f->GetVariables(arguments != 0, locals != 0, statics != 0, in_scope_only != 0);
+
+    return static_cast<lldb_value_list_t>(new lldb::SBValueList(list));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4920,16 +10030,14 @@ uint64_t lldb_frame_get_fp(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-lldb_value_t lldb_frame_find_variable(lldb_frame_t frame, const char* name)  LLDB_WRAPPER_NOEXCEPT {
+lldb_value_list_t lldb_frame_get_registers(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame || !name) return nullptr;
+    if (!frame) return nullptr;
 
     lldb::SBFrame* f = static_cast<lldb::SBFrame*>(frame);
-    lldb::SBValue value = f->FindVariable(name);
-
-    if (!value.IsValid()) return nullptr;
+    lldb::SBValueList list = f->GetRegisters();
 
-    return static_cast<lldb_value_t>(new lldb::SBValue(value));
+    return static_cast<lldb_value_list_t>(new lldb::SBValueList(list));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -4943,63 +10051,91 @@ lldb_value_t lldb_frame_find_variable(lldb_frame_t frame, const char* name)  LLD
     }
 }
 
-lldb_value_t lldb_frame_evaluate_expression(lldb_frame_t frame, const char* expr)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_frame_snapshot_variables(lldb_frame_t frame,
+                                                 uint32_t scope,
+                                                 uint32_t flags,
+                                                 void* buffer,
+                                                 size_t buffer_size,
+                                                 uint64_t* required_size)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame || !expr) return nullptr;
+    wrapper_clear_error_state();
+    if (!frame) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    if (!required_size || (!buffer && buffer_size > 0)) return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
 
     lldb::SBFrame* f = static_cast<lldb::SBFrame*>(frame);
-    lldb::SBValue value = f->EvaluateExpression(expr);
-
-    if (!value.IsValid()) return nullptr;
+    if (!f->IsValid()) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    lldb::SBValueList list = f->GetVariables((scope & LLDB_RUBY_FRAME_VARIABLES_ARGUMENTS) != 0,
+                                             (scope & LLDB_RUBY_FRAME_VARIABLES_LOCALS) != 0,
+                                             (scope & LLDB_RUBY_FRAME_VARIABLES_STATICS) != 0,
+                                             (scope & LLDB_RUBY_FRAME_VARIABLES_IN_SCOPE_ONLY) != 0);
 
-    return static_cast<lldb_value_t>(new lldb::SBValue(value));
+    WrapperValueTreeWriter writer{0, 0, flags, {}, {}};
+    uint32_t size = list.GetSize();
+    writer.nodes.reserve(size);
+    for (uint32_t index = 0; index < size; ++index) {
+        writer.write(list.GetValueAtIndex(index), 0);
+    }
+    return writer.copy(buffer, buffer_size, required_size);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-lldb_value_t lldb_frame_evaluate_expression_with_options(lldb_frame_t frame,
-                                                         const char* expr,
-                                                         lldb_expression_options_t options)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_frame_resolve_paths(lldb_frame_t frame,
+                                            const char* const* paths,
+                                            size_t path_count,
+                                            uint32_t flags,
+                                            void* buffer,
+                                            size_t buffer_size,
+                                            uint64_t* required_size)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame || !expr || !options) return nullptr;
-
-    lldb::SBValue value = static_cast<lldb::SBFrame*>(frame)->EvaluateExpression(
-        expr, *static_cast<lldb::SBExpressionOptions*>(options));
-    if (!value.IsValid()) return nullptr;
+    wrapper_clear_error_state();
+    if (!frame) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    if (!required_size || (!paths && path_count > 0) || (!buffer && buffer_size > 0)) {
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
 
-    return static_cast<lldb_value_t>(new lldb::SBValue(value));
+    lldb::SBFrame* f = static_cast<lldb::SBFrame*>(frame);
+    if (!f->IsValid()) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+
+    WrapperValueTreeWriter writer{0, 0, flags, {}, {}};
+    writer.nodes.reserve(path_count);
+    for (size_t index = 0; index < path_count; ++index) {
+        const char* path = paths[index];
+        if (!path) return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+        lldb::SBValue value = f->GetValueForVariablePath(path);
+        if (value.IsValid()) {
+            writer.write(value, 0);
+        } else {
+            writer.write_error(path, "variable path did not resolve");
+        }
+    }
+    return writer.copy(buffer, buffer_size, required_size);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-lldb_value_t lldb_frame_get_value_for_variable_path(lldb_frame_t frame, const char* path)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_frame_is_inlined(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame || !path) return nullptr;
-
-    lldb::SBFrame* f = static_cast<lldb::SBFrame*>(frame);
-    lldb::SBValue value = f->GetValueForVariablePath(path);
-
-    if (!value.IsValid()) return nullptr;
-
-    return static_cast<lldb_value_t>(new lldb::SBValue(value));
+    if (!frame) return 0;
+    return static_cast<lldb::SBFrame*>(frame)->IsInlined() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5013,10 +10149,10 @@ lldb_value_t lldb_frame_get_value_for_variable_path(lldb_frame_t frame, const ch
     }
 }
 
-uint32_t lldb_frame_get_frame_id(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_frame_disassemble(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame) return 0;
-    return static_cast<lldb::SBFrame*>(frame)->GetFrameID();
+    if (!frame) return nullptr;
+    return static_cast<lldb::SBFrame*>(frame)->Disassemble();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5030,16 +10166,16 @@ uint32_t lldb_frame_get_frame_id(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-lldb_thread_t lldb_frame_get_thread(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+lldb_module_t lldb_frame_get_module(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     try {
     if (!frame) return nullptr;
 
     lldb::SBFrame* f = static_cast<lldb::SBFrame*>(frame);
-    lldb::SBThread thread = f->GetThread();
+    lldb::SBModule module = f->GetModule();
 
-    if (!thread.IsValid()) return nullptr;
+    if (!module.IsValid()) return nullptr;
 
-    return static_cast<lldb_thread_t>(new lldb::SBThread(thread));
+    return static_cast<lldb_module_t>(new lldb::SBModule(module));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5053,31 +10189,29 @@ lldb_thread_t lldb_frame_get_thread(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-lldb_function_t lldb_frame_get_function(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+// ============================================================================
+// SBBreakpoint
+// ============================================================================
+
+void lldb_breakpoint_destroy(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame) return nullptr;
-    lldb::SBFunction function = static_cast<lldb::SBFrame*>(frame)->GetFunction();
-    if (!function.IsValid()) return nullptr;
-    return static_cast<lldb_function_t>(new lldb::SBFunction(function));
+    if (bp) {
+        delete static_cast<lldb::SBBreakpoint*>(bp);
+    }
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-lldb_symbol_t lldb_frame_get_symbol(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_breakpoint_is_valid(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame) return nullptr;
-    lldb::SBSymbol symbol = static_cast<lldb::SBFrame*>(frame)->GetSymbol();
-    if (!symbol.IsValid()) return nullptr;
-    return static_cast<lldb_symbol_t>(new lldb::SBSymbol(symbol));
+    if (!bp) return 0;
+    return static_cast<lldb::SBBreakpoint*>(bp)->IsValid() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5091,12 +10225,10 @@ lldb_symbol_t lldb_frame_get_symbol(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-lldb_compile_unit_t lldb_frame_get_compile_unit(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+int32_t lldb_breakpoint_get_id(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame) return nullptr;
-    lldb::SBCompileUnit unit = static_cast<lldb::SBFrame*>(frame)->GetCompileUnit();
-    if (!unit.IsValid()) return nullptr;
-    return static_cast<lldb_compile_unit_t>(new lldb::SBCompileUnit(unit));
+    if (!bp) return -1;
+    return static_cast<lldb::SBBreakpoint*>(bp)->GetID();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5110,12 +10242,10 @@ lldb_compile_unit_t lldb_frame_get_compile_unit(lldb_frame_t frame)  LLDB_WRAPPE
     }
 }
 
-lldb_block_t lldb_frame_get_block(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_breakpoint_is_enabled(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame) return nullptr;
-    lldb::SBBlock block = static_cast<lldb::SBFrame*>(frame)->GetBlock();
-    if (!block.IsValid()) return nullptr;
-    return static_cast<lldb_block_t>(new lldb::SBBlock(block));
+    if (!bp) return 0;
+    return static_cast<lldb::SBBreakpoint*>(bp)->IsEnabled() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5129,24 +10259,24 @@ lldb_block_t lldb_frame_get_block(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-lldb_instruction_list_t lldb_frame_get_instruction_list(lldb_frame_t frame,
-                                                         lldb_target_t target)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_breakpoint_set_enabled(lldb_breakpoint_t bp, int enabled)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame || !target) return nullptr;
+    if (!bp) return;
+    static_cast<lldb::SBBreakpoint*>(bp)->SetEnabled(enabled != 0);
 
-    lldb::SBFrame* f = static_cast<lldb::SBFrame*>(frame);
-    lldb::SBTarget* t = static_cast<lldb::SBTarget*>(target);
-    lldb::SBInstructionList instructions;
-    lldb::SBFunction function = f->GetFunction();
-    if (function.IsValid()) {
-        instructions = function.GetInstructions(*t);
-    } else {
-        lldb::SBSymbol symbol = f->GetSymbol();
-        if (symbol.IsValid()) instructions = symbol.GetInstructions(*t);
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
     }
+}
 
-    if (!instructions.IsValid()) return nullptr;
-    return static_cast<lldb_instruction_list_t>(new lldb::SBInstructionList(instructions));
+int lldb_breakpoint_is_one_shot(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!bp) return 0;
+    return static_cast<lldb::SBBreakpoint*>(bp)->IsOneShot() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5160,35 +10290,24 @@ lldb_instruction_list_t lldb_frame_get_instruction_list(lldb_frame_t frame,
     }
 }
 
-lldb_symbol_context_t lldb_frame_get_symbol_context(lldb_frame_t frame, uint32_t scope)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_breakpoint_set_one_shot(lldb_breakpoint_t bp, int one_shot)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame) return nullptr;
-
-    lldb::SBFrame* f = static_cast<lldb::SBFrame*>(frame);
-    lldb::SBSymbolContext ctx = f->GetSymbolContext(scope);
-
-    return static_cast<lldb_symbol_context_t>(new lldb::SBSymbolContext(ctx));
+    if (!bp) return;
+    static_cast<lldb::SBBreakpoint*>(bp)->SetOneShot(one_shot != 0);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-lldb_value_list_t lldb_frame_get_variables(lldb_frame_t frame, int arguments, int locals, int statics, int in_scope_only)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_breakpoint_get_hit_count(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame) return nullptr;
-
-    lldb::SBFrame* f = static_cast<lldb::SBFrame*>(frame);
-    lldb::SBValueList list = f->GetVariables(arguments != 0, locals != 0, statics != 0, in_scope_only != 0);
-
-    return static_cast<lldb_value_list_t>(new lldb::SBValueList(list));
+    if (!bp) return 0;
+    return static_cast<lldb::SBBreakpoint*>(bp)->GetHitCount();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5202,14 +10321,10 @@ lldb_value_list_t lldb_frame_get_variables(lldb_frame_t frame, int arguments, in
     }
 }
 
-lldb_value_list_t lldb_frame_get_registers(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_breakpoint_get_ignore_count(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame) return nullptr;
-
-    lldb::SBFrame* f = static_cast<lldb::SBFrame*>(frame);
-    lldb::SBValueList list = f->GetRegisters();
-
-    return static_cast<lldb_value_list_t>(new lldb::SBValueList(list));
+    if (!bp) return 0;
+    return static_cast<lldb::SBBreakpoint*>(bp)->GetIgnoreCount();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5223,27 +10338,24 @@ lldb_value_list_t lldb_frame_get_registers(lldb_frame_t frame)  LLDB_WRAPPER_NOE
     }
 }
 
-int lldb_frame_is_inlined(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_breakpoint_set_ignore_count(lldb_breakpoint_t bp, uint32_t count)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame) return 0;
-    return static_cast<lldb::SBFrame*>(frame)->IsInlined() ? 1 : 0;
+    if (!bp) return;
+    static_cast<lldb::SBBreakpoint*>(bp)->SetIgnoreCount(count);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-const char* lldb_frame_disassemble(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_breakpoint_get_condition(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame) return nullptr;
-    return static_cast<lldb::SBFrame*>(frame)->Disassemble();
+    if (!bp) return nullptr;
+    return static_cast<lldb::SBBreakpoint*>(bp)->GetCondition();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5257,16 +10369,24 @@ const char* lldb_frame_disassemble(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-lldb_module_t lldb_frame_get_module(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_breakpoint_set_condition(lldb_breakpoint_t bp, const char* condition)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!frame) return nullptr;
-
-    lldb::SBFrame* f = static_cast<lldb::SBFrame*>(frame);
-    lldb::SBModule module = f->GetModule();
+    if (!bp) return;
+    static_cast<lldb::SBBreakpoint*>(bp)->SetCondition(condition);
 
-    if (!module.IsValid()) return nullptr;
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+    }
+}
 
-    return static_cast<lldb_module_t>(new lldb::SBModule(module));
+uint32_t lldb_breakpoint_get_num_locations(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!bp) return 0;
+    return static_cast<lldb::SBBreakpoint*>(bp)->GetNumLocations();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5280,29 +10400,39 @@ lldb_module_t lldb_frame_get_module(lldb_frame_t frame)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-// ============================================================================
-// SBBreakpoint
-// ============================================================================
-
-void lldb_breakpoint_destroy(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
+lldb_breakpoint_location_t lldb_breakpoint_get_location_at_index(lldb_breakpoint_t bp, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (bp) {
-        delete static_cast<lldb::SBBreakpoint*>(bp);
-    }
+    if (!bp) return nullptr;
+
+    lldb::SBBreakpoint* b = static_cast<lldb::SBBreakpoint*>(bp);
+    lldb::SBBreakpointLocation loc = b->GetLocationAtIndex(index);
+
+    if (!loc.IsValid()) return nullptr;
+
+    return static_cast<lldb_breakpoint_location_t>(new lldb::SBBreakpointLocation(loc));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-int lldb_breakpoint_is_valid(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
+lldb_breakpoint_location_t lldb_breakpoint_find_location_by_id(lldb_breakpoint_t bp, int32_t id)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!bp) return 0;
-    return static_cast<lldb::SBBreakpoint*>(bp)->IsValid() ? 1 : 0;
+    if (!bp) return nullptr;
+
+    lldb::SBBreakpoint* b = static_cast<lldb::SBBreakpoint*>(bp);
+    lldb::SBBreakpointLocation loc = b->FindLocationByID(id);
+
+    if (!loc.IsValid()) return nullptr;
+
+    return static_cast<lldb_breakpoint_location_t>(new lldb::SBBreakpointLocation(loc));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5316,10 +10446,10 @@ int lldb_breakpoint_is_valid(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-int32_t lldb_breakpoint_get_id(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_breakpoint_is_hardware(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!bp) return -1;
-    return static_cast<lldb::SBBreakpoint*>(bp)->GetID();
+    if (!bp) return 0;
+    return static_cast<lldb::SBBreakpoint*>(bp)->IsHardware() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5333,10 +10463,10 @@ int32_t lldb_breakpoint_get_id(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-int lldb_breakpoint_is_enabled(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_breakpoint_get_auto_continue(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
     try {
     if (!bp) return 0;
-    return static_cast<lldb::SBBreakpoint*>(bp)->IsEnabled() ? 1 : 0;
+    return static_cast<lldb::SBBreakpoint*>(bp)->GetAutoContinue() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5350,10 +10480,10 @@ int lldb_breakpoint_is_enabled(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-void lldb_breakpoint_set_enabled(lldb_breakpoint_t bp, int enabled)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_breakpoint_set_auto_continue(lldb_breakpoint_t bp, int auto_continue)  LLDB_WRAPPER_NOEXCEPT {
     try {
     if (!bp) return;
-    static_cast<lldb::SBBreakpoint*>(bp)->SetEnabled(enabled != 0);
+    static_cast<lldb::SBBreakpoint*>(bp)->SetAutoContinue(auto_continue != 0);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5364,10 +10494,10 @@ void lldb_breakpoint_set_enabled(lldb_breakpoint_t bp, int enabled)  LLDB_WRAPPE
     }
 }
 
-int lldb_breakpoint_is_one_shot(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
+uint64_t lldb_breakpoint_get_thread_id(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
     try {
     if (!bp) return 0;
-    return static_cast<lldb::SBBreakpoint*>(bp)->IsOneShot() ? 1 : 0;
+    return static_cast<lldb::SBBreakpoint*>(bp)->GetThreadID();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5381,10 +10511,10 @@ int lldb_breakpoint_is_one_shot(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-void lldb_breakpoint_set_one_shot(lldb_breakpoint_t bp, int one_shot)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_breakpoint_set_thread_id(lldb_breakpoint_t bp, uint64_t tid)  LLDB_WRAPPER_NOEXCEPT {
     try {
     if (!bp) return;
-    static_cast<lldb::SBBreakpoint*>(bp)->SetOneShot(one_shot != 0);
+    static_cast<lldb::SBBreakpoint*>(bp)->SetThreadID(tid);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5395,10 +10525,10 @@ void lldb_breakpoint_set_one_shot(lldb_breakpoint_t bp, int one_shot)  LLDB_WRAP
     }
 }
 
-uint32_t lldb_breakpoint_get_hit_count(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_breakpoint_get_thread_name(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!bp) return 0;
-    return static_cast<lldb::SBBreakpoint*>(bp)->GetHitCount();
+    if (!bp) return nullptr;
+    return static_cast<lldb::SBBreakpoint*>(bp)->GetThreadName();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5412,10 +10542,24 @@ uint32_t lldb_breakpoint_get_hit_count(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXC
     }
 }
 
-uint32_t lldb_breakpoint_get_ignore_count(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_breakpoint_set_thread_name(lldb_breakpoint_t bp, const char* name)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!bp) return;
+    static_cast<lldb::SBBreakpoint*>(bp)->SetThreadName(name);
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+    }
+}
+
+uint32_t lldb_breakpoint_get_thread_index(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
     try {
     if (!bp) return 0;
-    return static_cast<lldb::SBBreakpoint*>(bp)->GetIgnoreCount();
+    return static_cast<lldb::SBBreakpoint*>(bp)->GetThreadIndex();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5429,10 +10573,10 @@ uint32_t lldb_breakpoint_get_ignore_count(lldb_breakpoint_t bp)  LLDB_WRAPPER_NO
     }
 }
 
-void lldb_breakpoint_set_ignore_count(lldb_breakpoint_t bp, uint32_t count)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_breakpoint_set_thread_index(lldb_breakpoint_t bp, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
     try {
     if (!bp) return;
-    static_cast<lldb::SBBreakpoint*>(bp)->SetIgnoreCount(count);
+    static_cast<lldb::SBBreakpoint*>(bp)->SetThreadIndex(index);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5443,41 +10587,46 @@ void lldb_breakpoint_set_ignore_count(lldb_breakpoint_t bp, uint32_t count)  LLD
     }
 }
 
-const char* lldb_breakpoint_get_condition(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
+// ============================================================================
+// SBBreakpointLocation
+// ============================================================================
+
+void lldb_breakpoint_location_destroy(lldb_breakpoint_location_t loc)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!bp) return nullptr;
-    return static_cast<lldb::SBBreakpoint*>(bp)->GetCondition();
+    if (loc) {
+        delete static_cast<lldb::SBBreakpointLocation*>(loc);
+    }
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-void lldb_breakpoint_set_condition(lldb_breakpoint_t bp, const char* condition)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_breakpoint_location_is_valid(lldb_breakpoint_location_t loc)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!bp) return;
-    static_cast<lldb::SBBreakpoint*>(bp)->SetCondition(condition);
+    if (!loc) return 0;
+    return static_cast<lldb::SBBreakpointLocation*>(loc)->IsValid() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-uint32_t lldb_breakpoint_get_num_locations(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
+int32_t lldb_breakpoint_location_get_id(lldb_breakpoint_location_t loc)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!bp) return 0;
-    return static_cast<lldb::SBBreakpoint*>(bp)->GetNumLocations();
+    if (!loc) return LLDB_INVALID_BREAK_ID;
+    return static_cast<lldb::SBBreakpointLocation*>(loc)->GetID();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5491,16 +10640,10 @@ uint32_t lldb_breakpoint_get_num_locations(lldb_breakpoint_t bp)  LLDB_WRAPPER_N
     }
 }
 
-lldb_breakpoint_location_t lldb_breakpoint_get_location_at_index(lldb_breakpoint_t bp, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
+uint64_t lldb_breakpoint_location_get_load_address(lldb_breakpoint_location_t loc)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!bp) return nullptr;
-
-    lldb::SBBreakpoint* b = static_cast<lldb::SBBreakpoint*>(bp);
-    lldb::SBBreakpointLocation loc = b->GetLocationAtIndex(index);
-
-    if (!loc.IsValid()) return nullptr;
-
-    return static_cast<lldb_breakpoint_location_t>(new lldb::SBBreakpointLocation(loc));
+    if (!loc) return LLDB_INVALID_ADDRESS;
+    return static_cast<lldb::SBBreakpointLocation*>(loc)->GetLoadAddress();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5514,16 +10657,14 @@ lldb_breakpoint_location_t lldb_breakpoint_get_location_at_index(lldb_breakpoint
     }
 }
 
-lldb_breakpoint_location_t lldb_breakpoint_find_location_by_id(lldb_breakpoint_t bp, int32_t id)  LLDB_WRAPPER_NOEXCEPT {
+lldb_address_t lldb_breakpoint_location_get_address(lldb_breakpoint_location_t loc)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!bp) return nullptr;
-
-    lldb::SBBreakpoint* b = static_cast<lldb::SBBreakpoint*>(bp);
-    lldb::SBBreakpointLocation loc = b->FindLocationByID(id);
+    if (!loc) return nullptr;
 
-    if (!loc.IsValid()) return nullptr;
+    lldb::SBAddress address = static_cast<lldb::SBBreakpointLocation*>(loc)->GetAddress();
+    if (!address.IsValid()) return nullptr;
 
-    return static_cast<lldb_breakpoint_location_t>(new lldb::SBBreakpointLocation(loc));
+    return static_cast<lldb_address_t>(new lldb::SBAddress(address));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5537,10 +10678,10 @@ lldb_breakpoint_location_t lldb_breakpoint_find_location_by_id(lldb_breakpoint_t
     }
 }
 
-int lldb_breakpoint_is_hardware(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_breakpoint_location_is_enabled(lldb_breakpoint_location_t loc)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!bp) return 0;
-    return static_cast<lldb::SBBreakpoint*>(bp)->IsHardware() ? 1 : 0;
+    if (!loc) return 0;
+    return static_cast<lldb::SBBreakpointLocation*>(loc)->IsEnabled() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5554,41 +10695,41 @@ int lldb_breakpoint_is_hardware(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-int lldb_breakpoint_get_auto_continue(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_breakpoint_location_set_enabled(lldb_breakpoint_location_t loc, int enabled)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!bp) return 0;
-    return static_cast<lldb::SBBreakpoint*>(bp)->GetAutoContinue() ? 1 : 0;
+    if (!loc) return;
+    static_cast<lldb::SBBreakpointLocation*>(loc)->SetEnabled(enabled != 0);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-void lldb_breakpoint_set_auto_continue(lldb_breakpoint_t bp, int auto_continue)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_breakpoint_location_get_hit_count(lldb_breakpoint_location_t loc)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!bp) return;
-    static_cast<lldb::SBBreakpoint*>(bp)->SetAutoContinue(auto_continue != 0);
+    if (!loc) return 0;
+    return static_cast<lldb::SBBreakpointLocation*>(loc)->GetHitCount();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-uint64_t lldb_breakpoint_get_thread_id(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_breakpoint_location_get_ignore_count(lldb_breakpoint_location_t loc)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!bp) return 0;
-    return static_cast<lldb::SBBreakpoint*>(bp)->GetThreadID();
+    if (!loc) return 0;
+    return static_cast<lldb::SBBreakpointLocation*>(loc)->GetIgnoreCount();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5602,10 +10743,10 @@ uint64_t lldb_breakpoint_get_thread_id(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXC
     }
 }
 
-void lldb_breakpoint_set_thread_id(lldb_breakpoint_t bp, uint64_t tid)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_breakpoint_location_set_ignore_count(lldb_breakpoint_location_t loc, uint32_t count)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!bp) return;
-    static_cast<lldb::SBBreakpoint*>(bp)->SetThreadID(tid);
+    if (!loc) return;
+    static_cast<lldb::SBBreakpointLocation*>(loc)->SetIgnoreCount(count);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5616,10 +10757,10 @@ void lldb_breakpoint_set_thread_id(lldb_breakpoint_t bp, uint64_t tid)  LLDB_WRA
     }
 }
 
-const char* lldb_breakpoint_get_thread_name(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_breakpoint_location_get_condition(lldb_breakpoint_location_t loc)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!bp) return nullptr;
-    return static_cast<lldb::SBBreakpoint*>(bp)->GetThreadName();
+    if (!loc) return nullptr;
+    return static_cast<lldb::SBBreakpointLocation*>(loc)->GetCondition();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5633,10 +10774,10 @@ const char* lldb_breakpoint_get_thread_name(lldb_breakpoint_t bp)  LLDB_WRAPPER_
     }
 }
 
-void lldb_breakpoint_set_thread_name(lldb_breakpoint_t bp, const char* name)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_breakpoint_location_set_condition(lldb_breakpoint_location_t loc, const char* condition)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!bp) return;
-    static_cast<lldb::SBBreakpoint*>(bp)->SetThreadName(name);
+    if (!loc) return;
+    static_cast<lldb::SBBreakpointLocation*>(loc)->SetCondition(condition);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5647,10 +10788,16 @@ void lldb_breakpoint_set_thread_name(lldb_breakpoint_t bp, const char* name)  LL
     }
 }
 
-uint32_t lldb_breakpoint_get_thread_index(lldb_breakpoint_t bp)  LLDB_WRAPPER_NOEXCEPT {
+lldb_breakpoint_t lldb_breakpoint_location_get_breakpoint(lldb_breakpoint_location_t loc)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!bp) return 0;
-    return static_cast<lldb::SBBreakpoint*>(bp)->GetThreadIndex();
+    if (!loc) return nullptr;
+
+    lldb::SBBreakpointLocation* l = static_cast<lldb::SBBreakpointLocation*>(loc);
+    lldb::SBBreakpoint bp = l->GetBreakpoint();
+
+    if (!bp.IsValid()) return nullptr;
+
+    return static_cast<lldb_breakpoint_t>(new lldb::SBBreakpoint(bp));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5664,10 +10811,15 @@ uint32_t lldb_breakpoint_get_thread_index(lldb_breakpoint_t bp)  LLDB_WRAPPER_NO
     }
 }
 
-void lldb_breakpoint_set_thread_index(lldb_breakpoint_t bp, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
+// ============================================================================
+// SBValue
+// ============================================================================
+
+void lldb_value_destroy(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!bp) return;
-    static_cast<lldb::SBBreakpoint*>(bp)->SetThreadIndex(index);
+    if (value) {
+        delete static_cast<lldb::SBValue*>(value);
+    }
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5678,29 +10830,27 @@ void lldb_breakpoint_set_thread_index(lldb_breakpoint_t bp, uint32_t index)  LLD
     }
 }
 
-// ============================================================================
-// SBBreakpointLocation
-// ============================================================================
-
-void lldb_breakpoint_location_destroy(lldb_breakpoint_location_t loc)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_value_is_valid(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (loc) {
-        delete static_cast<lldb::SBBreakpointLocation*>(loc);
-    }
+    if (!value) return 0;
+    return static_cast<lldb::SBValue*>(value)->IsValid() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-int lldb_breakpoint_location_is_valid(lldb_breakpoint_location_t loc)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_value_get_name(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!loc) return 0;
-    return static_cast<lldb::SBBreakpointLocation*>(loc)->IsValid() ? 1 : 0;
+    if (!value) return nullptr;
+    return static_cast<lldb::SBValue*>(value)->GetName();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5714,10 +10864,10 @@ int lldb_breakpoint_location_is_valid(lldb_breakpoint_location_t loc)  LLDB_WRAP
     }
 }
 
-int32_t lldb_breakpoint_location_get_id(lldb_breakpoint_location_t loc)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_value_get_value(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!loc) return LLDB_INVALID_BREAK_ID;
-    return static_cast<lldb::SBBreakpointLocation*>(loc)->GetID();
+    if (!value) return nullptr;
+    return static_cast<lldb::SBValue*>(value)->GetValue();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5731,10 +10881,10 @@ int32_t lldb_breakpoint_location_get_id(lldb_breakpoint_location_t loc)  LLDB_WR
     }
 }
 
-uint64_t lldb_breakpoint_location_get_load_address(lldb_breakpoint_location_t loc)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_value_get_summary(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!loc) return LLDB_INVALID_ADDRESS;
-    return static_cast<lldb::SBBreakpointLocation*>(loc)->GetLoadAddress();
+    if (!value) return nullptr;
+    return static_cast<lldb::SBValue*>(value)->GetSummary();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5748,14 +10898,10 @@ uint64_t lldb_breakpoint_location_get_load_address(lldb_breakpoint_location_t lo
     }
 }
 
-lldb_address_t lldb_breakpoint_location_get_address(lldb_breakpoint_location_t loc)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_value_get_type_name(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!loc) return nullptr;
-
-    lldb::SBAddress address = static_cast<lldb::SBBreakpointLocation*>(loc)->GetAddress();
-    if (!address.IsValid()) return nullptr;
-
-    return static_cast<lldb_address_t>(new lldb::SBAddress(address));
+    if (!value) return nullptr;
+    return static_cast<lldb::SBValue*>(value)->GetTypeName();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5769,10 +10915,16 @@ lldb_address_t lldb_breakpoint_location_get_address(lldb_breakpoint_location_t l
     }
 }
 
-int lldb_breakpoint_location_is_enabled(lldb_breakpoint_location_t loc)  LLDB_WRAPPER_NOEXCEPT {
+lldb_type_t lldb_value_get_type(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!loc) return 0;
-    return static_cast<lldb::SBBreakpointLocation*>(loc)->IsEnabled() ? 1 : 0;
+    if (!value) return nullptr;
+
+    lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
+    lldb::SBType type = v->GetType();
+
+    if (!type.IsValid()) return nullptr;
+
+    return static_cast<lldb_type_t>(new lldb::SBType(type));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5786,24 +10938,33 @@ int lldb_breakpoint_location_is_enabled(lldb_breakpoint_location_t loc)  LLDB_WR
     }
 }
 
-void lldb_breakpoint_location_set_enabled(lldb_breakpoint_location_t loc, int enabled)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_value_get_num_children(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!loc) return;
-    static_cast<lldb::SBBreakpointLocation*>(loc)->SetEnabled(enabled != 0);
+    if (!value) return 0;
+    return static_cast<lldb::SBValue*>(value)->GetNumChildren();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-uint32_t lldb_breakpoint_location_get_hit_count(lldb_breakpoint_location_t loc)  LLDB_WRAPPER_NOEXCEPT {
+lldb_value_t lldb_value_get_child_at_index(lldb_value_t value, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!loc) return 0;
-    return static_cast<lldb::SBBreakpointLocation*>(loc)->GetHitCount();
+    if (!value) return nullptr;
+
+    lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
+    lldb::SBValue child = v->GetChildAtIndex(index);
+
+    if (!child.IsValid()) return nullptr;
+
+    return wrapper_new_value(child);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5817,10 +10978,16 @@ uint32_t lldb_breakpoint_location_get_hit_count(lldb_breakpoint_location_t loc)
     }
 }
 
-uint32_t lldb_breakpoint_location_get_ignore_count(lldb_breakpoint_location_t loc)  LLDB_WRAPPER_NOEXCEPT {
-    try {
-    if (!loc) return 0;
-    return static_cast<lldb::SBBreakpointLocation*>(loc)->GetIgnoreCount();
+lldb_value_t lldb_value_get_child_member_with_name(lldb_value_t value, const char* name)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!value || !name) return nullptr;
+
+    lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
+    lldb::SBValue child = v->GetChildMemberWithName(name);
+
+    if (!child.IsValid()) return nullptr;
+
+    return wrapper_new_value(child);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5834,24 +11001,39 @@ uint32_t lldb_breakpoint_location_get_ignore_count(lldb_breakpoint_location_t lo
     }
 }
 
-void lldb_breakpoint_location_set_ignore_count(lldb_breakpoint_location_t loc, uint32_t count)  LLDB_WRAPPER_NOEXCEPT {
+int64_t lldb_value_get_value_as_signed(lldb_value_t value, lldb_error_t output, int64_t fail_value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!loc) return;
-    static_cast<lldb::SBBreakpointLocation*>(loc)->SetIgnoreCount(count);
+    if (!value) {
+        wrapper_set_invalid_argument(output ? static_cast<lldb::SBError*>(output) : nullptr,
+                                     "invalid SBValue handle");
+        return fail_value;
+    }
+    lldb::SBError local_error;
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : &local_error;
+    return static_cast<lldb::SBValue*>(value)->GetValueAsSigned(*error, fail_value);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-const char* lldb_breakpoint_location_get_condition(lldb_breakpoint_location_t loc)  LLDB_WRAPPER_NOEXCEPT {
+uint64_t lldb_value_get_value_as_unsigned(lldb_value_t value, lldb_error_t output, uint64_t fail_value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!loc) return nullptr;
-    return static_cast<lldb::SBBreakpointLocation*>(loc)->GetCondition();
+    if (!value) {
+        wrapper_set_invalid_argument(output ? static_cast<lldb::SBError*>(output) : nullptr,
+                                     "invalid SBValue handle");
+        return fail_value;
+    }
+    lldb::SBError local_error;
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : &local_error;
+    return static_cast<lldb::SBValue*>(value)->GetValueAsUnsigned(*error, fail_value);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5865,30 +11047,27 @@ const char* lldb_breakpoint_location_get_condition(lldb_breakpoint_location_t lo
     }
 }
 
-void lldb_breakpoint_location_set_condition(lldb_breakpoint_location_t loc, const char* condition)  LLDB_WRAPPER_NOEXCEPT {
+uint64_t lldb_value_get_byte_size(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!loc) return;
-    static_cast<lldb::SBBreakpointLocation*>(loc)->SetCondition(condition);
+    if (!value) return 0;
+    return static_cast<lldb::SBValue*>(value)->GetByteSize();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-lldb_breakpoint_t lldb_breakpoint_location_get_breakpoint(lldb_breakpoint_location_t loc)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_value_might_have_children(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!loc) return nullptr;
-
-    lldb::SBBreakpointLocation* l = static_cast<lldb::SBBreakpointLocation*>(loc);
-    lldb::SBBreakpoint bp = l->GetBreakpoint();
-
-    if (!bp.IsValid()) return nullptr;
-
-    return static_cast<lldb_breakpoint_t>(new lldb::SBBreakpoint(bp));
+    if (!value) return 0;
+    return static_cast<lldb::SBValue*>(value)->MightHaveChildren() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5902,29 +11081,37 @@ lldb_breakpoint_t lldb_breakpoint_location_get_breakpoint(lldb_breakpoint_locati
     }
 }
 
-// ============================================================================
-// SBValue
-// ============================================================================
-
-void lldb_value_destroy(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_value_get_error(lldb_value_t value, lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (value) {
-        delete static_cast<lldb::SBValue*>(value);
+    if (!value) return 0;
+    lldb::SBError err = static_cast<lldb::SBValue*>(value)->GetError();
+    if (error) {
+        *static_cast<lldb::SBError*>(error) = err;
     }
+    return err.Fail() ? 0 : 1;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
+        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
     }
 }
 
-int lldb_value_is_valid(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
+lldb_value_t lldb_value_dereference(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value) return 0;
-    return static_cast<lldb::SBValue*>(value)->IsValid() ? 1 : 0;
+    if (!value) return nullptr;
+
+    lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
+    lldb::SBValue deref = v->Dereference();
+
+    if (!deref.IsValid()) return nullptr;
+
+    return wrapper_new_value(deref);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5938,10 +11125,16 @@ int lldb_value_is_valid(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-const char* lldb_value_get_name(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
+lldb_value_t lldb_value_address_of(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     try {
     if (!value) return nullptr;
-    return static_cast<lldb::SBValue*>(value)->GetName();
+
+    lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
+    lldb::SBValue addr = v->AddressOf();
+
+    if (!addr.IsValid()) return nullptr;
+
+    return wrapper_new_value(addr);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5955,10 +11148,17 @@ const char* lldb_value_get_name(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-const char* lldb_value_get_value(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
+lldb_value_t lldb_value_cast(lldb_value_t value, lldb_type_t type)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value) return nullptr;
-    return static_cast<lldb::SBValue*>(value)->GetValue();
+    if (!value || !type) return nullptr;
+
+    lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
+    lldb::SBType* t = static_cast<lldb::SBType*>(type);
+    lldb::SBValue casted = v->Cast(*t);
+
+    if (!casted.IsValid()) return nullptr;
+
+    return wrapper_new_value(casted);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5972,10 +11172,10 @@ const char* lldb_value_get_value(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-const char* lldb_value_get_summary(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
+uint64_t lldb_value_get_load_address(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value) return nullptr;
-    return static_cast<lldb::SBValue*>(value)->GetSummary();
+    if (!value) return LLDB_INVALID_ADDRESS;
+    return static_cast<lldb::SBValue*>(value)->GetLoadAddress();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -5989,10 +11189,10 @@ const char* lldb_value_get_summary(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-const char* lldb_value_get_type_name(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_value_get_value_type(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value) return nullptr;
-    return static_cast<lldb::SBValue*>(value)->GetTypeName();
+    if (!value) return static_cast<int>(lldb::eValueTypeInvalid);
+    return static_cast<int>(static_cast<lldb::SBValue*>(value)->GetValueType());
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -6006,16 +11206,27 @@ const char* lldb_value_get_type_name(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT
     }
 }
 
-lldb_type_t lldb_value_get_type(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_value_set_value_from_cstring(lldb_value_t value, const char* str, lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value) return nullptr;
+    if (!value || !str) return 0;
 
     lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
-    lldb::SBType type = v->GetType();
-
-    if (!type.IsValid()) return nullptr;
+    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
+    lldb::SBError local_error;
 
-    return static_cast<lldb_type_t>(new lldb::SBType(type));
+    bool updated = v->SetValueFromCString(str, err ? *err : local_error);
+    lldb::SBProcess process = v->GetProcess();
+    if (process.IsValid()) {
+        // The new value lands in inferior memory (or a register), so cached
+        // pages covering it are stale; without a load address drop them all.
+        lldb::addr_t address = v->GetLoadAddress();
+        if (address != LLDB_INVALID_ADDRESS) {
+            wrapper_invalidate_page_cache(process, address, std::max<uint64_t>(v->GetByteSize(), 1));
+        } else {
+            wrapper_flush_page_cache(process);
+        }
+    }
+    return updated ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -6029,10 +11240,17 @@ lldb_type_t lldb_value_get_type(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-uint32_t lldb_value_get_num_children(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
+lldb_value_t lldb_value_create_child_at_offset(lldb_value_t value, const char* name, lldb_type_t type, uint32_t offset)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value) return 0;
-    return static_cast<lldb::SBValue*>(value)->GetNumChildren();
+    if (!value || !type) return nullptr;
+
+    lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
+    lldb::SBType* t = static_cast<lldb::SBType*>(type);
+    lldb::SBValue child = v->CreateChildAtOffset(name, offset, *t);
+
+    if (!child.IsValid()) return nullptr;
+
+    return wrapper_new_value(child);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -6046,16 +11264,17 @@ uint32_t lldb_value_get_num_children(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT
     }
 }
 
-lldb_value_t lldb_value_get_child_at_index(lldb_value_t value, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
+lldb_value_t lldb_value_create_value_from_address(lldb_value_t value, const char* name, uint64_t addr, lldb_type_t type)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value) return nullptr;
+    if (!value || !type) return nullptr;
 
     lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
-    lldb::SBValue child = v->GetChildAtIndex(index);
+    lldb::SBType* t = static_cast<lldb::SBType*>(type);
+    lldb::SBValue created = v->CreateValueFromAddress(name, addr, *t);
 
-    if (!child.IsValid()) return nullptr;
+    if (!created.IsValid()) return nullptr;
 
-    return static_cast<lldb_value_t>(new lldb::SBValue(child));
+    return wrapper_new_value(created);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -6069,16 +11288,16 @@ lldb_value_t lldb_value_get_child_at_index(lldb_value_t value, uint32_t index)
     }
 }
 
-lldb_value_t lldb_value_get_child_member_with_name(lldb_value_t value, const char* name)  LLDB_WRAPPER_NOEXCEPT {
+lldb_value_t lldb_value_create_value_from_expression(lldb_value_t value, const char* name, const char* expr)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value || !name) return nullptr;
+    if (!value || !name || !expr) return nullptr;
 
     lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
-    lldb::SBValue child = v->GetChildMemberWithName(name);
+    lldb::SBValue created = v->CreateValueFromExpression(name, expr);
 
-    if (!child.IsValid()) return nullptr;
+    if (!created.IsValid()) return nullptr;
 
-    return static_cast<lldb_value_t>(new lldb::SBValue(child));
+    return wrapper_new_value(created);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -6092,16 +11311,19 @@ lldb_value_t lldb_value_get_child_member_with_name(lldb_value_t value, const cha
     }
 }
 
-int64_t lldb_value_get_value_as_signed(lldb_value_t value, lldb_error_t output, int64_t fail_value)  LLDB_WRAPPER_NOEXCEPT {
+lldb_watchpoint_t lldb_value_watch(lldb_value_t value, int resolve_location, int read, int write, lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value) {
-        wrapper_set_invalid_argument(output ? static_cast<lldb::SBError*>(output) : nullptr,
-                                     "invalid SBValue handle");
-        return fail_value;
-    }
+    if (!value) return nullptr;
+
+    lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
+    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
     lldb::SBError local_error;
-    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : &local_error;
-    return static_cast<lldb::SBValue*>(value)->GetValueAsSigned(*error, fail_value);
+
+    lldb::SBWatchpoint wp = v->Watch(resolve_location != 0, read != 0, write != 0, err ? *err : local_error);
+
+    if (!wp.IsValid()) return nullptr;
+
+    return static_cast<lldb_watchpoint_t>(new lldb::SBWatchpoint(wp));
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -6115,16 +11337,15 @@ int64_t lldb_value_get_value_as_signed(lldb_value_t value, lldb_error_t output,
     }
 }
 
-uint64_t lldb_value_get_value_as_unsigned(lldb_value_t value, lldb_error_t output, uint64_t fail_value)  LLDB_WRAPPER_NOEXCEPT {
+const char* lldb_value_get_expression_path(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value) {
-        wrapper_set_invalid_argument(output ? static_cast<lldb::SBError*>(output) : nullptr,
-                                     "invalid SBValue handle");
-        return fail_value;
-    }
-    lldb::SBError local_error;
-    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : &local_error;
-    return static_cast<lldb::SBValue*>(value)->GetValueAsUnsigned(*error, fail_value);
+    if (!value) return nullptr;
+
+    static thread_local std::string expr_path;
+    lldb::SBStream stream;
+    static_cast<lldb::SBValue*>(value)->GetExpressionPath(stream);
+    expr_path = stream.GetData();
+    return expr_path.c_str();
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -6138,10 +11359,10 @@ uint64_t lldb_value_get_value_as_unsigned(lldb_value_t value, lldb_error_t outpu
     }
 }
 
-uint64_t lldb_value_get_byte_size(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
+int lldb_value_is_pointer_type(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     try {
     if (!value) return 0;
-    return static_cast<lldb::SBValue*>(value)->GetByteSize();
+    return static_cast<lldb::SBValue*>(value)->TypeIsPointerType() ? 1 : 0;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -6155,31 +11376,44 @@ uint64_t lldb_value_get_byte_size(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-int lldb_value_might_have_children(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_value_serialize(lldb_value_t value,
+                                        uint32_t max_depth,
+                                        uint32_t max_children,
+                                        uint32_t flags,
+                                        void* buffer,
+                                        size_t buffer_size,
+                                        uint64_t* required_size)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value) return 0;
-    return static_cast<lldb::SBValue*>(value)->MightHaveChildren() ? 1 : 0;
+    wrapper_clear_error_state();
+    if (!value) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    if (!required_size || (!buffer && buffer_size > 0)) return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+
+    WrapperValueTreeWriter writer{max_depth, max_children, flags, {}, {}};
+    writer.write(*static_cast<lldb::SBValue*>(value), 0);
+    return writer.copy(buffer, buffer_size, required_size);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-int lldb_value_get_error(lldb_value_t value, lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
+lldb_value_children_cursor_t lldb_value_children_cursor_create(lldb_value_t value, uint32_t flags)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value) return 0;
-    lldb::SBError err = static_cast<lldb::SBValue*>(value)->GetError();
-    if (error) {
-        *static_cast<lldb::SBError*>(error) = err;
-    }
-    return err.Fail() ? 0 : 1;
+    wrapper_clear_error_state();
+    if (!value) return nullptr;
+
+    std::unique_ptr<WrapperChildrenCursor> cursor(new WrapperChildrenCursor{*static_cast<lldb::SBValue*>(value)});
+    if (!cursor->value.IsValid()) return nullptr;
+    cursor->flags = flags;
+    cursor->num_children = cursor->value.GetNumChildren();
+    return static_cast<lldb_value_children_cursor_t>(cursor.release());
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -6193,39 +11427,23 @@ int lldb_value_get_error(lldb_value_t value, lldb_error_t error)  LLDB_WRAPPER_N
     }
 }
 
-lldb_value_t lldb_value_dereference(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_value_children_cursor_destroy(lldb_value_children_cursor_t cursor)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value) return nullptr;
-
-    lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
-    lldb::SBValue deref = v->Dereference();
-
-    if (!deref.IsValid()) return nullptr;
-
-    return static_cast<lldb_value_t>(new lldb::SBValue(deref));
+    delete static_cast<WrapperChildrenCursor*>(cursor);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-lldb_value_t lldb_value_address_of(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_value_children_cursor_get_num_children(lldb_value_children_cursor_t cursor)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value) return nullptr;
-
-    lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
-    lldb::SBValue addr = v->AddressOf();
-
-    if (!addr.IsValid()) return nullptr;
-
-    return static_cast<lldb_value_t>(new lldb::SBValue(addr));
+    if (!cursor) return 0;
+    return static_cast<WrapperChildrenCursor*>(cursor)->num_children;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -6239,17 +11457,10 @@ lldb_value_t lldb_value_address_of(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-lldb_value_t lldb_value_cast(lldb_value_t value, lldb_type_t type)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_value_children_cursor_get_position(lldb_value_children_cursor_t cursor)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value || !type) return nullptr;
-
-    lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
-    lldb::SBType* t = static_cast<lldb::SBType*>(type);
-    lldb::SBValue casted = v->Cast(*t);
-
-    if (!casted.IsValid()) return nullptr;
-
-    return static_cast<lldb_value_t>(new lldb::SBValue(casted));
+    if (!cursor) return 0;
+    return static_cast<WrapperChildrenCursor*>(cursor)->position;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -6263,27 +11474,57 @@ lldb_value_t lldb_value_cast(lldb_value_t value, lldb_type_t type)  LLDB_WRAPPER
     }
 }
 
-uint64_t lldb_value_get_load_address(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_value_children_cursor_next_batch(lldb_value_children_cursor_t cursor,
+                                                         uint32_t max_count,
+                                                         void* buffer,
+                                                         size_t buffer_size,
+                                                         uint64_t* required_size)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value) return LLDB_INVALID_ADDRESS;
-    return static_cast<lldb::SBValue*>(value)->GetLoadAddress();
+    wrapper_clear_error_state();
+    if (!cursor) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    if (!required_size || (!buffer && buffer_size > 0)) return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+
+    WrapperChildrenCursor* c = static_cast<WrapperChildrenCursor*>(cursor);
+    if (!c->has_pending) {
+        c->pending = WrapperValueTreeWriter{0, 0, c->flags, {}, {}};
+        uint32_t count = std::min(max_count, c->num_children - c->position);
+        c->pending.nodes.reserve(count);
+        for (uint32_t index = c->position; index < c->position + count; ++index) {
+            c->pending.write(c->value.GetChildAtIndex(index), 0);
+        }
+        c->has_pending = true;
+    }
+
+    lldb_ruby_status_t status = c->pending.copy(buffer, buffer_size, required_size);
+    if (status == LLDB_RUBY_STATUS_OK && buffer_size >= *required_size) {
+        c->position += static_cast<uint32_t>(c->pending.nodes.size());
+        c->pending = WrapperValueTreeWriter{0, 0, c->flags, {}, {}};
+        c->has_pending = false;
+    }
+    return status;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-int lldb_value_get_value_type(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
+lldb_value_t lldb_value_get_non_synthetic_value(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value) return static_cast<int>(lldb::eValueTypeInvalid);
-    return static_cast<int>(static_cast<lldb::SBValue*>(value)->GetValueType());
+    if (!value) return nullptr;
+
+    lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
+    lldb::SBValue non_synth = v->GetNonSyntheticValue();
+
+    if (!non_synth.IsValid()) return nullptr;
+
+    return wrapper_new_value(non_synth);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -6297,15 +11538,28 @@ int lldb_value_get_value_type(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-int lldb_value_set_value_from_cstring(lldb_value_t value, const char* str, lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
+uint64_t lldb_value_get_data(lldb_value_t value, void* buffer, uint64_t length, lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value || !str) return 0;
+    wrapper_clear_error_state();
+    if (!value) {
+        wrapper_set_invalid_argument(output ? static_cast<lldb::SBError*>(output) : nullptr, "invalid SBValue handle");
+        return 0;
+    }
 
     lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
-    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
-    lldb::SBError local_error;
+    lldb::SBData data = v->GetData();
+    if (!data.IsValid()) {
+        lldb::SBError value_error = v->GetError();
+        wrapper_copy_error(output, value_error);
+        return 0;
+    }
+    uint64_t size = data.GetByteSize();
+    if (!buffer || length == 0) return size;
 
-    return v->SetValueFromCString(str, err ? *err : local_error) ? 1 : 0;
+    lldb::SBError read_error;
+    size_t written = data.ReadRawData(read_error, 0, buffer, static_cast<size_t>(std::min(size, length)));
+    wrapper_copy_error(output, read_error);
+    return written;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -6319,64 +11573,157 @@ int lldb_value_set_value_from_cstring(lldb_value_t value, const char* str, lldb_
     }
 }
 
-lldb_value_t lldb_value_create_child_at_offset(lldb_value_t value, const char* name, lldb_type_t type, uint32_t offset)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_value_get_data_as(lldb_value_t value,
+                                          uint32_t element_type,
+                                          void* buffer,
+                                          size_t buffer_size,
+                                          uint64_t* element_count,
+                                          lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value || !type) return nullptr;
+    wrapper_clear_error_state();
+    if (!value) return LLDB_RUBY_STATUS_INVALID_HANDLE;
 
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
     lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
-    lldb::SBType* t = static_cast<lldb::SBType*>(type);
-    lldb::SBValue child = v->CreateChildAtOffset(name, offset, *t);
-
-    if (!child.IsValid()) return nullptr;
+    lldb::SBData data = v->GetData();
+    if (!data.IsValid()) {
+        lldb::SBError value_error = v->GetError();
+        if (value_error.Fail()) return wrapper_status(value_error, output);
+    }
+    size_t source_size = wrapper_element_source_size(element_type, data.IsValid() ? data.GetAddressByteSize() : 0);
+    if (source_size == 0 || !element_count || (!buffer && buffer_size > 0)) {
+        wrapper_set_invalid_argument(error, "data decode requires a known element type and an element counter");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+
+    size_t destination_size = wrapper_element_host_size(element_type);
+    size_t size = data.IsValid() ? data.GetByteSize() : 0;
+    *element_count = size / source_size;
+    if (*element_count == 0 || buffer_size / destination_size < *element_count) return LLDB_RUBY_STATUS_OK;
+
+    size_t count = static_cast<size_t>(*element_count);
+    bool swap = source_size > 1 && (data.GetByteOrder() == lldb::eByteOrderBig) == wrapper_host_is_little_endian();
+    uint8_t* destination = static_cast<uint8_t*>(buffer);
+    lldb::SBError read_error;
+    if (destination_size == source_size) {
+        if (data.ReadRawData(read_error, 0, destination, count * source_size) < count * source_size) {
+            if (read_error.Success()) read_error.SetErrorString("value data read was incomplete");
+            return wrapper_status(read_error, output);
+        }
+        if (swap) wrapper_swap_elements(destination, source_size, count);
+        return LLDB_RUBY_STATUS_OK;
+    }
 
-    return static_cast<lldb_value_t>(new lldb::SBValue(child));
+    std::vector<uint8_t> raw(count * source_size);
+    if (data.ReadRawData(read_error, 0, raw.data(), raw.size()) < raw.size()) {
+        if (read_error.Success()) read_error.SetErrorString("value data read was incomplete");
+        return wrapper_status(read_error, output);
+    }
+    for (size_t index = 0; index < count; ++index) {
+        wrapper_decode_element(raw.data() + index * source_size, source_size, swap,
+                               destination + index * destination_size, destination_size);
+    }
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-lldb_value_t lldb_value_create_value_from_address(lldb_value_t value, const char* name, uint64_t addr, lldb_type_t type)  LLDB_WRAPPER_NOEXCEPT {
-    try {
-    if (!value || !type) return nullptr;
-
-    lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
-    lldb::SBType* t = static_cast<lldb::SBType*>(type);
-    lldb::SBValue created = v->CreateValueFromAddress(name, addr, *t);
+// ============================================================================
+// Container fast path
+// ============================================================================
 
-    if (!created.IsValid()) return nullptr;
+lldb_ruby_status_t lldb_value_get_container_info(lldb_value_t value, lldb_ruby_container_info_t* info)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    wrapper_clear_error_state();
+    if (!value) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    if (!info) return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
 
-    return static_cast<lldb_value_t>(new lldb::SBValue(created));
+    WrapperContainer container;
+    bool recognized = wrapper_recognize_container(*static_cast<lldb::SBValue*>(value), container);
+    *info = recognized ? container.info : lldb_ruby_container_info_t{};
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
-lldb_value_t lldb_value_create_value_from_expression(lldb_value_t value, const char* name, const char* expr)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_value_read_container(lldb_value_t value,
+                                             uint64_t start,
+                                             uint64_t count,
+                                             void* buffer,
+                                             size_t buffer_size,
+                                             uint64_t* required_size,
+                                             lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value || !name || !expr) return nullptr;
+    wrapper_clear_error_state();
+    if (!value) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
+    if (!required_size || (!buffer && buffer_size > 0)) {
+        wrapper_set_invalid_argument(error, "container read requires a buffer and a required size");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+
+    lldb::SBValue& sb_value = *static_cast<lldb::SBValue*>(value);
+    WrapperContainer container;
+    if (!wrapper_recognize_container(sb_value, container)) {
+        wrapper_set_invalid_argument(error, "value is not a container with a native fast path");
+        return LLDB_RUBY_STATUS_UNSUPPORTED;
+    }
+    const lldb_ruby_container_info_t& info = container.info;
+    uint64_t stride = info.element_size + info.mapped_size;
+    uint64_t elements = start < info.count ? std::min(count, info.count - start) : 0;
+    if (elements > SIZE_MAX / stride) {
+        wrapper_set_invalid_argument(error, "container range does not fit in memory");
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+    *required_size = elements * stride;
+    if (elements == 0 || buffer_size < *required_size) return LLDB_RUBY_STATUS_OK;
+
+    lldb::SBProcess process = sb_value.GetProcess();
+    lldb::SBError read_error;
+    *required_size = wrapper_read_container(container, process, start, elements, static_cast<uint8_t*>(buffer),
+                                            read_error);
+    if (*required_size == 0) return wrapper_status(read_error, output);
+    return LLDB_RUBY_STATUS_OK;
 
-    lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
-    lldb::SBValue created = v->CreateValueFromExpression(name, expr);
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    }
+}
 
-    if (!created.IsValid()) return nullptr;
+// ============================================================================
+// Value watch sets
+// ============================================================================
 
-    return static_cast<lldb_value_t>(new lldb::SBValue(created));
+lldb_value_watch_set_t lldb_value_watch_set_create(void)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    wrapper_clear_error_state();
+    return static_cast<lldb_value_watch_set_t>(new WrapperValueWatchSet());
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -6390,58 +11737,53 @@ lldb_value_t lldb_value_create_value_from_expression(lldb_value_t value, const c
     }
 }
 
-lldb_watchpoint_t lldb_value_watch(lldb_value_t value, int resolve_location, int read, int write, lldb_error_t error)  LLDB_WRAPPER_NOEXCEPT {
+void lldb_value_watch_set_destroy(lldb_value_watch_set_t set)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value) return nullptr;
-
-    lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
-    lldb::SBError* err = error ? static_cast<lldb::SBError*>(error) : nullptr;
-    lldb::SBError local_error;
-
-    lldb::SBWatchpoint wp = v->Watch(resolve_location != 0, read != 0, write != 0, err ? *err : local_error);
-
-    if (!wp.IsValid()) return nullptr;
-
-    return static_cast<lldb_watchpoint_t>(new lldb::SBWatchpoint(wp));
+    delete static_cast<WrapperValueWatchSet*>(set);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
     }
 }
 
-const char* lldb_value_get_expression_path(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_value_watch_set_add(lldb_value_watch_set_t set, const char* path)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value) return nullptr;
+    wrapper_clear_error_state();
+    if (!set || !path) return UINT32_MAX;
 
-    static thread_local std::string expr_path;
-    lldb::SBStream stream;
-    static_cast<lldb::SBValue*>(value)->GetExpressionPath(stream);
-    expr_path = stream.GetData();
-    return expr_path.c_str();
+    WrapperValueWatchSet* s = static_cast<WrapperValueWatchSet*>(set);
+    s->paths.emplace_back(path);
+    try {
+        s->states.emplace_back();
+    } catch (...) {
+        // Keep paths and states in step when the second append fails.
+        s->paths.pop_back();
+        throw;
+    }
+    s->has_pending = false;
+    return static_cast<uint32_t>(s->paths.size() - 1);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return UINT32_MAX;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return UINT32_MAX;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return UINT32_MAX;
     }
 }
 
-int lldb_value_is_pointer_type(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
+uint32_t lldb_value_watch_set_get_count(lldb_value_watch_set_t set)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value) return 0;
-    return static_cast<lldb::SBValue*>(value)->TypeIsPointerType() ? 1 : 0;
+    wrapper_clear_error_state();
+    if (!set) return 0;
+    return static_cast<uint32_t>(static_cast<WrapperValueWatchSet*>(set)->paths.size());
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -6455,26 +11797,71 @@ int lldb_value_is_pointer_type(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
-lldb_value_t lldb_value_get_non_synthetic_value(lldb_value_t value)  LLDB_WRAPPER_NOEXCEPT {
+lldb_ruby_status_t lldb_value_watch_set_update(lldb_value_watch_set_t set,
+                                              lldb_frame_t frame,
+                                              lldb_ruby_value_change_t* changes,
+                                              size_t capacity,
+                                              size_t* change_count,
+                                              void* buffer,
+                                              size_t buffer_size,
+                                              uint64_t* required_size)  LLDB_WRAPPER_NOEXCEPT {
     try {
-    if (!value) return nullptr;
-
-    lldb::SBValue* v = static_cast<lldb::SBValue*>(value);
-    lldb::SBValue non_synth = v->GetNonSyntheticValue();
+    wrapper_clear_error_state();
+    if (!set || !frame) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    if (!change_count || !required_size || (!changes && capacity > 0) || (!buffer && buffer_size > 0)) {
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+
+    WrapperValueWatchSet* s = static_cast<WrapperValueWatchSet*>(set);
+    lldb::SBFrame f = *static_cast<lldb::SBFrame*>(frame);
+    if (!f.IsValid()) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+
+    uint32_t stop_id = f.GetThread().GetProcess().GetStopID(true);
+    uint64_t cfa = f.GetCFA();
+    uint32_t frame_id = f.GetFrameID();
+    if (!s->has_pending || s->pending_stop_id != stop_id || s->pending_cfa != cfa || s->pending_frame_id != frame_id) {
+        s->pending_changes.clear();
+        s->pending_bytes.clear();
+        s->pending_states.assign(s->paths.size(), WrapperWatchState{});
+        for (size_t index = 0; index < s->paths.size(); ++index) {
+            const WrapperWatchState& previous = s->states[index];
+            WrapperWatchState& current = s->pending_states[index];
+            current.known = wrapper_read_watched_value(f, s->paths[index], current.bytes);
+            if (!current.known) current.bytes.clear();
+            if (!current.known && !previous.known) continue;
+            if (current.known && previous.known && current.bytes == previous.bytes) continue;
+            wrapper_record_watch_change(*s, static_cast<uint32_t>(index), previous, current);
+        }
+        s->has_pending = true;
+        s->pending_stop_id = stop_id;
+        s->pending_cfa = cfa;
+        s->pending_frame_id = frame_id;
+    }
 
-    if (!non_synth.IsValid()) return nullptr;
+    *change_count = s->pending_changes.size();
+    *required_size = s->pending_bytes.size();
+    if (capacity < s->pending_changes.size() || buffer_size < s->pending_bytes.size()) return LLDB_RUBY_STATUS_OK;
 
-    return static_cast<lldb_value_t>(new lldb::SBValue(non_synth));
+    if (!s->pending_changes.empty()) {
+        std::memcpy(changes, s->pending_changes.data(), s->pending_changes.size() * sizeof(lldb_ruby_value_change_t));
+    }
+    if (!s->pending_bytes.empty()) std::memcpy(buffer, s->pending_bytes.data(), s->pending_bytes.size());
+    s->states.swap(s->pending_states);
+    s->pending_states.clear();
+    s->pending_changes.clear();
+    s->pending_bytes.clear();
+    s->has_pending = false;
+    return LLDB_RUBY_STATUS_OK;
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (const std::exception& exception) {
         wrapper_set_error_state(exception.what());
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     } catch (...) {
         wrapper_set_error_state("unknown native exception across the C ABI");
-        return {};
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
     }
 }
 
@@ -6540,7 +11927,7 @@ lldb_value_t lldb_value_list_get_value_at_index(lldb_value_list_t list, uint32_t
 
     if (!value.IsValid()) return nullptr;
 
-    return static_cast<lldb_value_t>(new lldb::SBValue(value));
+    return wrapper_new_value(value);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -6563,7 +11950,7 @@ lldb_value_t lldb_value_list_get_first_value_by_name(lldb_value_list_t list, con
 
     if (!value.IsValid()) return nullptr;
 
-    return static_cast<lldb_value_t>(new lldb::SBValue(value));
+    return wrapper_new_value(value);
 
       } catch (const std::bad_alloc&) {
         wrapper_set_error_state("native allocation failed across the C ABI");
@@ -8558,6 +13945,203 @@ int lldb_type_get_basic_type(lldb_type_t type)  LLDB_WRAPPER_NOEXCEPT {
     }
 }
 
+lldb_type_layout_t lldb_type_get_layout(lldb_type_t type, lldb_error_t output)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    wrapper_clear_error_state();
+    lldb::SBError* error = output ? static_cast<lldb::SBError*>(output) : nullptr;
+    if (!type) {
+        wrapper_set_invalid_argument(error, "type layout requires a type");
+        return nullptr;
+    }
+    lldb::SBType* declared = static_cast<lldb::SBType*>(type);
+    lldb::SBType canonical = declared->GetCanonicalType();
+    if (!canonical.IsValid() || canonical.GetByteSize() == 0) {
+        wrapper_set_invalid_argument(error, "type layout requires a complete, sized type");
+        return nullptr;
+    }
+
+    std::string key;
+    bool cacheable = wrapper_type_layout_key(*declared, canonical, key);
+    std::unique_ptr<WrapperTypeLayoutHandle> handle(new WrapperTypeLayoutHandle());
+    if (cacheable) {
+        std::lock_guard<std::mutex> lock(g_type_layouts_mutex);
+        auto found = g_type_layouts.find(key);
+        if (found != g_type_layouts.end()) handle->layout = found->second;
+    }
+    if (!handle->layout) {
+        std::shared_ptr<WrapperTypeLayout> layout = std::make_shared<WrapperTypeLayout>();
+        layout->byte_size = canonical.GetByteSize();
+        std::string reason;
+        if (!wrapper_flatten_type(canonical, "", 0, 0, *layout, reason)) {
+            wrapper_set_invalid_argument(error, reason.c_str());
+            return nullptr;
+        }
+        wrapper_unique_layout_names(*layout);
+        if (cacheable) {
+            std::lock_guard<std::mutex> lock(g_type_layouts_mutex);
+            handle->layout = g_type_layouts.emplace(key, std::move(layout)).first->second;
+        } else {
+            handle->layout = std::move(layout);
+        }
+    }
+    return static_cast<lldb_type_layout_t>(handle.release());
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+// ============================================================================
+// Type layouts
+// ============================================================================
+
+void lldb_type_layout_destroy(lldb_type_layout_t layout)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    delete static_cast<WrapperTypeLayoutHandle*>(layout);
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+    }
+}
+
+void lldb_type_layout_clear_cache(void)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    std::lock_guard<std::mutex> lock(g_type_layouts_mutex);
+    g_type_layouts.clear();
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+    }
+}
+
+uint64_t lldb_type_layout_get_byte_size(lldb_type_layout_t layout)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!layout) return 0;
+    return static_cast<WrapperTypeLayoutHandle*>(layout)->layout->byte_size;
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+uint32_t lldb_type_layout_get_num_fields(lldb_type_layout_t layout)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!layout) return 0;
+    return static_cast<uint32_t>(static_cast<WrapperTypeLayoutHandle*>(layout)->layout->fields.size());
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+lldb_ruby_status_t lldb_type_layout_get_field(lldb_type_layout_t layout,
+                                              uint32_t index,
+                                              lldb_ruby_type_layout_field_t* field)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    wrapper_clear_error_state();
+    if (!layout) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    const WrapperTypeLayout& type_layout = *static_cast<WrapperTypeLayoutHandle*>(layout)->layout;
+    if (!field || index >= type_layout.fields.size()) return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    *field = type_layout.fields[index].field;
+    return LLDB_RUBY_STATUS_OK;
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    }
+}
+
+const char* lldb_type_layout_get_field_name(lldb_type_layout_t layout, uint32_t index)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    if (!layout) return nullptr;
+    const WrapperTypeLayout& type_layout = *static_cast<WrapperTypeLayoutHandle*>(layout)->layout;
+    if (index >= type_layout.fields.size()) return nullptr;
+    return type_layout.fields[index].name.c_str();
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return {};
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return {};
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return {};
+    }
+}
+
+lldb_ruby_status_t lldb_type_layout_decode(lldb_type_layout_t layout,
+                                           const void* data,
+                                           size_t data_size,
+                                           uint64_t count,
+                                           uint64_t stride,
+                                           int big_endian,
+                                           void* const* columns,
+                                           size_t column_count)  LLDB_WRAPPER_NOEXCEPT {
+    try {
+    wrapper_clear_error_state();
+    if (!layout) return LLDB_RUBY_STATUS_INVALID_HANDLE;
+    const WrapperTypeLayout& type_layout = *static_cast<WrapperTypeLayoutHandle*>(layout)->layout;
+    if (stride == 0) stride = type_layout.byte_size;
+    if (count == 0) return LLDB_RUBY_STATUS_OK;
+    if (!data || !columns || column_count != type_layout.fields.size() || stride < type_layout.byte_size ||
+        data_size < type_layout.byte_size || (count - 1) > (data_size - type_layout.byte_size) / stride) {
+        return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+    for (size_t index = 0; index < column_count; ++index) {
+        if (!columns[index]) return LLDB_RUBY_STATUS_INVALID_ARGUMENT;
+    }
+
+    wrapper_decode_layout(type_layout, static_cast<const uint8_t*>(data), count, stride, big_endian != 0, columns, 0);
+    return LLDB_RUBY_STATUS_OK;
+
+      } catch (const std::bad_alloc&) {
+        wrapper_set_error_state("native allocation failed across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    } catch (const std::exception& exception) {
+        wrapper_set_error_state(exception.what());
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    } catch (...) {
+        wrapper_set_error_state("unknown native exception across the C ABI");
+        return LLDB_RUBY_STATUS_INTERNAL_ERROR;
+    }
+}
+
 // ============================================================================
 // SBTypeMember
 // ============================================================================
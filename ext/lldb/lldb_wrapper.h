@@ -49,6 +49,15 @@ typedef void* lldb_expression_options_t;
 typedef void* lldb_address_t;
 typedef void* lldb_line_entry_t;
 typedef void* lldb_file_spec_list_t;
+typedef void* lldb_memory_snapshot_t;
+typedef void* lldb_memory_tracker_t;
+typedef void* lldb_value_search_t;
+typedef void* lldb_memory_prefetch_t;
+typedef void* lldb_scope_t;
+typedef void* lldb_value_children_cursor_t;
+typedef void* lldb_type_layout_t;
+typedef void* lldb_value_watch_set_t;
+typedef void* lldb_profiler_t;
 
 typedef enum {
     LLDB_RUBY_STATUS_OK = 0,
@@ -63,6 +72,350 @@ typedef enum {
     LLDB_RUBY_CAPABILITY_WATCHPOINT_ACCESS_KIND = 1
 } lldb_ruby_capability_t;
 
+// Element types for lldb_process_read_array. Elements are converted from the
+// target byte order to host order; pointers are widened to uint64_t.
+typedef enum {
+    LLDB_RUBY_ELEMENT_INT8 = 1,
+    LLDB_RUBY_ELEMENT_UINT8 = 2,
+    LLDB_RUBY_ELEMENT_INT16 = 3,
+    LLDB_RUBY_ELEMENT_UINT16 = 4,
+    LLDB_RUBY_ELEMENT_INT32 = 5,
+    LLDB_RUBY_ELEMENT_UINT32 = 6,
+    LLDB_RUBY_ELEMENT_INT64 = 7,
+    LLDB_RUBY_ELEMENT_UINT64 = 8,
+    LLDB_RUBY_ELEMENT_FLOAT = 9,
+    LLDB_RUBY_ELEMENT_DOUBLE = 10,
+    LLDB_RUBY_ELEMENT_POINTER = 11
+} lldb_ruby_element_type_t;
+
+// Result flags reported by lldb_process_walk_links.
+typedef enum {
+    LLDB_RUBY_WALK_REVISITED = 1,
+    LLDB_RUBY_WALK_TRUNCATED = 2,
+    LLDB_RUBY_WALK_READ_FAILED = 4
+} lldb_ruby_walk_flags_t;
+
+// Scatter-gather descriptor for batched memory transfers. The offset is
+// relative to the single caller-provided buffer.
+typedef struct {
+    uint64_t address;
+    uint64_t size;
+    uint64_t offset;
+} lldb_ruby_memory_range_t;
+
+// Record written by lldb_process_get_memory_regions. Permissions use the
+// lldb::Permissions bits; name_offset indexes the NUL-separated string table
+// and is UINT64_MAX for unnamed regions.
+typedef struct {
+    uint64_t base;
+    uint64_t end;
+    uint64_t permissions;
+    uint64_t mapped;
+    uint64_t name_offset;
+} lldb_ruby_memory_region_t;
+
+// Region filter for memory scans. Only mapped, readable regions that have
+// every required and none of the excluded lldb::Permissions bits are visited,
+// clipped to [start, end). An end of 0 means the top of the address space.
+typedef struct {
+    uint64_t start;
+    uint64_t end;
+    uint64_t required_permissions;
+    uint64_t excluded_permissions;
+} lldb_ruby_memory_scan_filter_t;
+
+typedef struct {
+    uint64_t address;
+    uint64_t size;
+} lldb_ruby_address_range_t;
+
+// Edge found by lldb_process_find_references: the pointer-sized word at
+// `referrer` holds `target`, which lies inside ranges[range_index].
+typedef struct {
+    uint64_t referrer;
+    uint64_t target;
+    uint64_t range_index;
+} lldb_ruby_memory_reference_t;
+
+// Memory snapshot file layout, version 1. All integers use the byte order of
+// the host that wrote the file.
+//
+//   [0, 64)             lldb_ruby_memory_snapshot_header_t
+//   [data_alignment, index_offset)
+//                       captured bytes; every region starts on a
+//                       data_alignment boundary so it can be mapped directly
+//   [index_offset, EOF) region_count lldb_ruby_memory_snapshot_region_t
+//                       records sorted by address
+//
+// The header is written last, so an interrupted snapshot has no valid magic.
+// Unreadable pages inside a region split it into several index records.
+#define LLDB_RUBY_MEMORY_SNAPSHOT_MAGIC "LLDBSNAP"
+#define LLDB_RUBY_MEMORY_SNAPSHOT_VERSION 1
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint64_t region_count;
+    uint64_t index_offset;
+    uint64_t data_alignment;
+    uint32_t address_byte_size;
+    uint32_t byte_order;
+    uint64_t total_bytes;
+    uint64_t reserved;
+} lldb_ruby_memory_snapshot_header_t;
+
+typedef struct {
+    uint64_t address;
+    uint64_t size;
+    uint64_t file_offset;
+    uint64_t permissions;
+} lldb_ruby_memory_snapshot_region_t;
+
+typedef enum {
+    LLDB_RUBY_MEMORY_TRACKER_BYTE_DIFF = 1
+} lldb_ruby_memory_tracker_flags_t;
+
+typedef enum {
+    LLDB_RUBY_MEMORY_CHANGE_MODIFIED = 0,
+    LLDB_RUBY_MEMORY_CHANGE_MAPPED = 1,
+    LLDB_RUBY_MEMORY_CHANGE_UNMAPPED = 2
+} lldb_ruby_memory_change_kind_t;
+
+// Changed range reported by a memory tracker. Without byte diffs every range
+// covers whole pages; adjacent ranges of the same kind are merged.
+typedef struct {
+    uint64_t address;
+    uint64_t size;
+    uint64_t kind;
+} lldb_ruby_memory_change_t;
+
+// Predicates for lldb_value_search_narrow. The first four compare the current
+// value with the operand, the rest with the value seen at the previous scan.
+typedef enum {
+    LLDB_RUBY_VALUE_SEARCH_EQUAL = 0,
+    LLDB_RUBY_VALUE_SEARCH_NOT_EQUAL = 1,
+    LLDB_RUBY_VALUE_SEARCH_GREATER = 2,
+    LLDB_RUBY_VALUE_SEARCH_LESS = 3,
+    LLDB_RUBY_VALUE_SEARCH_CHANGED = 4,
+    LLDB_RUBY_VALUE_SEARCH_UNCHANGED = 5,
+    LLDB_RUBY_VALUE_SEARCH_INCREASED = 6,
+    LLDB_RUBY_VALUE_SEARCH_DECREASED = 7
+} lldb_ruby_value_search_predicate_t;
+
+// Parts of each value that lldb_value_serialize collects. Summaries run data
+// formatters and are usually the most expensive part.
+typedef enum {
+    LLDB_RUBY_VALUE_SERIALIZE_VALUES = 1,
+    LLDB_RUBY_VALUE_SERIALIZE_SUMMARIES = 2,
+    LLDB_RUBY_VALUE_SERIALIZE_TYPE_NAMES = 4,
+    LLDB_RUBY_VALUE_SERIALIZE_LOCATIONS = 8
+} lldb_ruby_value_serialize_flags_t;
+
+typedef enum {
+    LLDB_RUBY_VALUE_NODE_ERROR = 1,
+    LLDB_RUBY_VALUE_NODE_TRUNCATED = 2,
+    LLDB_RUBY_VALUE_NODE_UNEXPANDED = 4
+} lldb_ruby_value_node_flags_t;
+
+// Variable kinds collected by lldb_frame_snapshot_variables.
+typedef enum {
+    LLDB_RUBY_FRAME_VARIABLES_ARGUMENTS = 1,
+    LLDB_RUBY_FRAME_VARIABLES_LOCALS = 2,
+    LLDB_RUBY_FRAME_VARIABLES_STATICS = 4,
+    LLDB_RUBY_FRAME_VARIABLES_IN_SCOPE_ONLY = 8
+} lldb_ruby_frame_variables_flags_t;
+
+// One scalar leaf of a flattened type layout. Nested structs, base classes
+// and fixed-size arrays are expanded in place. For bitfields, bit_size is
+// non-zero and the value starts bit_offset bits into the storage that begins
+// at byte_offset, counted in target memory order.
+typedef struct {
+    uint64_t byte_offset;
+    uint32_t element_type;
+    uint32_t bit_offset;
+    uint32_t bit_size;
+    uint32_t reserved;
+} lldb_ruby_type_layout_field_t;
+
+typedef enum {
+    LLDB_RUBY_CONTAINER_NONE = 0,
+    LLDB_RUBY_CONTAINER_VECTOR = 1,
+    LLDB_RUBY_CONTAINER_STRING = 2,
+    LLDB_RUBY_CONTAINER_UNORDERED_SET = 3,
+    LLDB_RUBY_CONTAINER_UNORDERED_MAP = 4
+} lldb_ruby_container_kind_t;
+
+// A libstdc++ or libc++ container recognized by the native fast path.
+// Elements (keys, for maps) and mapped values of scalar type are emitted as
+// host-order values of element_type and mapped_type, with pointers widened to
+// 64 bits; other types have an element type of 0 and are emitted as raw
+// target bytes. Sizes are those of the emitted values. data_address is the
+// first element, or the first node of a hashed container.
+typedef struct {
+    uint32_t kind;
+    uint32_t element_type;
+    uint32_t mapped_type;
+    uint32_t reserved;
+    uint64_t count;
+    uint64_t element_size;
+    uint64_t mapped_size;
+    uint64_t data_address;
+} lldb_ruby_container_info_t;
+
+typedef enum {
+    LLDB_RUBY_VALUE_CHANGE_NEW = 1,
+    LLDB_RUBY_VALUE_CHANGE_UNAVAILABLE = 2
+} lldb_ruby_value_change_flags_t;
+
+// One changed watch-set entry. Offsets index the caller's byte buffer. NEW
+// entries had no earlier bytes (old_size is 0); UNAVAILABLE entries no longer
+// resolve in the frame (new_size is 0).
+typedef struct {
+    uint32_t index;
+    uint32_t flags;
+    uint64_t old_offset;
+    uint64_t old_size;
+    uint64_t new_offset;
+    uint64_t new_size;
+} lldb_ruby_value_change_t;
+
+// Serialized value tree, in host byte order:
+//
+//   lldb_ruby_value_tree_header_t
+//   lldb_ruby_value_node_t[node_count]    preorder; each node is followed by
+//                                          its child_count serialized children
+//   char strings[strings_size]             NUL-terminated, deduplicated
+//
+// The nodes form a forest: lldb_value_serialize writes a single root, while
+// lldb_frame_snapshot_variables, lldb_frame_resolve_paths and
+// lldb_value_children_cursor_next_batch write one unexpanded root per
+// variable, path or child.
+// String fields are byte offsets into `strings`, or UINT32_MAX when absent;
+// `error` holds the error message of nodes flagged ERROR.
+// num_children is what LLDB reports; child_count can be smaller when
+// max_children (TRUNCATED) or max_depth (UNEXPANDED) cut the subtree.
+typedef struct {
+    uint32_t node_count;
+    uint32_t node_size;
+    uint64_t strings_offset;
+    uint64_t strings_size;
+} lldb_ruby_value_tree_header_t;
+
+typedef struct {
+    uint32_t name;
+    uint32_t type_name;
+    uint32_t value;
+    uint32_t summary;
+    uint32_t num_children;
+    uint32_t child_count;
+    uint64_t load_address;
+    uint64_t byte_size;
+    uint32_t flags;
+    uint32_t error;
+} lldb_ruby_value_node_t;
+
+// Parts of each frame that lldb_process_capture_backtraces symbolicates.
+typedef enum {
+    LLDB_RUBY_BACKTRACE_FUNCTIONS = 1,
+    LLDB_RUBY_BACKTRACE_LINE_ENTRIES = 2
+} lldb_ruby_backtrace_flags_t;
+
+typedef enum {
+    LLDB_RUBY_BACKTRACE_FRAME_INLINED = 1,
+    // Set on the last captured frame of a thread with frames past max_depth.
+    LLDB_RUBY_BACKTRACE_FRAME_TRUNCATED = 2
+} lldb_ruby_backtrace_frame_flags_t;
+
+// Captured backtraces, in host byte order:
+//
+//   lldb_ruby_backtrace_header_t
+//   uint64_t thread_ids[thread_count]          every thread, in process order,
+//                                               including ones with no frames
+//   lldb_ruby_backtrace_frame_t[frame_count]   grouped by thread, innermost
+//                                               frame first
+//   char strings[strings_size]                  NUL-terminated, deduplicated
+//
+// function and file are byte offsets into `strings`, or UINT32_MAX when
+// unknown or not requested; line is 0 when unknown.
+typedef struct {
+    uint32_t thread_count;
+    uint32_t frame_count;
+    uint32_t frame_size;
+    uint32_t reserved;
+    uint64_t strings_offset;
+    uint64_t strings_size;
+} lldb_ruby_backtrace_header_t;
+
+typedef struct {
+    uint64_t thread_id;
+    uint64_t pc;
+    uint64_t sp;
+    uint64_t fp;
+    uint32_t frame_index;
+    uint32_t function;
+    uint32_t file;
+    uint32_t line;
+    uint32_t flags;
+    uint32_t reserved;
+} lldb_ruby_backtrace_frame_t;
+
+// Output formats of lldb_profiler_write_profile.
+typedef enum {
+    // One "outermost;...;innermost count" line per distinct stack.
+    LLDB_RUBY_PROFILE_FOLDED = 0,
+    // An uncompressed pprof Profile message.
+    LLDB_RUBY_PROFILE_PPROF = 1
+} lldb_ruby_profile_format_t;
+
+// Durations are in nanoseconds. missed_count counts ticks that took no
+// sample because the process was not running or did not stop in time.
+typedef struct {
+    uint64_t sample_count;
+    uint64_t missed_count;
+    uint64_t elapsed_ns;
+    uint64_t paused_ns;
+    uint64_t max_pause_ns;
+    uint64_t node_count;
+} lldb_ruby_profiler_stats_t;
+
+typedef enum {
+    // The scope is inlined into the next scope of the same address.
+    LLDB_RUBY_SYMBOL_SCOPE_INLINED = 1
+} lldb_ruby_symbol_scope_flags_t;
+
+// Symbolicated addresses, in host byte order:
+//
+//   lldb_ruby_symbolication_header_t
+//   lldb_ruby_symbol_scope_t[scope_count]   in address order; each address
+//                                            yields its innermost scope
+//                                            first, then the scopes it is
+//                                            inlined into
+//   char strings[strings_size]               NUL-terminated, deduplicated
+//
+// Every address yields at least one scope. module, function and file are
+// byte offsets into `strings`, or UINT32_MAX when unknown; line and column
+// are 0 when unknown. The line of a scope that another is inlined into is
+// the call site of the inlined scope.
+typedef struct {
+    uint32_t address_count;
+    uint32_t scope_count;
+    uint32_t scope_size;
+    uint32_t reserved;
+    uint64_t strings_offset;
+    uint64_t strings_size;
+} lldb_ruby_symbolication_header_t;
+
+typedef struct {
+    uint64_t address;
+    uint32_t module;
+    uint32_t function;
+    uint32_t file;
+    uint32_t line;
+    uint32_t column;
+    uint32_t flags;
+} lldb_ruby_symbol_scope_t;
+
 // Wrapper metadata and capability discovery
 uint32_t lldb_wrapper_abi_version(void) LLDB_WRAPPER_NOEXCEPT;
 const char* lldb_wrapper_build_lldb_version(void) LLDB_WRAPPER_NOEXCEPT;
@@ -76,6 +429,18 @@ void lldb_wrapper_clear_last_error(void) LLDB_WRAPPER_NOEXCEPT;
 lldb_ruby_status_t lldb_initialize(lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
 void lldb_terminate(void) LLDB_WRAPPER_NOEXCEPT;
 
+// Handle scopes. While a scope is active on a thread, the SBValue and SBFrame
+// handles returned on that thread are allocated from the scope's slabs. They
+// must not be passed to lldb_value_destroy or lldb_frame_destroy; releasing
+// the scope frees all of them at once. Release a scope only after it has been
+// deactivated on every thread that activated it.
+lldb_scope_t lldb_scope_create(void) LLDB_WRAPPER_NOEXCEPT;
+void lldb_scope_release(lldb_scope_t scope) LLDB_WRAPPER_NOEXCEPT;
+// Makes `scope` (or none, when NULL) active on the calling thread and returns
+// the previously active scope so that it can be restored.
+lldb_scope_t lldb_scope_activate(lldb_scope_t scope) LLDB_WRAPPER_NOEXCEPT;
+uint64_t lldb_scope_get_num_handles(lldb_scope_t scope) LLDB_WRAPPER_NOEXCEPT;
+
 // SBDebugger
 lldb_debugger_t lldb_debugger_create(void) LLDB_WRAPPER_NOEXCEPT;
 lldb_debugger_t lldb_debugger_create_with_source_init_files(int source_init_files) LLDB_WRAPPER_NOEXCEPT;
@@ -208,6 +573,23 @@ int lldb_target_delete_all_watchpoints(lldb_target_t target) LLDB_WRAPPER_NOEXCE
 lldb_watchpoint_t lldb_target_find_watchpoint_by_id(lldb_target_t target, int32_t id) LLDB_WRAPPER_NOEXCEPT;
 uint32_t lldb_target_get_num_watchpoints(lldb_target_t target) LLDB_WRAPPER_NOEXCEPT;
 lldb_watchpoint_t lldb_target_get_watchpoint_at_index(lldb_target_t target, uint32_t index) LLDB_WRAPPER_NOEXCEPT;
+// Symbolicates load addresses using the layout documented above. Results
+// come from a process-wide cache keyed by module UUID and file address;
+// entries are filled on first lookup and dropped when a target loads or
+// unloads their module or loads symbols for it. Addresses in modules without
+// a UUID are resolved on every lookup. Addresses are looked up as given, so
+// pass return address - 1 for caller frames. `required_size` receives the
+// encoded size; nothing is copied when the buffer is smaller.
+lldb_ruby_status_t lldb_target_symbolicate(lldb_target_t target,
+                                           const uint64_t* addresses,
+                                           size_t count,
+                                           void* buffer,
+                                           size_t buffer_size,
+                                           uint64_t* required_size) LLDB_WRAPPER_NOEXCEPT;
+void lldb_symbol_cache_clear(void) LLDB_WRAPPER_NOEXCEPT;
+lldb_ruby_status_t lldb_symbol_cache_get_stats(uint64_t* hits,
+                                               uint64_t* misses,
+                                               uint64_t* entries) LLDB_WRAPPER_NOEXCEPT;
 
 // SBLaunchInfo
 lldb_launch_info_t lldb_launch_info_create(const char** argv) LLDB_WRAPPER_NOEXCEPT;
@@ -346,10 +728,112 @@ uint64_t lldb_process_get_process_id(lldb_process_t process) LLDB_WRAPPER_NOEXCE
 int lldb_process_get_exit_status(lldb_process_t process) LLDB_WRAPPER_NOEXCEPT;
 const char* lldb_process_get_exit_description(lldb_process_t process) LLDB_WRAPPER_NOEXCEPT;
 size_t lldb_process_read_memory(lldb_process_t process, uint64_t addr, void* buf, size_t size, lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+// Captures up to `max_depth` frames (0 for all) of every thread using the
+// layout documented above. `required_size` receives the encoded size;
+// nothing is copied when the buffer is smaller, and the capture is kept for
+// a retry at the same stop with the same arguments.
+lldb_ruby_status_t lldb_process_capture_backtraces(lldb_process_t process,
+                                                   uint32_t max_depth,
+                                                   uint32_t flags,
+                                                   void* buffer,
+                                                   size_t buffer_size,
+                                                   uint64_t* required_size) LLDB_WRAPPER_NOEXCEPT;
+// Starts sampling the stacks of every thread every `interval_us`
+// microseconds on a native thread: each tick interrupts the running process,
+// adds up to `max_depth` frames (0 for all) per thread to a trie of PCs and
+// resumes it. Requires an asynchronous debugger. Ticks that find the process
+// stopped by anyone else leave it alone. Sampling ends with
+// lldb_profiler_stop or when the process exits.
+lldb_profiler_t lldb_process_start_profiler(lldb_process_t process,
+                                           uint32_t interval_us,
+                                           uint32_t max_depth,
+                                           lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+lldb_ruby_status_t lldb_process_read_memory_batch(lldb_process_t process,
+                                                  const lldb_ruby_memory_range_t* ranges,
+                                                  size_t count,
+                                                  void* buffer,
+                                                  size_t buffer_size,
+                                                  uint64_t* bytes_read,
+                                                  lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+// Writes each range from `buffer + offset` in descriptor order. Every entry is
+// attempted; `first_failure` receives the index of the first entry that was
+// not fully written, or UINT64_MAX, and its error is copied to `error`.
+lldb_ruby_status_t lldb_process_write_memory_batch(lldb_process_t process,
+                                                   const lldb_ruby_memory_range_t* ranges,
+                                                   size_t count,
+                                                   const void* buffer,
+                                                   size_t buffer_size,
+                                                   uint64_t* bytes_written,
+                                                   uint64_t* first_failure,
+                                                   lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+// Reads `count` elements of `layout` and decodes them into columns as
+// lldb_type_layout_decode does, in the process byte order.
+lldb_ruby_status_t lldb_process_read_structs(lldb_process_t process,
+                                             uint64_t addr,
+                                             lldb_type_layout_t layout,
+                                             uint64_t count,
+                                             uint64_t stride,
+                                             void* const* columns,
+                                             size_t column_count,
+                                             uint64_t* elements_read,
+                                             lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+lldb_ruby_status_t lldb_process_read_array(lldb_process_t process,
+                                           uint64_t addr,
+                                           uint32_t element_type,
+                                           uint64_t count,
+                                           uint64_t stride,
+                                           void* buffer,
+                                           size_t buffer_size,
+                                           uint64_t* elements_read,
+                                           lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+// Walks a linked list (one link offset) or tree (several) from `start` in
+// preorder. `buffer` receives max_nodes uint64_t node addresses followed by
+// max_nodes payloads of payload_size bytes read from payload_offset.
+lldb_ruby_status_t lldb_process_walk_links(lldb_process_t process,
+                                           uint64_t start,
+                                           const uint64_t* link_offsets,
+                                           size_t link_count,
+                                           uint64_t payload_offset,
+                                           uint64_t payload_size,
+                                           uint64_t max_nodes,
+                                           void* buffer,
+                                           size_t buffer_size,
+                                           uint64_t* node_count,
+                                           uint32_t* walk_flags,
+                                           lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+lldb_ruby_status_t lldb_process_set_memory_cache(lldb_process_t process,
+                                                 uint32_t page_size,
+                                                 uint32_t max_pages,
+                                                 lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+lldb_ruby_status_t lldb_process_get_memory_cache_stats(lldb_process_t process,
+                                                       uint64_t* hits,
+                                                       uint64_t* misses,
+                                                       uint64_t* cached_pages) LLDB_WRAPPER_NOEXCEPT;
+void lldb_process_flush_memory_cache(lldb_process_t process) LLDB_WRAPPER_NOEXCEPT;
+// Starts reading the pages covering `ranges` into the process page cache on a
+// native worker thread, enabling a default cache if none is configured. At
+// most the cache capacity is prefetched. The prefetch is cancelled when the
+// process resumes.
+lldb_memory_prefetch_t lldb_process_prefetch_memory(lldb_process_t process,
+                                                   const lldb_ruby_address_range_t* ranges,
+                                                   size_t count,
+                                                   lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
 size_t lldb_process_write_memory(lldb_process_t process, uint64_t addr, const void* buf, size_t size, lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
 uint64_t lldb_process_allocate_memory(lldb_process_t process, size_t size, uint32_t permissions, lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
 lldb_ruby_status_t lldb_process_deallocate_memory(lldb_process_t process, uint64_t addr, lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
 size_t lldb_process_read_cstring_from_memory(lldb_process_t process, uint64_t addr, void* buf, size_t size, lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+// Reads up to `max_len` bytes of each NUL-terminated string into `buffer`,
+// which must hold count * (max_len + 1) bytes. String i occupies
+// [offsets[i], offsets[i + 1]) including its NUL; an empty span means the
+// address was unreadable. `offsets` holds count + 1 entries.
+lldb_ruby_status_t lldb_process_read_cstrings(lldb_process_t process,
+                                              const uint64_t* addresses,
+                                              size_t count,
+                                              size_t max_len,
+                                              char* buffer,
+                                              size_t buffer_size,
+                                              uint64_t* offsets,
+                                              lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
 size_t lldb_process_get_stdout(lldb_process_t process, char* buf, size_t size) LLDB_WRAPPER_NOEXCEPT;
 size_t lldb_process_get_stderr(lldb_process_t process, char* buf, size_t size) LLDB_WRAPPER_NOEXCEPT;
 size_t lldb_process_put_stdin(lldb_process_t process, const char* buf, size_t size) LLDB_WRAPPER_NOEXCEPT;
@@ -360,6 +844,52 @@ lldb_ruby_status_t lldb_process_get_num_supported_hardware_watchpoints(lldb_proc
                                                                         lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
 uint32_t lldb_process_get_unique_id(lldb_process_t process) LLDB_WRAPPER_NOEXCEPT;
 lldb_memory_region_info_t lldb_process_get_memory_region_info(lldb_process_t process, uint64_t addr, lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+lldb_ruby_status_t lldb_process_get_memory_regions(lldb_process_t process,
+                                                   lldb_ruby_memory_region_t* regions,
+                                                   size_t region_capacity,
+                                                   uint64_t* region_count,
+                                                   char* names,
+                                                   size_t names_capacity,
+                                                   uint64_t* names_size) LLDB_WRAPPER_NOEXCEPT;
+lldb_ruby_status_t lldb_process_scan_memory(lldb_process_t process,
+                                            const void* pattern,
+                                            const void* mask,
+                                            size_t pattern_size,
+                                            const lldb_ruby_memory_scan_filter_t* filter,
+                                            uint64_t* hits,
+                                            size_t max_hits,
+                                            uint64_t* hit_count,
+                                            lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+// Starts a value search: scans naturally aligned elements of the filtered
+// regions for `value`, given in host byte order. Pointer elements are not
+// supported.
+lldb_value_search_t lldb_process_create_value_search(lldb_process_t process,
+                                                     const lldb_ruby_memory_scan_filter_t* filter,
+                                                     uint32_t element_type,
+                                                     const void* value,
+                                                     lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+// Conservatively scans aligned pointer-sized words of the filtered regions
+// for values inside `ranges`. Up to `capacity` edges are stored in referrer
+// order; `reference_count` receives the total number found.
+lldb_ruby_status_t lldb_process_find_references(lldb_process_t process,
+                                                const lldb_ruby_address_range_t* ranges,
+                                                size_t range_count,
+                                                const lldb_ruby_memory_scan_filter_t* filter,
+                                                lldb_ruby_memory_reference_t* references,
+                                                size_t capacity,
+                                                uint64_t* reference_count,
+                                                lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+lldb_ruby_status_t lldb_process_snapshot_memory(lldb_process_t process,
+                                                const char* path,
+                                                const lldb_ruby_memory_scan_filter_t* filter,
+                                                uint64_t* region_count,
+                                                uint64_t* bytes_written,
+                                                lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+lldb_memory_tracker_t lldb_process_create_memory_tracker(lldb_process_t process,
+                                                         const lldb_ruby_memory_scan_filter_t* filter,
+                                                         uint32_t page_size,
+                                                         uint32_t flags,
+                                                         lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
 
 // SBMemoryRegionInfo
 void lldb_memory_region_info_destroy(lldb_memory_region_info_t info) LLDB_WRAPPER_NOEXCEPT;
@@ -371,6 +901,77 @@ int lldb_memory_region_info_is_executable(lldb_memory_region_info_t info) LLDB_W
 int lldb_memory_region_info_is_mapped(lldb_memory_region_info_t info) LLDB_WRAPPER_NOEXCEPT;
 const char* lldb_memory_region_info_get_name(lldb_memory_region_info_t info) LLDB_WRAPPER_NOEXCEPT;
 
+// Memory snapshots
+lldb_memory_snapshot_t lldb_memory_snapshot_open(const char* path, lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+void lldb_memory_snapshot_destroy(lldb_memory_snapshot_t snapshot) LLDB_WRAPPER_NOEXCEPT;
+lldb_ruby_status_t lldb_memory_snapshot_get_regions(lldb_memory_snapshot_t snapshot,
+                                                    lldb_ruby_memory_snapshot_region_t* regions,
+                                                    size_t capacity,
+                                                    uint64_t* region_count) LLDB_WRAPPER_NOEXCEPT;
+size_t lldb_memory_snapshot_read_memory(lldb_memory_snapshot_t snapshot,
+                                        uint64_t addr,
+                                        void* buffer,
+                                        size_t size,
+                                        lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+
+// Memory trackers
+void lldb_memory_tracker_destroy(lldb_memory_tracker_t tracker) LLDB_WRAPPER_NOEXCEPT;
+uint64_t lldb_memory_tracker_get_num_pages(lldb_memory_tracker_t tracker) LLDB_WRAPPER_NOEXCEPT;
+lldb_ruby_status_t lldb_memory_tracker_update(lldb_memory_tracker_t tracker,
+                                              uint64_t* change_count,
+                                              lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+lldb_ruby_status_t lldb_memory_tracker_get_changes(lldb_memory_tracker_t tracker,
+                                                   lldb_ruby_memory_change_t* changes,
+                                                   size_t capacity,
+                                                   uint64_t* change_count) LLDB_WRAPPER_NOEXCEPT;
+
+// Memory prefetches. Destroying a prefetch cancels it and joins its worker.
+void lldb_memory_prefetch_destroy(lldb_memory_prefetch_t prefetch) LLDB_WRAPPER_NOEXCEPT;
+void lldb_memory_prefetch_cancel(lldb_memory_prefetch_t prefetch) LLDB_WRAPPER_NOEXCEPT;
+// Waits up to `timeout_ms` (forever when negative) for the worker to finish.
+lldb_ruby_status_t lldb_memory_prefetch_wait(lldb_memory_prefetch_t prefetch,
+                                            int64_t timeout_ms,
+                                            int* completed) LLDB_WRAPPER_NOEXCEPT;
+// Read end of a pipe that becomes readable when the prefetch finishes, or -1.
+// The descriptor is owned by the prefetch.
+int lldb_memory_prefetch_get_fd(lldb_memory_prefetch_t prefetch) LLDB_WRAPPER_NOEXCEPT;
+uint64_t lldb_memory_prefetch_get_num_pages(lldb_memory_prefetch_t prefetch) LLDB_WRAPPER_NOEXCEPT;
+
+// Sampling profilers. Destroying a profiler stops it first.
+void lldb_profiler_destroy(lldb_profiler_t profiler) LLDB_WRAPPER_NOEXCEPT;
+// Stops sampling and joins the sampling thread, resuming the process if it
+// was interrupted for a sample.
+lldb_ruby_status_t lldb_profiler_stop(lldb_profiler_t profiler) LLDB_WRAPPER_NOEXCEPT;
+int lldb_profiler_is_running(lldb_profiler_t profiler) LLDB_WRAPPER_NOEXCEPT;
+lldb_ruby_status_t lldb_profiler_get_stats(lldb_profiler_t profiler,
+                                           lldb_ruby_profiler_stats_t* stats) LLDB_WRAPPER_NOEXCEPT;
+// Symbolicates the sampled PCs, once per profiler, and encodes the samples
+// in `format`. Only available once sampling has ended. `required_size`
+// receives the encoded size; nothing is copied when the buffer is smaller.
+lldb_ruby_status_t lldb_profiler_write_profile(lldb_profiler_t profiler,
+                                               uint32_t format,
+                                               void* buffer,
+                                               size_t buffer_size,
+                                               uint64_t* required_size,
+                                               lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+
+// Value searches
+void lldb_value_search_destroy(lldb_value_search_t search) LLDB_WRAPPER_NOEXCEPT;
+uint64_t lldb_value_search_get_count(lldb_value_search_t search) LLDB_WRAPPER_NOEXCEPT;
+// `operand` is required by the operand predicates and ignored by the others.
+lldb_ruby_status_t lldb_value_search_narrow(lldb_value_search_t search,
+                                           uint32_t predicate,
+                                           const void* operand,
+                                           uint64_t* remaining,
+                                           lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+// Copies up to `capacity` candidate addresses in ascending order and, if
+// `values` is not null, their host-order values from the last scan.
+lldb_ruby_status_t lldb_value_search_get_results(lldb_value_search_t search,
+                                                uint64_t* addresses,
+                                                void* values,
+                                                size_t capacity,
+                                                uint64_t* count) LLDB_WRAPPER_NOEXCEPT;
+
 // SBThread
 void lldb_thread_destroy(lldb_thread_t thread) LLDB_WRAPPER_NOEXCEPT;
 int lldb_thread_is_valid(lldb_thread_t thread) LLDB_WRAPPER_NOEXCEPT;
@@ -436,6 +1037,25 @@ lldb_instruction_list_t lldb_frame_get_instruction_list(lldb_frame_t frame,
 lldb_symbol_context_t lldb_frame_get_symbol_context(lldb_frame_t frame, uint32_t scope) LLDB_WRAPPER_NOEXCEPT;
 lldb_value_list_t lldb_frame_get_variables(lldb_frame_t frame, int arguments, int locals, int statics, int in_scope_only) LLDB_WRAPPER_NOEXCEPT;
 lldb_value_list_t lldb_frame_get_registers(lldb_frame_t frame) LLDB_WRAPPER_NOEXCEPT;
+// Serializes the variables selected by `scope` (lldb_ruby_frame_variables_flags_t)
+// as top-level value tree nodes; `flags` and the sizing contract are as for
+// lldb_value_serialize.
+lldb_ruby_status_t lldb_frame_snapshot_variables(lldb_frame_t frame,
+                                                 uint32_t scope,
+                                                 uint32_t flags,
+                                                 void* buffer,
+                                                 size_t buffer_size,
+                                                 uint64_t* required_size) LLDB_WRAPPER_NOEXCEPT;
+// Resolves each of `paths` as lldb_frame_get_value_for_variable_path would
+// and serializes one unexpanded root per path, in order. Paths that do not
+// resolve produce a root flagged ERROR with the reason in `error`.
+lldb_ruby_status_t lldb_frame_resolve_paths(lldb_frame_t frame,
+                                            const char* const* paths,
+                                            size_t path_count,
+                                            uint32_t flags,
+                                            void* buffer,
+                                            size_t buffer_size,
+                                            uint64_t* required_size) LLDB_WRAPPER_NOEXCEPT;
 int lldb_frame_is_inlined(lldb_frame_t frame) LLDB_WRAPPER_NOEXCEPT;
 const char* lldb_frame_disassemble(lldb_frame_t frame) LLDB_WRAPPER_NOEXCEPT;
 lldb_module_t lldb_frame_get_module(lldb_frame_t frame) LLDB_WRAPPER_NOEXCEPT;
@@ -510,6 +1130,89 @@ lldb_watchpoint_t lldb_value_watch(lldb_value_t value, int resolve_location, int
 const char* lldb_value_get_expression_path(lldb_value_t value) LLDB_WRAPPER_NOEXCEPT;
 int lldb_value_is_pointer_type(lldb_value_t value) LLDB_WRAPPER_NOEXCEPT;
 lldb_value_t lldb_value_get_non_synthetic_value(lldb_value_t value) LLDB_WRAPPER_NOEXCEPT;
+// Copies the bytes LLDB holds for `value`, in target byte order. Returns the
+// full data size when `buffer` is NULL or `length` is 0, otherwise the number
+// of bytes copied.
+uint64_t lldb_value_get_data(lldb_value_t value, void* buffer, uint64_t length, lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+// Decodes the data of `value` as consecutive host-order elements of
+// `element_type`, pointers widened to 64 bits. `element_count` receives the
+// number of whole elements in the data; nothing is copied when the buffer
+// holds fewer.
+lldb_ruby_status_t lldb_value_get_data_as(lldb_value_t value,
+                                          uint32_t element_type,
+                                          void* buffer,
+                                          size_t buffer_size,
+                                          uint64_t* element_count,
+                                          lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+// Serializes `value` and up to `max_depth` levels of descendants, at most
+// `max_children` per node, into `buffer` using the layout documented above.
+// `required_size` receives the encoded size; nothing is copied when the
+// buffer is smaller than that.
+lldb_ruby_status_t lldb_value_serialize(lldb_value_t value,
+                                        uint32_t max_depth,
+                                        uint32_t max_children,
+                                        uint32_t flags,
+                                        void* buffer,
+                                        size_t buffer_size,
+                                        uint64_t* required_size) LLDB_WRAPPER_NOEXCEPT;
+// Container fast path
+// Recognizes std::vector, std::basic_string, std::unordered_(multi)set and
+// std::unordered_(multi)map by type name and reads their storage directly
+// through the non-synthetic members, bypassing synthetic children. `kind` is
+// LLDB_RUBY_CONTAINER_NONE when `value` has no fast path.
+lldb_ruby_status_t lldb_value_get_container_info(lldb_value_t value,
+                                                 lldb_ruby_container_info_t* info) LLDB_WRAPPER_NOEXCEPT;
+// Emits elements [start, start + count) of a recognized container, each an
+// element followed by its mapped value. `required_size` receives the size of
+// the clipped range and nothing is read when the buffer is smaller; after a
+// read it receives the bytes written, which stop early at unreadable memory.
+lldb_ruby_status_t lldb_value_read_container(lldb_value_t value,
+                                             uint64_t start,
+                                             uint64_t count,
+                                             void* buffer,
+                                             size_t buffer_size,
+                                             uint64_t* required_size,
+                                             lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+
+// Value children cursors
+// Walks the children of `value` in batches without creating a handle per
+// child. `flags` selects the fields as for lldb_value_serialize.
+lldb_value_children_cursor_t lldb_value_children_cursor_create(lldb_value_t value,
+                                                               uint32_t flags) LLDB_WRAPPER_NOEXCEPT;
+void lldb_value_children_cursor_destroy(lldb_value_children_cursor_t cursor) LLDB_WRAPPER_NOEXCEPT;
+uint32_t lldb_value_children_cursor_get_num_children(lldb_value_children_cursor_t cursor) LLDB_WRAPPER_NOEXCEPT;
+uint32_t lldb_value_children_cursor_get_position(lldb_value_children_cursor_t cursor) LLDB_WRAPPER_NOEXCEPT;
+// Serializes up to `max_count` further children as unexpanded value tree
+// roots; zero nodes means the cursor is exhausted. The cursor advances only
+// once the batch has been copied. A batch that did not fit is kept and
+// returned again by the next call, whatever its `max_count`.
+lldb_ruby_status_t lldb_value_children_cursor_next_batch(lldb_value_children_cursor_t cursor,
+                                                         uint32_t max_count,
+                                                         void* buffer,
+                                                         size_t buffer_size,
+                                                         uint64_t* required_size) LLDB_WRAPPER_NOEXCEPT;
+
+// Value watch sets
+// Track the raw bytes of variable paths across stops. Each update resolves
+// every path in `frame` and reports only the entries whose bytes changed
+// since the previous update. `change_count` and `required_size` receive the
+// number of changes and the bytes they need; when either does not fit,
+// nothing is copied and the same result is returned by a retry at the same
+// stop and frame.
+lldb_value_watch_set_t lldb_value_watch_set_create(void) LLDB_WRAPPER_NOEXCEPT;
+void lldb_value_watch_set_destroy(lldb_value_watch_set_t set) LLDB_WRAPPER_NOEXCEPT;
+// Returns the index of the new entry, or UINT32_MAX when `path` is NULL or
+// the entry could not be stored; the set is unchanged on failure.
+uint32_t lldb_value_watch_set_add(lldb_value_watch_set_t set, const char* path) LLDB_WRAPPER_NOEXCEPT;
+uint32_t lldb_value_watch_set_get_count(lldb_value_watch_set_t set) LLDB_WRAPPER_NOEXCEPT;
+lldb_ruby_status_t lldb_value_watch_set_update(lldb_value_watch_set_t set,
+                                              lldb_frame_t frame,
+                                              lldb_ruby_value_change_t* changes,
+                                              size_t capacity,
+                                              size_t* change_count,
+                                              void* buffer,
+                                              size_t buffer_size,
+                                              uint64_t* required_size) LLDB_WRAPPER_NOEXCEPT;
 
 // SBValueList
 void lldb_value_list_destroy(lldb_value_list_t list) LLDB_WRAPPER_NOEXCEPT;
@@ -645,6 +1348,31 @@ lldb_type_member_t lldb_type_get_field_at_index(lldb_type_t type, uint32_t index
 lldb_type_member_t lldb_type_get_direct_base_class_at_index(lldb_type_t type, uint32_t index) LLDB_WRAPPER_NOEXCEPT;
 lldb_type_member_t lldb_type_get_virtual_base_class_at_index(lldb_type_t type, uint32_t index) LLDB_WRAPPER_NOEXCEPT;
 int lldb_type_get_basic_type(lldb_type_t type) LLDB_WRAPPER_NOEXCEPT;
+// Returns the flattened layout of a type whose leaves are all fixed-size
+// scalars. Layouts of named types are cached by defining module UUID,
+// canonical type name and byte size; other layouts are built per call.
+lldb_type_layout_t lldb_type_get_layout(lldb_type_t type, lldb_error_t error) LLDB_WRAPPER_NOEXCEPT;
+
+// Type layouts
+void lldb_type_layout_destroy(lldb_type_layout_t layout) LLDB_WRAPPER_NOEXCEPT;
+void lldb_type_layout_clear_cache(void) LLDB_WRAPPER_NOEXCEPT;
+uint64_t lldb_type_layout_get_byte_size(lldb_type_layout_t layout) LLDB_WRAPPER_NOEXCEPT;
+uint32_t lldb_type_layout_get_num_fields(lldb_type_layout_t layout) LLDB_WRAPPER_NOEXCEPT;
+lldb_ruby_status_t lldb_type_layout_get_field(lldb_type_layout_t layout,
+                                              uint32_t index,
+                                              lldb_ruby_type_layout_field_t* field) LLDB_WRAPPER_NOEXCEPT;
+const char* lldb_type_layout_get_field_name(lldb_type_layout_t layout, uint32_t index) LLDB_WRAPPER_NOEXCEPT;
+// Decodes `count` elements placed `stride` bytes apart (0 for the type size)
+// in `data` into one column per field, in host byte order. columns[i] must
+// hold `count` values of field i's element type; pointers widen to uint64_t.
+lldb_ruby_status_t lldb_type_layout_decode(lldb_type_layout_t layout,
+                                           const void* data,
+                                           size_t data_size,
+                                           uint64_t count,
+                                           uint64_t stride,
+                                           int big_endian,
+                                           void* const* columns,
+                                           size_t column_count) LLDB_WRAPPER_NOEXCEPT;
 
 // SBTypeMember
 void lldb_type_member_destroy(lldb_type_member_t member) LLDB_WRAPPER_NOEXCEPT;
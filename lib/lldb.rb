@@ -13,6 +13,7 @@ require_relative 'lldb/native_lifecycle'
 require_relative 'lldb/native_buffer'
 require_relative 'lldb/api_support'
 require_relative 'lldb/native_string_array'
+require_relative 'lldb/scope'
 require_relative 'lldb/file_spec'
 require_relative 'lldb/file_spec_list'
 require_relative 'lldb/address'
@@ -27,13 +28,23 @@ require_relative 'lldb/target'
 require_relative 'lldb/launch_info'
 require_relative 'lldb/process'
 require_relative 'lldb/memory_region_info'
+require_relative 'lldb/memory_region'
+require_relative 'lldb/memory_snapshot'
+require_relative 'lldb/memory_tracker'
+require_relative 'lldb/value_search'
+require_relative 'lldb/memory_prefetch'
+require_relative 'lldb/profiler'
 require_relative 'lldb/thread'
 require_relative 'lldb/frame'
 require_relative 'lldb/breakpoint'
 require_relative 'lldb/breakpoint_location'
 require_relative 'lldb/value'
+require_relative 'lldb/value_tree'
+require_relative 'lldb/value_children_cursor'
+require_relative 'lldb/value_watch_set'
 require_relative 'lldb/value_list'
 require_relative 'lldb/type'
+require_relative 'lldb/type_layout'
 require_relative 'lldb/type_member'
 require_relative 'lldb/symbol'
 require_relative 'lldb/function'
@@ -94,6 +105,22 @@ module LLDB
       Debugger.create(source_init_files: source_init_files)
     end
 
+    # Run the block with a fresh Scope active on the current thread. Values
+    # and frames created inside it are allocated in bulk and freed together
+    # when the block returns, after which they are closed; copy out anything
+    # that must outlive the block.
+    #
+    # @rbs &block: (Scope) -> untyped
+    # @rbs return: untyped
+    def with_scope(&block)
+      scope = Scope.new
+      begin
+        scope.activate(&block)
+      ensure
+        scope.release
+      end
+    end
+
     # @rbs return: Integer
     def open_debugger_count
       lifecycle_mutex.synchronize { live_debugger_count }
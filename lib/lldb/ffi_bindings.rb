@@ -117,6 +117,14 @@ module LLDB
     attach_function :lldb_initialize, [:pointer], :int
     attach_function :lldb_terminate, [], :void
 
+    # =========================================================================
+    # Handle scopes
+    # =========================================================================
+    attach_function :lldb_scope_create, [], :pointer
+    attach_function :lldb_scope_release, [:pointer], :void
+    attach_function :lldb_scope_activate, [:pointer], :pointer
+    attach_function :lldb_scope_get_num_handles, [:pointer], :uint64
+
     # =========================================================================
     # SBDebugger
     # =========================================================================
@@ -214,6 +222,11 @@ module LLDB
     attach_function :lldb_target_find_watchpoint_by_id, %i[pointer int32], :pointer
     attach_function :lldb_target_get_num_watchpoints, [:pointer], :uint32
     attach_function :lldb_target_get_watchpoint_at_index, %i[pointer uint32], :pointer
+    attach_function :lldb_target_symbolicate,
+                    %i[pointer pointer size_t pointer size_t pointer],
+                    :int, blocking: true
+    attach_function :lldb_symbol_cache_clear, [], :void
+    attach_function :lldb_symbol_cache_get_stats, %i[pointer pointer pointer], :int
 
     # =========================================================================
     # SBLaunchInfo
@@ -326,6 +339,11 @@ module LLDB
     attach_function :lldb_process_destroy, [:pointer], :void
     attach_function :lldb_process_is_valid, [:pointer], :int
     attach_function :lldb_process_continue, %i[pointer pointer], :int, blocking: true
+    attach_function :lldb_process_set_memory_cache, %i[pointer uint32 uint32 pointer], :int
+    attach_function :lldb_process_get_memory_cache_stats, %i[pointer pointer pointer pointer], :int
+    attach_function :lldb_process_flush_memory_cache, [:pointer], :void
+    attach_function :lldb_process_prefetch_memory, %i[pointer pointer size_t pointer], :pointer
+    attach_function :lldb_process_start_profiler, %i[pointer uint32 uint32 pointer], :pointer
     attach_function :lldb_process_stop, %i[pointer pointer], :int
     attach_function :lldb_process_kill, %i[pointer pointer], :int
     attach_function :lldb_process_detach, %i[pointer pointer], :int
@@ -343,10 +361,31 @@ module LLDB
     attach_function :lldb_process_get_exit_status, [:pointer], :int
     attach_function :lldb_process_get_exit_description, [:pointer], :string
     attach_function :lldb_process_read_memory, %i[pointer uint64 pointer size_t pointer], :size_t
+    attach_function :lldb_process_capture_backtraces,
+                    %i[pointer uint32 uint32 pointer size_t pointer],
+                    :int, blocking: true
+    attach_function :lldb_process_read_memory_batch,
+                    %i[pointer pointer size_t pointer size_t pointer pointer],
+                    :int, blocking: true
+    attach_function :lldb_process_read_structs,
+                    %i[pointer uint64 pointer uint64 uint64 pointer size_t pointer pointer],
+                    :int, blocking: true
+    attach_function :lldb_process_read_array,
+                    %i[pointer uint64 uint32 uint64 uint64 pointer size_t pointer pointer],
+                    :int, blocking: true
+    attach_function :lldb_process_walk_links,
+                    %i[pointer uint64 pointer size_t uint64 uint64 uint64 pointer size_t pointer pointer pointer],
+                    :int, blocking: true
     attach_function :lldb_process_write_memory, %i[pointer uint64 pointer size_t pointer], :size_t
+    attach_function :lldb_process_write_memory_batch,
+                    %i[pointer pointer size_t pointer size_t pointer pointer pointer],
+                    :int, blocking: true
     attach_function :lldb_process_allocate_memory, %i[pointer size_t uint32 pointer], :uint64
     attach_function :lldb_process_deallocate_memory, %i[pointer uint64 pointer], :int
     attach_function :lldb_process_read_cstring_from_memory, %i[pointer uint64 pointer size_t pointer], :size_t
+    attach_function :lldb_process_read_cstrings,
+                    %i[pointer pointer size_t size_t pointer size_t pointer pointer],
+                    :int, blocking: true
     attach_function :lldb_process_get_stdout, %i[pointer pointer size_t], :size_t
     attach_function :lldb_process_get_stderr, %i[pointer pointer size_t], :size_t
     attach_function :lldb_process_put_stdin, %i[pointer pointer size_t], :size_t
@@ -355,6 +394,24 @@ module LLDB
     attach_function :lldb_process_get_num_supported_hardware_watchpoints, %i[pointer pointer pointer], :int
     attach_function :lldb_process_get_unique_id, [:pointer], :uint32
     attach_function :lldb_process_get_memory_region_info, %i[pointer uint64 pointer], :pointer
+    attach_function :lldb_process_get_memory_regions,
+                    %i[pointer pointer size_t pointer pointer size_t pointer],
+                    :int, blocking: true
+    attach_function :lldb_process_scan_memory,
+                    %i[pointer pointer pointer size_t pointer pointer size_t pointer pointer],
+                    :int, blocking: true
+    attach_function :lldb_process_find_references,
+                    %i[pointer pointer size_t pointer pointer size_t pointer pointer],
+                    :int, blocking: true
+    attach_function :lldb_process_snapshot_memory,
+                    %i[pointer string pointer pointer pointer pointer],
+                    :int, blocking: true
+    attach_function :lldb_process_create_memory_tracker,
+                    %i[pointer pointer uint32 uint32 pointer],
+                    :pointer, blocking: true
+    attach_function :lldb_process_create_value_search,
+                    %i[pointer pointer uint32 pointer pointer],
+                    :pointer, blocking: true
 
     # =========================================================================
     # SBMemoryRegionInfo
@@ -368,6 +425,40 @@ module LLDB
     attach_function :lldb_memory_region_info_is_mapped, [:pointer], :int
     attach_function :lldb_memory_region_info_get_name, [:pointer], :string
 
+    # Memory snapshots
+    attach_function :lldb_memory_snapshot_open, %i[string pointer], :pointer
+    attach_function :lldb_memory_snapshot_destroy, [:pointer], :void
+    attach_function :lldb_memory_snapshot_get_regions, %i[pointer pointer size_t pointer], :int
+    attach_function :lldb_memory_snapshot_read_memory, %i[pointer uint64 pointer size_t pointer], :size_t
+
+    # Memory trackers
+    attach_function :lldb_memory_tracker_destroy, [:pointer], :void
+    attach_function :lldb_memory_tracker_get_num_pages, [:pointer], :uint64
+    attach_function :lldb_memory_tracker_update, %i[pointer pointer pointer], :int, blocking: true
+    attach_function :lldb_memory_tracker_get_changes, %i[pointer pointer size_t pointer], :int
+
+    # Memory prefetches
+    attach_function :lldb_memory_prefetch_destroy, [:pointer], :void, blocking: true
+    attach_function :lldb_memory_prefetch_cancel, [:pointer], :void
+    attach_function :lldb_memory_prefetch_wait, %i[pointer int64 pointer], :int, blocking: true
+    attach_function :lldb_memory_prefetch_get_fd, [:pointer], :int
+    attach_function :lldb_memory_prefetch_get_num_pages, [:pointer], :uint64
+
+    # Sampling profilers
+    attach_function :lldb_profiler_destroy, [:pointer], :void, blocking: true
+    attach_function :lldb_profiler_stop, [:pointer], :int, blocking: true
+    attach_function :lldb_profiler_is_running, [:pointer], :int
+    attach_function :lldb_profiler_get_stats, %i[pointer pointer], :int
+    attach_function :lldb_profiler_write_profile,
+                    %i[pointer uint32 pointer size_t pointer pointer],
+                    :int, blocking: true
+
+    # Value searches
+    attach_function :lldb_value_search_destroy, [:pointer], :void
+    attach_function :lldb_value_search_get_count, [:pointer], :uint64
+    attach_function :lldb_value_search_narrow, %i[pointer uint32 pointer pointer pointer], :int, blocking: true
+    attach_function :lldb_value_search_get_results, %i[pointer pointer pointer size_t pointer], :int
+
     # =========================================================================
     # SBThread
     # =========================================================================
@@ -426,6 +517,12 @@ module LLDB
     attach_function :lldb_frame_get_symbol_context, %i[pointer uint32], :pointer
     attach_function :lldb_frame_get_variables, %i[pointer int int int int], :pointer
     attach_function :lldb_frame_get_registers, [:pointer], :pointer
+    attach_function :lldb_frame_snapshot_variables,
+                    %i[pointer uint32 uint32 pointer size_t pointer],
+                    :int, blocking: true
+    attach_function :lldb_frame_resolve_paths,
+                    %i[pointer pointer size_t uint32 pointer size_t pointer],
+                    :int, blocking: true
     attach_function :lldb_frame_is_inlined, [:pointer], :int
     attach_function :lldb_frame_disassemble, [:pointer], :string
     attach_function :lldb_frame_get_module, [:pointer], :pointer
@@ -506,6 +603,43 @@ module LLDB
     attach_function :lldb_value_get_expression_path, [:pointer], :string
     attach_function :lldb_value_is_pointer_type, [:pointer], :int
     attach_function :lldb_value_get_non_synthetic_value, [:pointer], :pointer
+    attach_function :lldb_value_get_data, %i[pointer pointer uint64 pointer], :uint64, blocking: true
+    attach_function :lldb_value_get_data_as,
+                    %i[pointer uint32 pointer size_t pointer pointer],
+                    :int, blocking: true
+    attach_function :lldb_value_serialize,
+                    %i[pointer uint32 uint32 uint32 pointer size_t pointer],
+                    :int, blocking: true
+
+    # =========================================================================
+    # Value children cursors
+    # =========================================================================
+    attach_function :lldb_value_children_cursor_create, %i[pointer uint32], :pointer
+    attach_function :lldb_value_children_cursor_destroy, [:pointer], :void
+    attach_function :lldb_value_children_cursor_get_num_children, [:pointer], :uint32
+    attach_function :lldb_value_children_cursor_get_position, [:pointer], :uint32
+    attach_function :lldb_value_children_cursor_next_batch,
+                    %i[pointer uint32 pointer size_t pointer],
+                    :int, blocking: true
+
+    # =========================================================================
+    # Container fast path
+    # =========================================================================
+    attach_function :lldb_value_get_container_info, %i[pointer pointer], :int
+    attach_function :lldb_value_read_container,
+                    %i[pointer uint64 uint64 pointer size_t pointer pointer],
+                    :int, blocking: true
+
+    # =========================================================================
+    # Value watch sets
+    # =========================================================================
+    attach_function :lldb_value_watch_set_create, [], :pointer
+    attach_function :lldb_value_watch_set_destroy, [:pointer], :void
+    attach_function :lldb_value_watch_set_add, %i[pointer string], :uint32
+    attach_function :lldb_value_watch_set_get_count, [:pointer], :uint32
+    attach_function :lldb_value_watch_set_update,
+                    %i[pointer pointer pointer size_t pointer pointer size_t pointer],
+                    :int, blocking: true
 
     # =========================================================================
     # SBValueList
@@ -638,6 +772,20 @@ module LLDB
     attach_function :lldb_type_get_direct_base_class_at_index, %i[pointer uint32], :pointer
     attach_function :lldb_type_get_virtual_base_class_at_index, %i[pointer uint32], :pointer
     attach_function :lldb_type_get_basic_type, [:pointer], :int
+    attach_function :lldb_type_get_layout, %i[pointer pointer], :pointer, blocking: true
+
+    # =========================================================================
+    # Type layouts
+    # =========================================================================
+    attach_function :lldb_type_layout_destroy, [:pointer], :void
+    attach_function :lldb_type_layout_clear_cache, [], :void
+    attach_function :lldb_type_layout_get_byte_size, [:pointer], :uint64
+    attach_function :lldb_type_layout_get_num_fields, [:pointer], :uint32
+    attach_function :lldb_type_layout_get_field, %i[pointer uint32 pointer], :int
+    attach_function :lldb_type_layout_get_field_name, %i[pointer uint32], :string
+    attach_function :lldb_type_layout_decode,
+                    %i[pointer pointer size_t uint64 uint64 int pointer size_t],
+                    :int, blocking: true
     attach_function :lldb_type_member_destroy, [:pointer], :void
     attach_function :lldb_type_member_is_valid, [:pointer], :int
     attach_function :lldb_type_member_get_name, [:pointer], :string
@@ -17,7 +17,8 @@ module LLDB
       initialize_native_object(
         ptr,
         release: ->(released) { FFIBindings.lldb_frame_destroy(released) },
-        context: context
+        context: context,
+        scope: Scope.current
       )
     end
 
@@ -253,6 +254,55 @@ module LLDB
       ValueList.new(list_ptr, parent: self, context: context)
     end
 
+    # Collect the frame's variables with one native call instead of several
+    # per variable. Each entry is a Hash shaped like a Value#to_tree node.
+    # Members are not expanded: :children is nil for a variable that has
+    # children (use find_variable to expand it) and empty for a scalar.
+    #
+    # @rbs arguments: bool
+    # @rbs locals: bool
+    # @rbs statics: bool
+    # @rbs in_scope_only: bool
+    # @rbs summaries: bool
+    # @rbs return: Array[Hash[Symbol, untyped]]
+    def variables_snapshot(arguments: true, locals: true, statics: true, in_scope_only: true, summaries: true)
+      raise InvalidObjectError, 'Frame is not valid' unless valid?
+
+      scope = 0
+      scope |= FrameVariablesFlags::ARGUMENTS if arguments
+      scope |= FrameVariablesFlags::LOCALS if locals
+      scope |= FrameVariablesFlags::STATICS if statics
+      scope |= FrameVariablesFlags::IN_SCOPE_ONLY if in_scope_only
+      flags = ValueSerializeFlags::VALUES | ValueSerializeFlags::TYPE_NAMES | ValueSerializeFlags::LOCATIONS
+      flags |= ValueSerializeFlags::SUMMARIES if summaries
+
+      bytes = NativeBuffer.read_bytes('frame.variables_snapshot') do |buffer, capacity, required|
+        FFIBindings.lldb_frame_snapshot_variables(@ptr, scope, flags, buffer, capacity, required)
+      end
+      ValueTree.decode(bytes)
+    end
+
+    # Resolve many variable paths, such as "req->hdr.len" or "items[2]", with
+    # one native call. Returns one record per path, in order, shaped like the
+    # #variables_snapshot records plus :path; paths that do not resolve have
+    # :error set and the reason in :error_message.
+    #
+    # @rbs paths: Array[String]
+    # @rbs summaries: bool
+    # @rbs return: Array[Hash[Symbol, untyped]]
+    def resolve_paths(paths, summaries: true)
+      raise InvalidObjectError, 'Frame is not valid' unless valid?
+      return [] if paths.empty?
+
+      flags = ValueSerializeFlags::VALUES | ValueSerializeFlags::TYPE_NAMES | ValueSerializeFlags::LOCATIONS
+      flags |= ValueSerializeFlags::SUMMARIES if summaries
+      native_paths = NativeStringArray.new(paths)
+      bytes = NativeBuffer.read_bytes('frame.resolve_paths') do |buffer, capacity, required|
+        FFIBindings.lldb_frame_resolve_paths(@ptr, native_paths.to_ptr, paths.length, flags, buffer, capacity, required)
+      end
+      ValueTree.decode(bytes).each_with_index { |record, index| record[:path] = paths[index] }
+    end
+
     # @rbs return: ValueList
     def get_registers
       raise InvalidObjectError, 'Frame is not valid' unless valid?
@@ -0,0 +1,82 @@
+# frozen_string_literal: true
+
+# rbs_inline: enabled
+
+module LLDB
+  # Background read-ahead started by Process#prefetch. A native worker reads
+  # the requested pages into the process page cache, so later reads of those
+  # ranges during the same stop are served from memory. The prefetch stops on
+  # its own when the process resumes.
+  class MemoryPrefetch
+    prepend NativeLifecycle
+
+    # @rbs ptr: FFI::Pointer
+    # @rbs context: Context?
+    # @rbs return: void
+    def initialize(ptr, context: nil)
+      initialize_native_object(
+        ptr,
+        release: ->(released) { FFIBindings.lldb_memory_prefetch_destroy(released) },
+        context: context
+      )
+    end
+
+    # @rbs return: bool
+    def valid?
+      !@ptr.null?
+    end
+
+    # Block until the worker finishes, or for at most `timeout` seconds.
+    # Other Ruby threads keep running while this waits. Returns whether the
+    # prefetch has finished.
+    #
+    # @rbs timeout: Numeric?
+    # @rbs return: bool
+    def wait(timeout = nil)
+      raise InvalidObjectError, 'MemoryPrefetch is not valid' unless valid?
+
+      completed = FFI::MemoryPointer.new(:int)
+      timeout_ms = timeout.nil? ? -1 : (timeout * 1000).ceil
+      status = FFIBindings.lldb_memory_prefetch_wait(@ptr, timeout_ms, completed)
+      Native.check_status!(status, 'memory_prefetch.wait')
+
+      completed.read_int != 0
+    end
+
+    # @rbs return: bool
+    def done?
+      wait(0)
+    end
+
+    # Ask the worker to stop after the read it is performing.
+    #
+    # @rbs return: nil
+    def cancel
+      FFIBindings.lldb_memory_prefetch_cancel(@ptr) if valid?
+      nil
+    end
+
+    # Number of pages loaded into the cache so far.
+    #
+    # @rbs return: Integer
+    def page_count
+      return 0 unless valid?
+
+      FFIBindings.lldb_memory_prefetch_get_num_pages(@ptr)
+    end
+
+    # An IO that becomes readable when the prefetch finishes, for use with
+    # IO.select or an event loop. The descriptor stays owned by the prefetch
+    # and is closed with it. Returns nil where no descriptor is available.
+    #
+    # @rbs return: IO?
+    def to_io
+      return nil unless valid?
+
+      @io ||= begin
+        fd = FFIBindings.lldb_memory_prefetch_get_fd(@ptr)
+        fd.negative? ? nil : IO.for_fd(fd, autoclose: false)
+      end
+    end
+  end
+end
@@ -0,0 +1,105 @@
+# frozen_string_literal: true
+
+# rbs_inline: enabled
+
+module LLDB
+  # Plain snapshot of one memory region, produced in bulk by
+  # Process#memory_regions. Unlike MemoryRegionInfo it holds no native handle.
+  class MemoryRegion
+    # Number of uint64 fields in each native lldb_ruby_memory_region_t record.
+    RECORD_FIELDS = 5 # : Integer
+    NO_NAME = 0xFFFF_FFFF_FFFF_FFFF # : Integer
+
+    attr_reader :base_address #: Integer
+    attr_reader :end_address #: Integer
+    attr_reader :permission_bits #: Integer
+    attr_reader :name #: String?
+
+    # Decode packed region records and their NUL-separated string table.
+    #
+    # @rbs records: Array[Integer]
+    # @rbs string_table: String
+    # @rbs return: Array[MemoryRegion]
+    def self.unpack(records, string_table)
+      names = {} #: Hash[Integer, String]
+      records.each_slice(RECORD_FIELDS).map do |base, finish, bits, mapped, name_offset|
+        name = nil
+        unless name_offset == NO_NAME
+          name = names[name_offset] ||= begin
+            terminator = string_table.index("\0", name_offset) || string_table.bytesize
+            string_table.byteslice(name_offset, terminator - name_offset).freeze
+          end
+        end
+        new(base, finish, bits, mapped != 0, name)
+      end
+    end
+
+    # @rbs base_address: Integer
+    # @rbs end_address: Integer
+    # @rbs permission_bits: Integer
+    # @rbs mapped: bool
+    # @rbs name: String?
+    # @rbs return: void
+    def initialize(base_address, end_address, permission_bits, mapped, name = nil)
+      @base_address = base_address
+      @end_address = end_address
+      @permission_bits = permission_bits
+      @mapped = mapped
+      @name = name
+      freeze
+    end
+
+    # @rbs return: Integer
+    def size
+      end_address - base_address
+    end
+
+    # @rbs address: Integer
+    # @rbs return: bool
+    def include?(address)
+      address >= base_address && address < end_address
+    end
+
+    # @rbs return: bool
+    def readable?
+      permission_bits.anybits?(Permissions::READABLE)
+    end
+
+    # @rbs return: bool
+    def writable?
+      permission_bits.anybits?(Permissions::WRITABLE)
+    end
+
+    # @rbs return: bool
+    def executable?
+      permission_bits.anybits?(Permissions::EXECUTABLE)
+    end
+
+    # @rbs return: bool
+    def mapped?
+      @mapped
+    end
+
+    # Get the permissions string (e.g., "rwx", "r-x", etc.)
+    #
+    # @rbs return: String
+    def permissions
+      perms = +''
+      perms << (readable? ? 'r' : '-')
+      perms << (writable? ? 'w' : '-')
+      perms << (executable? ? 'x' : '-')
+      perms.freeze
+    end
+
+    # @rbs return: String
+    def to_s
+      format(
+        '0x%016x-0x%016x %s %s',
+        base_address,
+        end_address,
+        permissions,
+        name || ''
+      ).strip
+    end
+  end
+end
@@ -0,0 +1,79 @@
+# frozen_string_literal: true
+
+# rbs_inline: enabled
+
+module LLDB
+  # Read-only view of a file written by Process#snapshot_memory. The file is
+  # memory-mapped and lookups binary-search its region index, so captured
+  # memory can be inspected after the process has been released.
+  class MemorySnapshot
+    prepend NativeLifecycle
+
+    # Number of uint64 fields in each native lldb_ruby_memory_snapshot_region_t record.
+    RECORD_FIELDS = 4 # : Integer
+
+    # @rbs path: String
+    # @rbs return: MemorySnapshot
+    def self.open(path)
+      NativeStringArray.validate!(path)
+      error = Error.new
+      ptr = FFIBindings.lldb_memory_snapshot_open(path, error.to_ptr)
+      error.raise_if_error!('memory_snapshot.open')
+      raise OperationError.new('memory_snapshot.open', error) if ptr.null?
+
+      new(ptr)
+    end
+
+    # @rbs ptr: FFI::Pointer
+    # @rbs return: void
+    def initialize(ptr)
+      initialize_native_object(
+        ptr,
+        release: ->(released) { FFIBindings.lldb_memory_snapshot_destroy(released) }
+      )
+    end
+
+    # @rbs return: bool
+    def valid?
+      !@ptr.null?
+    end
+
+    # Captured regions in address order. Regions that had unreadable pages
+    # are split into several entries.
+    #
+    # @rbs return: Array[MemoryRegion]
+    def regions
+      raise InvalidObjectError, 'MemorySnapshot is not valid' unless valid?
+
+      count = FFI::MemoryPointer.new(:uint64)
+      status = FFIBindings.lldb_memory_snapshot_get_regions(@ptr, nil, 0, count)
+      Native.check_status!(status, 'memory_snapshot.regions')
+      capacity = count.read_uint64
+      records = FFI::MemoryPointer.new(:uint64, [capacity * RECORD_FIELDS, 1].max)
+      status = FFIBindings.lldb_memory_snapshot_get_regions(@ptr, records, capacity, count)
+      Native.check_status!(status, 'memory_snapshot.regions')
+
+      fields = records.read_array_of_uint64(capacity * RECORD_FIELDS)
+      fields.each_slice(RECORD_FIELDS).map do |address, size, _file_offset, bits|
+        MemoryRegion.new(address, address + size, bits, true)
+      end
+    end
+
+    # Read captured memory. Like Process#read_memory, the result may be
+    # shorter than requested when the range runs past the captured bytes.
+    #
+    # @rbs address: Integer
+    # @rbs size: Integer
+    # @rbs return: String
+    def read_memory(address, size)
+      raise InvalidObjectError, 'MemorySnapshot is not valid' unless valid?
+
+      buffer = FFI::MemoryPointer.new(:uint8, [size, 1].max)
+      error = Error.new
+      bytes_read = FFIBindings.lldb_memory_snapshot_read_memory(@ptr, address, buffer, size, error.to_ptr)
+
+      error.raise_if_error!('memory_snapshot.read_memory')
+      buffer.get_bytes(0, bytes_read)
+    end
+  end
+end
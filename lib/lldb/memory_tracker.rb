@@ -0,0 +1,68 @@
+# frozen_string_literal: true
+
+# rbs_inline: enabled
+
+module LLDB
+  # Reports which pages of a process changed between stops. Process#track_memory
+  # hashes the selected pages once; every #update hashes them again on a native
+  # worker pool, compares, and makes the new stop the baseline.
+  class MemoryTracker
+    prepend NativeLifecycle
+
+    # Flag for lldb_process_create_memory_tracker: keep page copies so that
+    # changes are reported as runs of differing bytes.
+    BYTE_DIFF = 1 # : Integer
+    # Number of uint64 fields in each native lldb_ruby_memory_change_t record.
+    RECORD_FIELDS = 3 # : Integer
+    CHANGE_KINDS = { 0 => :modified, 1 => :mapped, 2 => :unmapped }.freeze # : Hash[Integer, Symbol]
+
+    # @rbs ptr: FFI::Pointer
+    # @rbs context: Context?
+    # @rbs return: void
+    def initialize(ptr, context: nil)
+      initialize_native_object(
+        ptr,
+        release: ->(released) { FFIBindings.lldb_memory_tracker_destroy(released) },
+        context: context
+      )
+    end
+
+    # @rbs return: bool
+    def valid?
+      !@ptr.null?
+    end
+
+    # Number of pages in the current baseline.
+    #
+    # @rbs return: Integer
+    def page_count
+      return 0 unless valid?
+
+      FFIBindings.lldb_memory_tracker_get_num_pages(@ptr)
+    end
+
+    # Compare the process memory at the current stop with the previous one.
+    # Each change is a Hash with :address, :size, and :kind (:modified,
+    # :mapped, or :unmapped).
+    #
+    # @rbs return: Array[{ address: Integer, size: Integer, kind: Symbol }]
+    def update
+      raise InvalidObjectError, 'MemoryTracker is not valid' unless valid?
+
+      count = FFI::MemoryPointer.new(:uint64)
+      error = Error.new
+      status = FFIBindings.lldb_memory_tracker_update(@ptr, count, error.to_ptr)
+      Native.check_status!(status, 'memory_tracker.update', error)
+
+      capacity = count.read_uint64
+      records = FFI::MemoryPointer.new(:uint64, [capacity * RECORD_FIELDS, 1].max)
+      status = FFIBindings.lldb_memory_tracker_get_changes(@ptr, records, capacity, count)
+      Native.check_status!(status, 'memory_tracker.update')
+
+      fields = records.read_array_of_uint64(capacity * RECORD_FIELDS)
+      fields.each_slice(RECORD_FIELDS).map do |address, size, kind|
+        { address: address, size: size, kind: CHANGE_KINDS.fetch(kind) }
+      end
+    end
+  end
+end
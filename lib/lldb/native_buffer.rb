@@ -28,5 +28,28 @@ module LLDB
         capacity = [capacity * 2, written + 2].max
       end
     end
+
+    # Calls `writer` with a buffer, its capacity, and a uint64 out pointer
+    # for the required size, growing the buffer until the written bytes fit.
+    # The writer returns a native status; `error` is the Error it reports
+    # failures through, if any.
+    #
+    # @rbs operation: String
+    # @rbs error: Error?
+    # @rbs &writer: (FFI::Pointer, Integer, FFI::Pointer) -> Integer
+    # @rbs return: String
+    def self.read_bytes(operation, error = nil, &writer)
+      required = FFI::MemoryPointer.new(:uint64)
+      capacity = 64 * 1024
+      loop do
+        buffer = FFI::MemoryPointer.new(:uint8, capacity, false)
+        Native.check_status!(writer.call(buffer, capacity, required), operation, error)
+
+        size = required.read_uint64
+        return buffer.get_bytes(0, size) if size <= capacity
+
+        capacity = size
+      end
+    end
   end
 end
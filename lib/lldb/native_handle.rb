@@ -6,15 +6,18 @@ module LLDB
   class NativeHandle
     NULL_POINTER = FFI::Pointer.new(0)
 
+    # A nil `release` marks a pointer owned elsewhere, such as by a Scope;
+    # closing the handle then only detaches it and no finalizer is defined.
+    #
     # @rbs ptr: FFI::Pointer
-    # @rbs release: ^(FFI::Pointer) -> void
+    # @rbs release: (^(FFI::Pointer) -> void)?
     # @rbs return: void
     def initialize(ptr, release:)
       # The resource is detached with Array#shift, which is a single Ruby VM
       # operation. Finalizers cannot safely acquire a Mutex on all supported
       # Rubies, so the detach itself must not depend on one.
       @state = [[ptr, release]]
-      ObjectSpace.define_finalizer(self, self.class.finalizer(@state))
+      ObjectSpace.define_finalizer(self, self.class.finalizer(@state)) if release
     end
 
     # @rbs return: FFI::Pointer
@@ -35,7 +38,7 @@ module LLDB
 
       pointer, release = resource
 
-      release.call(pointer) unless pointer.null?
+      release.call(pointer) if release && !pointer.null?
       true
     end
 
@@ -33,15 +33,24 @@ module LLDB
       @context&.ensure_open!
     end
 
+    # Objects created for a pointer that `scope` owns skip both the finalizer
+    # and context registration; the scope closes them when it is released.
+    #
     # @rbs ptr: FFI::Pointer
     # @rbs release: ^(FFI::Pointer) -> void
     # @rbs context: Context?
+    # @rbs scope: Scope?
     # @rbs return: void
-    def initialize_native_object(ptr, release:, context: nil)
+    def initialize_native_object(ptr, release:, context: nil, scope: nil)
       @ptr = ptr
       @context = context
-      @native_handle = NativeHandle.new(ptr, release: release)
-      context&.register(@native_handle)
+      if scope
+        @native_handle = NativeHandle.new(ptr, release: nil)
+        scope.adopt(self)
+      else
+        @native_handle = NativeHandle.new(ptr, release: release)
+        context&.register(@native_handle)
+      end
     end
 
     # @rbs return: Context?
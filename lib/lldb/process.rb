@@ -15,6 +15,26 @@ module LLDB
       STRUCTURED_DATA = 1 << 5
     end
 
+    # Element types accepted by #read_array, mapped to the native
+    # lldb_ruby_element_type_t value and the FFI type of the decoded element.
+    ARRAY_ELEMENT_TYPES = {
+      int8: [ElementType::INT8, :int8],
+      uint8: [ElementType::UINT8, :uint8],
+      int16: [ElementType::INT16, :int16],
+      uint16: [ElementType::UINT16, :uint16],
+      int32: [ElementType::INT32, :int32],
+      uint32: [ElementType::UINT32, :uint32],
+      int64: [ElementType::INT64, :int64],
+      uint64: [ElementType::UINT64, :uint64],
+      float: [ElementType::FLOAT, :float],
+      double: [ElementType::DOUBLE, :double],
+      pointer: [ElementType::POINTER, :uint64]
+    }.freeze # : Hash[Symbol, [Integer, Symbol]]
+
+    # Layout of lldb_ruby_backtrace_frame_t.
+    BACKTRACE_FRAME_SIZE = 56 # : Integer
+    BACKTRACE_FRAME_FORMAT = 'Q4L6' # : String
+
     # @rbs return: Target?
     attr_reader :target
 
@@ -144,6 +164,32 @@ module LLDB
       (0...num_threads).map { |i| thread_at_index(i) }.compact
     end
 
+    # Capture the stacks of every thread with one native call, up to
+    # `max_depth` frames each (nil for all). Returns a Hash from thread ID to
+    # frames, innermost first, each a Hash with :index, :pc, :sp, :fp,
+    # :function, :file, :line, :inlined, and :truncated (set on the last
+    # frame of a stack cut at max_depth). Every thread has an entry; one that
+    # unwinds to no frames maps to an empty Array. Function names and file
+    # paths are shared frozen Strings; pass functions: false or
+    # line_entries: false to skip symbolicating them.
+    #
+    # @rbs max_depth: Integer?
+    # @rbs functions: bool
+    # @rbs line_entries: bool
+    # @rbs return: Hash[Integer, Array[Hash[Symbol, untyped]]]
+    def capture_backtraces(max_depth: 64, functions: true, line_entries: true)
+      raise InvalidObjectError, 'Process is not valid' unless valid?
+      raise ArgumentError, 'max_depth must be positive' if max_depth && !max_depth.positive?
+
+      flags = 0
+      flags |= BacktraceFlags::FUNCTIONS if functions
+      flags |= BacktraceFlags::LINE_ENTRIES if line_entries
+      bytes = NativeBuffer.read_bytes('process.capture_backtraces') do |buffer, capacity, required|
+        FFIBindings.lldb_process_capture_backtraces(@ptr, max_depth || 0, flags, buffer, capacity, required)
+      end
+      decode_backtraces(bytes)
+    end
+
     # @rbs return: Integer
     def process_id
       return 0 unless valid?
@@ -232,6 +278,444 @@ module LLDB
       buffer.get_bytes(0, bytes_read)
     end
 
+    # Read several memory ranges with one native call. Adjacent and
+    # overlapping ranges are coalesced into a single LLDB read. Each result is
+    # a frozen String of the bytes that were read, or nil when nothing could
+    # be read from that range.
+    #
+    # @rbs ranges: Array[[Integer, Integer]]
+    # @rbs return: Array[String?]
+    def read_memory_batch(ranges)
+      raise InvalidObjectError, 'Process is not valid' unless valid?
+      return [] if ranges.empty?
+
+      offsets = []
+      total_size = 0
+      descriptors = ranges.flat_map do |address, size|
+        raise ArgumentError, 'range size must be non-negative' if size.negative?
+
+        offsets << total_size
+        total_size += size
+        [address, size, offsets.last]
+      end
+
+      descriptor_buffer = FFI::MemoryPointer.new(:uint64, descriptors.length)
+      descriptor_buffer.write_array_of_uint64(descriptors)
+      buffer = FFI::MemoryPointer.new(:uint8, [total_size, 1].max)
+      counts = FFI::MemoryPointer.new(:uint64, ranges.length)
+      error = Error.new
+      status = FFIBindings.lldb_process_read_memory_batch(
+        @ptr,
+        descriptor_buffer,
+        ranges.length,
+        buffer,
+        total_size,
+        counts,
+        error.to_ptr
+      )
+      Native.check_status!(status, 'process.read_memory_batch', error)
+
+      counts.read_array_of_uint64(ranges.length).each_with_index.map do |count, index|
+        next nil if count.zero? && ranges[index][1].positive?
+
+        buffer.get_bytes(offsets[index], count).freeze
+      end
+    end
+
+    # Read `count` numeric elements starting at `address`, converting them
+    # from the target byte order. `stride` is the distance in bytes between
+    # elements and defaults to the element size; a larger stride gathers one
+    # field from an array of structs. Pointers are returned as 64-bit
+    # integers. Pass a typed FFI::MemoryPointer as `into:` to have the native
+    # reader fill it directly; the number of elements read is returned then.
+    #
+    # @rbs address: Integer
+    # @rbs element_type: Symbol
+    # @rbs count: Integer
+    # @rbs stride: Integer?
+    # @rbs into: FFI::Pointer?
+    # @rbs return: Array[Numeric] | Integer
+    def read_array(address, element_type, count, stride: nil, into: nil)
+      raise InvalidObjectError, 'Process is not valid' unless valid?
+      raise ArgumentError, 'count must be non-negative' if count.negative?
+
+      native_type, ffi_type = ARRAY_ELEMENT_TYPES.fetch(element_type) do
+        raise ArgumentError, "unknown element type: #{element_type.inspect}"
+      end
+      buffer = into || FFI::MemoryPointer.new(ffi_type, [count, 1].max)
+      buffer_size = into ? into.size : count * FFI.type_size(ffi_type)
+      elements_read = FFI::MemoryPointer.new(:uint64)
+      error = Error.new
+      status = FFIBindings.lldb_process_read_array(
+        @ptr,
+        address,
+        native_type,
+        count,
+        stride || 0,
+        buffer,
+        buffer_size,
+        elements_read,
+        error.to_ptr
+      )
+      Native.check_status!(status, 'process.read_array', error)
+
+      read = elements_read.read_uint64
+      return read if into
+
+      buffer.public_send(:"read_array_of_#{ffi_type}", read)
+    end
+
+    # Read `count` elements of a struct type and decode them natively into
+    # one Array per field, as TypeLayout#decode does, in the target byte
+    # order. `type` is a Type or a TypeLayout. Elements past the first
+    # unreadable one are left out.
+    #
+    # @rbs address: Integer
+    # @rbs type: Type | TypeLayout
+    # @rbs count: Integer
+    # @rbs stride: Integer?
+    # @rbs return: Hash[String, Array[Numeric]]
+    def read_structs(address, type, count, stride: nil)
+      raise InvalidObjectError, 'Process is not valid' unless valid?
+      raise ArgumentError, 'count must be non-negative' if count.negative?
+
+      layout = type.is_a?(TypeLayout) ? type : type.layout
+      columns, pointers = layout.allocate_columns(count)
+      elements_read = FFI::MemoryPointer.new(:uint64)
+      error = Error.new
+      status = FFIBindings.lldb_process_read_structs(
+        @ptr, address, layout.to_ptr, count, stride || 0, pointers, columns.size, elements_read, error.to_ptr
+      )
+      Native.check_status!(status, 'process.read_structs', error)
+      layout.read_columns(columns, elements_read.read_uint64)
+    end
+
+    # Follow pointers through a linked list or tree in one native call.
+    # `link_offsets` is the offset of the next pointer, or an Array of child
+    # pointer offsets for trees, which are walked in preorder. Nodes already
+    # visited are skipped, so cycles terminate. Returns the node addresses,
+    # the `payload_size` bytes read at `payload_offset` of each node, and
+    # whether the walk revisited a node, hit `max_nodes`, or found an
+    # unreadable node.
+    #
+    # @rbs start: Integer
+    # @rbs link_offsets: Integer | Array[Integer]
+    # @rbs payload_size: Integer
+    # @rbs payload_offset: Integer
+    # @rbs max_nodes: Integer
+    # @rbs return: { addresses: Array[Integer], payloads: Array[String],
+    #              revisited: bool, truncated: bool, read_failed: bool }
+    def walk_links(start, link_offsets, payload_size: 0, payload_offset: 0, max_nodes: 100_000)
+      raise InvalidObjectError, 'Process is not valid' unless valid?
+      raise ArgumentError, 'max_nodes must be non-negative' if max_nodes.negative?
+
+      offsets = Array(link_offsets)
+      offset_buffer = FFI::MemoryPointer.new(:uint64, [offsets.length, 1].max)
+      offset_buffer.write_array_of_uint64(offsets)
+      buffer_size = max_nodes * (8 + payload_size)
+      buffer = FFI::MemoryPointer.new(:uint8, [buffer_size, 1].max)
+      node_count = FFI::MemoryPointer.new(:uint64)
+      walk_flags = FFI::MemoryPointer.new(:uint32)
+      error = Error.new
+      status = FFIBindings.lldb_process_walk_links(
+        @ptr,
+        start,
+        offset_buffer,
+        offsets.length,
+        payload_offset,
+        payload_size,
+        max_nodes,
+        buffer,
+        buffer_size,
+        node_count,
+        walk_flags,
+        error.to_ptr
+      )
+      Native.check_status!(status, 'process.walk_links', error)
+
+      count = node_count.read_uint64
+      flags = walk_flags.read_uint32
+      payload_base = max_nodes * 8
+      {
+        addresses: buffer.read_array_of_uint64(count),
+        payloads: Array.new(count) { |index| buffer.get_bytes(payload_base + (index * payload_size), payload_size) },
+        revisited: flags.anybits?(WalkFlags::REVISITED),
+        truncated: flags.anybits?(WalkFlags::TRUNCATED),
+        read_failed: flags.anybits?(WalkFlags::READ_FAILED)
+      }
+    end
+
+    # Scan readable memory for a byte pattern and return the matching
+    # addresses in ascending order. Each mask byte is ANDed with both memory
+    # and pattern before comparing, so "\x00" marks a wildcard byte. Regions
+    # can be narrowed with Permissions bits and an address window.
+    #
+    # @rbs pattern: String
+    # @rbs mask: String?
+    # @rbs start_address: Integer
+    # @rbs end_address: Integer?
+    # @rbs permissions: Integer
+    # @rbs exclude_permissions: Integer
+    # @rbs max_hits: Integer
+    # @rbs return: Array[Integer]
+    def scan_memory(pattern, mask: nil, start_address: 0, end_address: nil,
+                    permissions: 0, exclude_permissions: 0, max_hits: 1024)
+      raise InvalidObjectError, 'Process is not valid' unless valid?
+      raise ArgumentError, 'pattern must not be empty' if pattern.empty?
+      raise ArgumentError, 'mask must be the same length as pattern' if mask && mask.bytesize != pattern.bytesize
+      raise ArgumentError, 'max_hits must be positive' unless max_hits.positive?
+
+      pattern_buffer = FFI::MemoryPointer.from_string(pattern)
+      mask_buffer = mask && FFI::MemoryPointer.from_string(mask)
+      filter = memory_scan_filter(start_address, end_address, permissions, exclude_permissions)
+      hits = FFI::MemoryPointer.new(:uint64, max_hits)
+      hit_count = FFI::MemoryPointer.new(:uint64)
+      error = Error.new
+      status = FFIBindings.lldb_process_scan_memory(
+        @ptr,
+        pattern_buffer,
+        mask_buffer,
+        pattern.bytesize,
+        filter,
+        hits,
+        max_hits,
+        hit_count,
+        error.to_ptr
+      )
+      Native.check_status!(status, 'process.scan_memory', error)
+
+      hits.read_array_of_uint64(hit_count.read_uint64)
+    end
+
+    # Find every aligned pointer-sized word in the selected regions whose value
+    # falls inside one of `ranges`, given as [address, size] pairs. The scan is
+    # conservative: any integer that looks like a pointer into a range counts.
+    # Only writable regions are scanned by default. Returns the first
+    # `max_references` edges in referrer order, where `range` is the index of
+    # the matching pair in `ranges`, the total number found, and whether the
+    # edges were cut at `max_references`.
+    #
+    # @rbs ranges: Array[[Integer, Integer]]
+    # @rbs permissions: Integer
+    # @rbs exclude_permissions: Integer
+    # @rbs max_references: Integer
+    # @rbs return: { references: Array[{ referrer: Integer, target: Integer, range: Integer }],
+    #              total: Integer, truncated: bool }
+    def find_references(ranges, permissions: Permissions::WRITABLE, exclude_permissions: 0,
+                        max_references: 65_536)
+      raise InvalidObjectError, 'Process is not valid' unless valid?
+      raise ArgumentError, 'max_references must be positive' unless max_references.positive?
+      return { references: [], total: 0, truncated: false } if ranges.empty?
+
+      range_buffer = FFI::MemoryPointer.new(:uint64, ranges.length * 2)
+      range_buffer.write_array_of_uint64(ranges.flat_map { |address, size| [address, size] })
+      filter = memory_scan_filter(0, nil, permissions, exclude_permissions)
+      reference_count = FFI::MemoryPointer.new(:uint64)
+      # Most scans find few edges; rescan with a larger buffer only when the
+      # first one overflows.
+      capacity = [max_references, 1024].min
+      loop do
+        records = FFI::MemoryPointer.new(:uint64, capacity * 3, false)
+        error = Error.new
+        status = FFIBindings.lldb_process_find_references(
+          @ptr, range_buffer, ranges.length, filter, records, capacity, reference_count, error.to_ptr
+        )
+        Native.check_status!(status, 'process.find_references', error)
+
+        total = reference_count.read_uint64
+        if total > capacity && capacity < max_references
+          capacity = [total, max_references].min
+          next
+        end
+
+        words = records.read_array_of_uint64([total, capacity].min * 3)
+        references = words.each_slice(3).map do |referrer, target, range|
+          { referrer: referrer, target: target, range: range }
+        end
+        return { references: references, total: total, truncated: total > capacity }
+      end
+    end
+
+    # Write every readable region of the stopped process to `path` in the
+    # memory-mappable layout documented in lldb_wrapper.h. Open the file with
+    # MemorySnapshot.open to read it back after the process is released.
+    #
+    # @rbs path: String
+    # @rbs permissions: Integer
+    # @rbs exclude_permissions: Integer
+    # @rbs return: { regions: Integer, bytes: Integer }
+    def snapshot_memory(path, permissions: 0, exclude_permissions: 0)
+      raise InvalidObjectError, 'Process is not valid' unless valid?
+
+      path = path.to_s
+      NativeStringArray.validate!(path)
+      filter = memory_scan_filter(0, nil, permissions, exclude_permissions)
+      region_count = FFI::MemoryPointer.new(:uint64)
+      bytes_written = FFI::MemoryPointer.new(:uint64)
+      error = Error.new
+      status = FFIBindings.lldb_process_snapshot_memory(
+        @ptr, path, filter, region_count, bytes_written, error.to_ptr
+      )
+      Native.check_status!(status, 'process.snapshot_memory', error)
+
+      { regions: region_count.read_uint64, bytes: bytes_written.read_uint64 }
+    end
+
+    # Hash the selected pages now so that MemoryTracker#update can report
+    # which of them changed at a later stop. Only writable regions are
+    # tracked by default. With byte_diff: true the tracker keeps a copy of
+    # every page and reports runs of changed bytes instead of whole pages.
+    #
+    # @rbs permissions: Integer
+    # @rbs exclude_permissions: Integer
+    # @rbs page_size: Integer
+    # @rbs byte_diff: bool
+    # @rbs return: MemoryTracker
+    def track_memory(permissions: Permissions::WRITABLE, exclude_permissions: 0, page_size: 4096, byte_diff: false)
+      raise InvalidObjectError, 'Process is not valid' unless valid?
+
+      filter = memory_scan_filter(0, nil, permissions, exclude_permissions)
+      error = Error.new
+      ptr = FFIBindings.lldb_process_create_memory_tracker(
+        @ptr, filter, page_size, byte_diff ? MemoryTracker::BYTE_DIFF : 0, error.to_ptr
+      )
+      error.raise_if_error!('process.track_memory')
+      raise OperationError.new('process.track_memory', error) if ptr.null?
+
+      MemoryTracker.new(ptr, context: context)
+    end
+
+    # Start a value hunt: find every naturally aligned `element_type` element
+    # in the selected regions (writable ones by default) that holds `value`.
+    # Narrow the returned ValueSearch at later stops to find the address that
+    # tracks a counter or flag.
+    #
+    # @rbs value: Numeric
+    # @rbs element_type: Symbol
+    # @rbs permissions: Integer
+    # @rbs exclude_permissions: Integer
+    # @rbs return: ValueSearch
+    def search_value(value, element_type = :int32, permissions: Permissions::WRITABLE, exclude_permissions: 0)
+      raise InvalidObjectError, 'Process is not valid' unless valid?
+
+      native_type, ffi_type = ARRAY_ELEMENT_TYPES.fetch(element_type) do
+        raise ArgumentError, "unknown element type: #{element_type.inspect}"
+      end
+      raise ArgumentError, 'pointer elements cannot be searched' if element_type == :pointer
+
+      filter = memory_scan_filter(0, nil, permissions, exclude_permissions)
+      value_buffer = FFI::MemoryPointer.new(ffi_type)
+      value_buffer.public_send(:"write_#{ffi_type}", value)
+      error = Error.new
+      ptr = FFIBindings.lldb_process_create_value_search(@ptr, filter, native_type, value_buffer, error.to_ptr)
+      error.raise_if_error!('process.search_value')
+      raise OperationError.new('process.search_value', error) if ptr.null?
+
+      ValueSearch.new(ptr, element_type, ffi_type, context: context)
+    end
+
+    # Serve repeated memory reads during one stop from a native page cache.
+    # Cached pages are dropped whenever the process stop ID changes and when
+    # memory is written or deallocated through this binding. LLDB does not
+    # report the target page size, so pass it explicitly for non-4 KiB targets.
+    #
+    # @rbs page_size: Integer
+    # @rbs max_pages: Integer
+    # @rbs return: true
+    def enable_memory_cache(page_size: 4096, max_pages: 1024)
+      raise InvalidObjectError, 'Process is not valid' unless valid?
+      raise ArgumentError, 'max_pages must be positive' unless max_pages.positive?
+
+      native_operation('process.enable_memory_cache') do |error|
+        FFIBindings.lldb_process_set_memory_cache(@ptr, page_size, max_pages, error.to_ptr)
+      end
+    end
+
+    # @rbs return: true
+    def disable_memory_cache
+      raise InvalidObjectError, 'Process is not valid' unless valid?
+
+      native_operation('process.disable_memory_cache') do |error|
+        FFIBindings.lldb_process_set_memory_cache(@ptr, 0, 0, error.to_ptr)
+      end
+    end
+
+    # @rbs return: nil
+    def flush_memory_cache
+      raise InvalidObjectError, 'Process is not valid' unless valid?
+
+      FFIBindings.lldb_process_flush_memory_cache(@ptr)
+      nil
+    end
+
+    # @rbs return: Hash[Symbol, Integer]
+    def memory_cache_stats
+      raise InvalidObjectError, 'Process is not valid' unless valid?
+
+      hits = FFI::MemoryPointer.new(:uint64)
+      misses = FFI::MemoryPointer.new(:uint64)
+      pages = FFI::MemoryPointer.new(:uint64)
+      status = FFIBindings.lldb_process_get_memory_cache_stats(@ptr, hits, misses, pages)
+      Native.check_status!(status, 'process.memory_cache_stats')
+      { hits: hits.read_uint64, misses: misses.read_uint64, pages: pages.read_uint64 }
+    end
+
+    # Start reading the pages that cover `ranges`, given as [address, size]
+    # pairs, into the page cache on a native worker thread. A default cache
+    # is enabled if none is configured, and at most its capacity is read.
+    # Reads of these ranges later in the same stop are served from memory;
+    # resuming the process cancels the prefetch.
+    #
+    # @rbs ranges: Array[[Integer, Integer]]
+    # @rbs return: MemoryPrefetch
+    def prefetch(ranges)
+      raise InvalidObjectError, 'Process is not valid' unless valid?
+
+      range_buffer = FFI::MemoryPointer.new(:uint64, [ranges.length * 2, 1].max)
+      range_buffer.write_array_of_uint64(ranges.flat_map { |address, size| [address, size] })
+      error = Error.new
+      ptr = FFIBindings.lldb_process_prefetch_memory(@ptr, range_buffer, ranges.length, error.to_ptr)
+      error.raise_if_error!('process.prefetch')
+      raise OperationError.new('process.prefetch', error) if ptr.null?
+
+      MemoryPrefetch.new(ptr, context: context)
+    end
+
+    # Start a sampling profiler: a native thread interrupts the process every
+    # `interval` seconds, records the stack of every thread, up to
+    # `max_depth` frames (nil for all), and resumes it. No Ruby code runs per
+    # sample. The debugger must be asynchronous, and stops made by anyone
+    # else, such as breakpoints, are left alone. With a block, the profiler
+    # is stopped when the block returns.
+    #
+    # @rbs interval: Numeric
+    # @rbs max_depth: Integer?
+    # @rbs &block: ? (Profiler) -> void
+    # @rbs return: Profiler
+    def start_profiler(interval: 0.01, max_depth: 128)
+      raise InvalidObjectError, 'Process is not valid' unless valid?
+      raise ArgumentError, 'max_depth must be positive' if max_depth && !max_depth.positive?
+
+      interval_us = (interval * 1_000_000).round
+      raise ArgumentError, 'interval must be at least a microsecond' unless interval_us.positive?
+      raise ArgumentError, 'interval is too long' if interval_us > 0xffff_ffff
+
+      error = Error.new
+      ptr = FFIBindings.lldb_process_start_profiler(@ptr, interval_us, max_depth || 0, error.to_ptr)
+      error.raise_if_error!('process.start_profiler')
+      raise OperationError.new('process.start_profiler', error) if ptr.null?
+
+      profiler = Profiler.new(ptr, context: context)
+      return profiler unless block_given?
+
+      begin
+        yield profiler
+      ensure
+        profiler.stop
+      end
+      profiler
+    end
+
     # @rbs address: Integer
     # @rbs data: String
     # @rbs return: Integer
@@ -248,6 +732,48 @@ module LLDB
       bytes_written
     end
 
+    # Write several [address, data] pairs with one native call, in order.
+    # Every write is attempted even after one fails. `written` holds the byte
+    # count of each write; `failed_index` is the index of the first write that
+    # was not fully applied, with its LLDB error in `error`, or nil.
+    #
+    # @rbs writes: Array[[Integer, String]]
+    # @rbs return: { written: Array[Integer], failed_index: Integer?, error: Error? }
+    def write_memory_batch(writes)
+      raise InvalidObjectError, 'Process is not valid' unless valid?
+      return { written: [], failed_index: nil, error: nil } if writes.empty?
+
+      total_size = 0
+      descriptors = writes.flat_map do |address, data|
+        offset = total_size
+        total_size += data.bytesize
+        [address, data.bytesize, offset]
+      end
+
+      descriptor_buffer = FFI::MemoryPointer.new(:uint64, descriptors.length)
+      descriptor_buffer.write_array_of_uint64(descriptors)
+      buffer = FFI::MemoryPointer.new(:uint8, [total_size, 1].max)
+      buffer.put_bytes(0, writes.map { |_address, data| data.b }.join)
+      counts = FFI::MemoryPointer.new(:uint64, writes.length)
+      first_failure = FFI::MemoryPointer.new(:uint64)
+      error = Error.new
+      status = FFIBindings.lldb_process_write_memory_batch(
+        @ptr,
+        descriptor_buffer,
+        writes.length,
+        buffer,
+        total_size,
+        counts,
+        first_failure,
+        error.to_ptr
+      )
+      Native.check_status!(status, 'process.write_memory_batch', error)
+
+      failed_index = first_failure.read_uint64
+      failed_index = nil if failed_index == 0xFFFF_FFFF_FFFF_FFFF
+      { written: counts.read_array_of_uint64(writes.length), failed_index: failed_index, error: failed_index && error }
+    end
+
     # @rbs size: Integer
     # @rbs permissions: Integer
     # @rbs return: Integer
@@ -293,6 +819,39 @@ module LLDB
       bytes.delete_suffix("\0")
     end
 
+    # Read the NUL-terminated string at each address with one native call,
+    # fetching whole target pages so that packed tables such as argv or a
+    # symbol-name pool need only a few reads. Strings are cut at `max_size`
+    # bytes; an address that cannot be read yields nil.
+    #
+    # @rbs addresses: Array[Integer]
+    # @rbs max_size: Integer
+    # @rbs return: Array[String?]
+    def read_cstrings(addresses, max_size: 1024)
+      raise InvalidObjectError, 'Process is not valid' unless valid?
+      raise ArgumentError, 'max_size must be non-negative' if max_size.negative?
+      return [] if addresses.empty?
+
+      address_buffer = FFI::MemoryPointer.new(:uint64, addresses.length)
+      address_buffer.write_array_of_uint64(addresses)
+      buffer_size = addresses.length * (max_size + 1)
+      buffer = FFI::MemoryPointer.new(:uint8, buffer_size, false)
+      offsets = FFI::MemoryPointer.new(:uint64, addresses.length + 1)
+      error = Error.new
+      status = FFIBindings.lldb_process_read_cstrings(
+        @ptr, address_buffer, addresses.length, max_size, buffer, buffer_size, offsets, error.to_ptr
+      )
+      Native.check_status!(status, 'process.read_cstrings', error)
+
+      bounds = offsets.read_array_of_uint64(addresses.length + 1)
+      blob = buffer.get_bytes(0, bounds.last)
+      bounds.each_cons(2).map do |start, finish|
+        next nil if start == finish
+
+        blob.byteslice(start, finish - start - 1)
+      end
+    end
+
     # @rbs max_size: Integer
     # @rbs return: String
     def get_stdout(max_size = 4096)
@@ -381,6 +940,36 @@ module LLDB
       MemoryRegionInfo.new(info_ptr, context: context)
     end
 
+    # Enumerate the whole address space in one native call.
+    #
+    # @rbs return: Array[MemoryRegion]
+    def memory_regions
+      raise InvalidObjectError, 'Process is not valid' unless valid?
+
+      region_capacity = 256
+      names_capacity = 16 * 1024
+      loop do
+        records = FFI::MemoryPointer.new(:uint64, region_capacity * MemoryRegion::RECORD_FIELDS)
+        names = FFI::MemoryPointer.new(:char, names_capacity)
+        region_count = FFI::MemoryPointer.new(:uint64)
+        names_size = FFI::MemoryPointer.new(:uint64)
+        status = FFIBindings.lldb_process_get_memory_regions(
+          @ptr, records, region_capacity, region_count, names, names_capacity, names_size
+        )
+        Native.check_status!(status, 'process.memory_regions')
+
+        count = region_count.read_uint64
+        table_size = names_size.read_uint64
+        if count <= region_capacity && table_size <= names_capacity
+          return MemoryRegion.unpack(records.read_array_of_uint64(count * MemoryRegion::RECORD_FIELDS),
+                                     names.get_bytes(0, table_size))
+        end
+
+        region_capacity = [count, 1].max
+        names_capacity = [table_size, 1].max
+      end
+    end
+
     # @rbs return: FFI::Pointer
     def to_ptr
       @ptr
@@ -388,6 +977,50 @@ module LLDB
 
     private
 
+    # Packs an lldb_ruby_memory_scan_filter_t. An end address of nil or 0
+    # means the top of the address space.
+    #
+    # @rbs start_address: Integer
+    # @rbs end_address: Integer?
+    # @rbs permissions: Integer
+    # @rbs exclude_permissions: Integer
+    # @rbs return: FFI::MemoryPointer
+    def memory_scan_filter(start_address, end_address, permissions, exclude_permissions)
+      filter = FFI::MemoryPointer.new(:uint64, 4)
+      filter.write_array_of_uint64([start_address, end_address || 0, permissions, exclude_permissions])
+      filter
+    end
+
+    # @rbs bytes: String
+    # @rbs return: Hash[Integer, Array[Hash[Symbol, untyped]]]
+    def decode_backtraces(bytes)
+      thread_count, frame_count, frame_size, _reserved, strings_offset, strings_size = bytes.unpack('L4Q2')
+      strings = {}
+      offset = 0
+      bytes.byteslice(strings_offset, strings_size).split("\0", -1)[0...-1].each do |string|
+        strings[offset] = string.freeze
+        offset += string.bytesize + 1
+      end
+
+      backtraces = bytes.byteslice(32, thread_count * 8).unpack('Q*').to_h { |thread_id| [thread_id, []] }
+      format = "#{BACKTRACE_FRAME_FORMAT}x#{frame_size - BACKTRACE_FRAME_SIZE}"
+      fields = bytes.byteslice(32 + (thread_count * 8), frame_count * frame_size).unpack(format * frame_count)
+      fields.each_slice(10) do |thread_id, pc, sp, fp, index, function, file, line, flags, _|
+        backtraces[thread_id] << {
+          index: index,
+          pc: pc,
+          sp: sp,
+          fp: fp,
+          function: strings[function],
+          file: strings[file],
+          line: line.zero? ? nil : line,
+          inlined: flags.anybits?(BacktraceFrameFlags::INLINED),
+          truncated: flags.anybits?(BacktraceFrameFlags::TRUNCATED)
+        }
+      end
+      backtraces
+    end
+
     # @rbs operation: String
     # @rbs &block: (Error) -> Integer
     # @rbs return: true
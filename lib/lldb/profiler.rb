@@ -0,0 +1,106 @@
+# frozen_string_literal: true
+
+# rbs_inline: enabled
+
+module LLDB
+  # A sampling profiler started by Process#start_profiler. A native thread
+  # interrupts the process at a fixed interval, adds the stack of every
+  # thread to a trie of PCs and resumes it. Stacks are symbolicated once,
+  # when the profile is first written after sampling ends.
+  class Profiler
+    prepend NativeLifecycle
+
+    FORMATS = { folded: ProfileFormat::FOLDED, pprof: ProfileFormat::PPROF }.freeze # : Hash[Symbol, Integer]
+
+    # @rbs ptr: FFI::Pointer
+    # @rbs context: Context?
+    # @rbs return: void
+    def initialize(ptr, context: nil)
+      initialize_native_object(
+        ptr,
+        release: ->(released) { FFIBindings.lldb_profiler_destroy(released) },
+        context: context
+      )
+    end
+
+    # @rbs return: bool
+    def valid?
+      !@ptr.null?
+    end
+
+    # End sampling and wait for the sampling thread, resuming the process if
+    # it was interrupted for a sample. Sampling also ends on its own when the
+    # process exits.
+    #
+    # @rbs return: self
+    def stop
+      raise InvalidObjectError, 'Profiler is not valid' unless valid?
+
+      Native.check_status!(FFIBindings.lldb_profiler_stop(@ptr), 'profiler.stop')
+      self
+    end
+
+    # @rbs return: bool
+    def running?
+      return false unless valid?
+
+      FFIBindings.lldb_profiler_is_running(@ptr) != 0
+    end
+
+    # Sampling counters, readable while sampling runs: :samples taken,
+    # :missed ticks (the process was stopped by someone else or did not stop
+    # in time), trie :nodes, and :elapsed, :paused and :max_pause in seconds.
+    # :overhead is the share of the elapsed time the process spent paused.
+    #
+    # @rbs return: Hash[Symbol, Numeric]
+    def stats
+      raise InvalidObjectError, 'Profiler is not valid' unless valid?
+
+      record = FFI::MemoryPointer.new(:uint64, 6)
+      Native.check_status!(FFIBindings.lldb_profiler_get_stats(@ptr, record), 'profiler.stats')
+      samples, missed, elapsed, paused, max_pause, nodes = record.get_bytes(0, record.size).unpack('Q6')
+      {
+        samples: samples,
+        missed: missed,
+        nodes: nodes,
+        elapsed: elapsed / 1e9,
+        paused: paused / 1e9,
+        max_pause: max_pause / 1e9,
+        overhead: elapsed.zero? ? 0.0 : paused.fdiv(elapsed)
+      }
+    end
+
+    # @rbs return: Integer
+    def sample_count
+      stats[:samples]
+    end
+
+    # The profile once sampling has ended: :folded returns one
+    # "outermost;...;innermost count" line per distinct stack, the input of
+    # flamegraph.pl and speedscope; :pprof returns an uncompressed pprof
+    # Profile message for `go tool pprof`.
+    #
+    # @rbs format: Symbol
+    # @rbs return: String
+    def profile(format = :folded)
+      raise InvalidObjectError, 'Profiler is not valid' unless valid?
+
+      code = FORMATS.fetch(format) { raise ArgumentError, "unknown profile format: #{format.inspect}" }
+      error = Error.new
+      bytes = NativeBuffer.read_bytes('profiler.profile', error) do |buffer, capacity, required|
+        FFIBindings.lldb_profiler_write_profile(@ptr, code, buffer, capacity, required, error.to_ptr)
+      end
+      format == :folded ? bytes.force_encoding(Encoding::UTF_8) : bytes
+    end
+
+    # @rbs return: String
+    def folded
+      profile(:folded)
+    end
+
+    # @rbs return: String
+    def pprof
+      profile(:pprof)
+    end
+  end
+end
@@ -0,0 +1,77 @@
+# frozen_string_literal: true
+
+# rbs_inline: enabled
+
+module LLDB
+  # Arena for the Value and Frame handles created on one thread. While a scope
+  # is active, the native library allocates those handles from the scope's
+  # slabs and Ruby registers no finalizer for them; releasing the scope closes
+  # every adopted object and frees the handles with a single call. Use
+  # LLDB.with_scope rather than creating scopes directly.
+  class Scope
+    prepend NativeLifecycle
+
+    # @rbs return: Scope?
+    def self.current
+      ::Thread.current.thread_variable_get(:lldb_scope)
+    end
+
+    # @rbs return: void
+    def initialize
+      ptr = FFIBindings.lldb_scope_create
+      raise LLDBError, 'Failed to create scope' if ptr.nil? || ptr.null?
+
+      @objects = [] # : Array[Value | Frame]
+      initialize_native_object(ptr, release: ->(released) { FFIBindings.lldb_scope_release(released) })
+    end
+
+    # @rbs return: bool
+    def valid?
+      !@ptr.null?
+    end
+
+    # @rbs object: Value | Frame
+    # @rbs return: void
+    def adopt(object)
+      @objects << object
+    end
+
+    # Number of native handles allocated from this scope.
+    #
+    # @rbs return: Integer
+    def handle_count
+      return 0 unless valid?
+
+      FFIBindings.lldb_scope_get_num_handles(@ptr)
+    end
+
+    # Make this scope the active one on the current thread for the duration
+    # of the block, restoring the previously active scope afterwards.
+    #
+    # @rbs &block: (Scope) -> untyped
+    # @rbs return: untyped
+    def activate
+      raise InvalidObjectError, 'Scope is not valid' unless valid?
+
+      previous = Scope.current
+      previous_ptr = FFIBindings.lldb_scope_activate(@ptr)
+      ::Thread.current.thread_variable_set(:lldb_scope, self)
+      begin
+        yield self
+      ensure
+        ::Thread.current.thread_variable_set(:lldb_scope, previous)
+        FFIBindings.lldb_scope_activate(previous_ptr)
+      end
+    end
+
+    alias release close
+
+    private
+
+    # @rbs return: void
+    def close_context
+      @objects.each(&:close)
+      @objects.clear
+    end
+  end
+end
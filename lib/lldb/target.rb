@@ -6,6 +6,9 @@ module LLDB
   class Target
     prepend NativeLifecycle
 
+    SYMBOL_SCOPE_SIZE = 32 # : Integer
+    SYMBOL_SCOPE_FORMAT = 'QL6' # : String
+
     # @rbs return: Debugger
     attr_reader :debugger
 
@@ -30,6 +33,26 @@ module LLDB
       ->(_id) { FFIBindings.lldb_target_destroy(ptr) unless ptr.null? }
     end
 
+    # Drop every cached symbolication. See #symbolicate.
+    #
+    # @rbs return: void
+    def self.clear_symbol_cache
+      FFIBindings.lldb_symbol_cache_clear
+    end
+
+    # Lookups served from the symbolication cache (:hits), lookups that had
+    # to resolve the address (:misses), and cached addresses (:entries).
+    #
+    # @rbs return: Hash[Symbol, Integer]
+    def self.symbol_cache_stats
+      hits = FFI::MemoryPointer.new(:uint64)
+      misses = FFI::MemoryPointer.new(:uint64)
+      entries = FFI::MemoryPointer.new(:uint64)
+      status = FFIBindings.lldb_symbol_cache_get_stats(hits, misses, entries)
+      Native.check_status!(status, 'target.symbol_cache_stats')
+      { hits: hits.read_uint64, misses: misses.read_uint64, entries: entries.read_uint64 }
+    end
+
     # @rbs return: bool
     def valid?
       !@ptr.null? && FFIBindings.lldb_target_is_valid(@ptr) != 0
@@ -424,10 +447,66 @@ module LLDB
       (0...num_watchpoints).map { |i| watchpoint_at_index(i) }.compact
     end
 
+    # Symbolicate load addresses with one native call. Results are cached
+    # process-wide by module UUID and file address, so addresses seen
+    # before, such as the PCs of repeated stack captures, cost a hash lookup;
+    # a module's entries are dropped when it is loaded, unloaded or gains
+    # symbols, and modules without a UUID are not cached. Addresses are looked up as given: use return address - 1 for
+    # caller frames. Returns one Hash per address with :address, :module,
+    # :function, :file, :line and :column of the innermost scope, and
+    # :inlined_into, the scopes it is inlined into from the innermost out,
+    # each with :function, :file, :line and :column of the call site.
+    #
+    # @rbs addresses: Array[Integer]
+    # @rbs return: Array[Hash[Symbol, untyped]]
+    def symbolicate(addresses)
+      raise InvalidObjectError, 'Target is not valid' unless valid?
+
+      address_buffer = FFI::MemoryPointer.new(:uint64, [addresses.length, 1].max)
+      address_buffer.write_array_of_uint64(addresses)
+      bytes = NativeBuffer.read_bytes('target.symbolicate') do |buffer, capacity, required|
+        FFIBindings.lldb_target_symbolicate(@ptr, address_buffer, addresses.length, buffer, capacity, required)
+      end
+      decode_symbolication(bytes)
+    end
+
     # @rbs return: FFI::Pointer
     def to_ptr
       @ptr
     end
 
+    private
+
+    # @rbs bytes: String
+    # @rbs return: Array[Hash[Symbol, untyped]]
+    def decode_symbolication(bytes)
+      _addresses, scope_count, scope_size, _reserved, strings_offset, strings_size = bytes.unpack('L4Q2')
+      strings = {}
+      offset = 0
+      bytes.byteslice(strings_offset, strings_size).split("\0", -1)[0...-1].each do |string|
+        strings[offset] = string.freeze
+        offset += string.bytesize + 1
+      end
+
+      format = "#{SYMBOL_SCOPE_FORMAT}x#{scope_size - SYMBOL_SCOPE_SIZE}"
+      fields = bytes.byteslice(32, scope_count * scope_size).unpack(format * scope_count)
+      results = []
+      caller_scope = false
+      fields.each_slice(7) do |address, module_name, function, file, line, column, flags|
+        scope = {
+          function: strings[function],
+          file: strings[file],
+          line: line.zero? ? nil : line,
+          column: column.zero? ? nil : column
+        }
+        if caller_scope
+          results.last[:inlined_into] << scope
+        else
+          results << { address: address, module: strings[module_name], **scope, inlined_into: [] }
+        end
+        caller_scope = flags.anybits?(SymbolScopeFlags::INLINED)
+      end
+      results
+    end
   end
 end
@@ -220,6 +220,21 @@ module LLDB
       FFIBindings.lldb_type_get_basic_type(@ptr)
     end
 
+    # Flattened layout of this type for decoding raw memory; see TypeLayout.
+    # Raises when a leaf is not a fixed-size scalar.
+    #
+    # @rbs return: TypeLayout
+    def layout
+      raise InvalidObjectError, 'Type is not valid' unless valid?
+
+      error = Error.new
+      ptr = FFIBindings.lldb_type_get_layout(@ptr, error.to_ptr)
+      error.raise_if_error!('type.layout')
+      raise OperationError.new('type.layout', error) if ptr.null?
+
+      TypeLayout.new(ptr, context: context)
+    end
+
     # @rbs return: String
     def to_s
       display_type_name || name || '(unknown type)'
@@ -0,0 +1,131 @@
+# frozen_string_literal: true
+
+# rbs_inline: enabled
+
+module LLDB
+  # Flattened scalar layout of a Type, built natively from its fields and
+  # cached per canonical type of each module. Decoding goes straight from raw
+  # target bytes to one Array per field, without creating a Value for any
+  # element.
+  class TypeLayout
+    prepend NativeLifecycle
+
+    # Element type symbols by native lldb_ruby_element_type_t value.
+    ELEMENT_TYPES = Process::ARRAY_ELEMENT_TYPES.transform_values(&:first).invert.freeze # : Hash[Integer, Symbol]
+
+    # @rbs ptr: FFI::Pointer
+    # @rbs context: Context?
+    # @rbs return: void
+    def initialize(ptr, context: nil)
+      initialize_native_object(
+        ptr,
+        release: ->(released) { FFIBindings.lldb_type_layout_destroy(released) },
+        context: context
+      )
+    end
+
+    # Drop every cached layout. Layouts already handed out stay usable.
+    #
+    # @rbs return: void
+    def self.clear_cache
+      FFIBindings.lldb_type_layout_clear_cache
+    end
+
+    # @rbs return: bool
+    def valid?
+      !@ptr.null?
+    end
+
+    # @rbs return: Integer
+    def byte_size
+      return 0 unless valid?
+
+      FFIBindings.lldb_type_layout_get_byte_size(@ptr)
+    end
+
+    # Each field is a Hash with :name (the member path, such as "origin.x" or
+    # "tags[2]"), :offset, :type (an element type symbol as accepted by
+    # Process#read_array), and :bit_offset and :bit_size for bitfields.
+    # Unnamed and zero-width bitfields are padding and have no field. Names
+    # are unique: a member that repeats an earlier name, such as one hiding a
+    # base class member, is suffixed "#2", "#3", and so on.
+    #
+    # @rbs return: Array[Hash[Symbol, untyped]]
+    def fields
+      raise InvalidObjectError, 'TypeLayout is not valid' unless valid?
+
+      @fields ||= begin
+        record = FFI::MemoryPointer.new(:uint64, 3)
+        Array.new(FFIBindings.lldb_type_layout_get_num_fields(@ptr)) do |index|
+          status = FFIBindings.lldb_type_layout_get_field(@ptr, index, record)
+          Native.check_status!(status, 'type_layout.fields')
+
+          element_type, bit_offset, bit_size = record.get_array_of_uint32(8, 3)
+          {
+            name: FFIBindings.lldb_type_layout_get_field_name(@ptr, index),
+            offset: record.read_uint64,
+            type: ELEMENT_TYPES.fetch(element_type),
+            bit_offset: bit_offset,
+            bit_size: bit_size
+          }.freeze
+        end.freeze
+      end
+    end
+
+    # Decode elements from raw target bytes, such as the result of
+    # Process#read_memory. `count` defaults to as many elements as fit; pass
+    # big_endian: true for big-endian targets. Returns a Hash from field name
+    # to an Array with one value per element.
+    #
+    # @rbs bytes: String
+    # @rbs count: Integer?
+    # @rbs stride: Integer?
+    # @rbs big_endian: bool
+    # @rbs return: Hash[String, Array[Numeric]]
+    def decode(bytes, count: nil, stride: nil, big_endian: false)
+      raise InvalidObjectError, 'TypeLayout is not valid' unless valid?
+
+      stride ||= byte_size
+      count ||= bytes.bytesize < byte_size ? 0 : ((bytes.bytesize - byte_size) / stride) + 1
+      raise ArgumentError, 'count must be non-negative' if count.negative?
+
+      columns, pointers = allocate_columns(count)
+      data = FFI::MemoryPointer.new(:uint8, [bytes.bytesize, 1].max)
+      data.put_bytes(0, bytes)
+      status = FFIBindings.lldb_type_layout_decode(
+        @ptr, data, bytes.bytesize, count, stride, big_endian ? 1 : 0, pointers, columns.size
+      )
+      Native.check_status!(status, 'type_layout.decode')
+      read_columns(columns, count)
+    end
+
+    # @rbs count: Integer
+    # @rbs return: [Array[[String, Symbol, FFI::MemoryPointer]], FFI::MemoryPointer]
+    def allocate_columns(count)
+      columns = fields.map do |field|
+        ffi_type = Process::ARRAY_ELEMENT_TYPES.fetch(field[:type]).last
+        [field[:name], ffi_type, FFI::MemoryPointer.new(ffi_type, [count, 1].max, false)]
+      end
+      pointers = FFI::MemoryPointer.new(:pointer, [columns.size, 1].max)
+      pointers.write_array_of_pointer(columns.map(&:last))
+      [columns, pointers]
+    end
+
+    # @rbs columns: Array[[String, Symbol, FFI::MemoryPointer]]
+    # @rbs count: Integer
+    # @rbs return: Hash[String, Array[Numeric]]
+    def read_columns(columns, count)
+      columns.to_h { |name, ffi_type, column| [name, column.public_send(:"read_array_of_#{ffi_type}", count)] }
+    end
+
+    # @rbs return: FFI::Pointer
+    def to_ptr
+      @ptr
+    end
+
+    # @rbs return: String
+    def inspect
+      "#<LLDB::TypeLayout byte_size=#{byte_size} fields=#{valid? ? fields.size : 0}>"
+    end
+  end
+end
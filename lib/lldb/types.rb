@@ -18,6 +18,78 @@ module LLDB
     INTERNAL_ERROR = 5 # : Integer
   end
 
+  module ElementType
+    INT8 = 1 # : Integer
+    UINT8 = 2 # : Integer
+    INT16 = 3 # : Integer
+    UINT16 = 4 # : Integer
+    INT32 = 5 # : Integer
+    UINT32 = 6 # : Integer
+    INT64 = 7 # : Integer
+    UINT64 = 8 # : Integer
+    FLOAT = 9 # : Integer
+    DOUBLE = 10 # : Integer
+    POINTER = 11 # : Integer
+  end
+
+  module WalkFlags
+    REVISITED = 1 # : Integer
+    TRUNCATED = 2 # : Integer
+    READ_FAILED = 4 # : Integer
+  end
+
+  module ValueSerializeFlags
+    VALUES = 1 # : Integer
+    SUMMARIES = 2 # : Integer
+    TYPE_NAMES = 4 # : Integer
+    LOCATIONS = 8 # : Integer
+  end
+
+  module ValueNodeFlags
+    ERROR = 1 # : Integer
+    TRUNCATED = 2 # : Integer
+    UNEXPANDED = 4 # : Integer
+  end
+
+  module BacktraceFlags
+    FUNCTIONS = 1 # : Integer
+    LINE_ENTRIES = 2 # : Integer
+  end
+
+  module BacktraceFrameFlags
+    INLINED = 1 # : Integer
+    TRUNCATED = 2 # : Integer
+  end
+
+  module ProfileFormat
+    FOLDED = 0 # : Integer
+    PPROF = 1 # : Integer
+  end
+
+  module SymbolScopeFlags
+    INLINED = 1 # : Integer
+  end
+
+  module ContainerKind
+    NONE = 0 # : Integer
+    VECTOR = 1 # : Integer
+    STRING = 2 # : Integer
+    UNORDERED_SET = 3 # : Integer
+    UNORDERED_MAP = 4 # : Integer
+  end
+
+  module ValueChangeFlags
+    NEW = 1 # : Integer
+    UNAVAILABLE = 2 # : Integer
+  end
+
+  module FrameVariablesFlags
+    ARGUMENTS = 1 # : Integer
+    LOCALS = 2 # : Integer
+    STATICS = 4 # : Integer
+    IN_SCOPE_ONLY = 8 # : Integer
+  end
+
   module State
     INVALID = 0 # : Integer
     UNLOADED = 1 # : Integer
@@ -252,4 +324,10 @@ module LLDB
     ALL_THREADS = 1 # : Integer
     ONLY_DURING_STEPPING = 2 # : Integer
   end
+
+  module Permissions
+    WRITABLE = 1 # : Integer
+    READABLE = 2 # : Integer
+    EXECUTABLE = 4 # : Integer
+  end
 end
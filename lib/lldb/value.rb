@@ -7,6 +7,20 @@ module LLDB
     prepend NativeLifecycle
     include Enumerable #[Value]
 
+    # Container kind symbols by native lldb_ruby_container_kind_t value.
+    CONTAINER_KINDS = {
+      ContainerKind::VECTOR => :vector,
+      ContainerKind::STRING => :string,
+      ContainerKind::UNORDERED_SET => :unordered_set,
+      ContainerKind::UNORDERED_MAP => :unordered_map
+    }.freeze # : Hash[Integer, Symbol]
+
+    # String#unpack directives for host-order container elements.
+    CONTAINER_DIRECTIVES = {
+      int8: 'c', uint8: 'C', int16: 's', uint16: 'S', int32: 'l', uint32: 'L',
+      int64: 'q', uint64: 'Q', float: 'f', double: 'd', pointer: 'Q'
+    }.freeze # : Hash[Symbol, String]
+
     # @rbs return: Frame | Value | Target
     attr_reader :parent
 
@@ -18,7 +32,8 @@ module LLDB
       initialize_native_object(
         ptr,
         release: ->(released) { FFIBindings.lldb_value_destroy(released) },
-        context: context
+        context: context,
+        scope: Scope.current
       )
     end
 
@@ -105,6 +120,47 @@ module LLDB
       children.each(&block)
     end
 
+    # Yield each child as a Hash shaped like a Value#to_tree node, plus
+    # :index, fetching `batch` children per native call. Unlike #children this
+    # never holds more than one batch, so it suits very large containers; use
+    # child_at_index(child[:index]) to get a Value for one of them.
+    #
+    # @rbs batch: Integer
+    # @rbs summaries: bool
+    # @rbs &block: (Hash[Symbol, untyped]) -> void
+    # @rbs return: Enumerator[Hash[Symbol, untyped], void] | void
+    def each_child(batch: 256, summaries: true, &block)
+      return enum_for(:each_child, batch: batch, summaries: summaries) { num_children } unless block_given?
+      raise InvalidObjectError, 'Value is not valid' unless valid?
+      raise ArgumentError, 'batch must be positive' unless batch.positive?
+
+      cursor = children_cursor(summaries: summaries)
+      begin
+        loop do
+          children = cursor.next_batch(batch)
+          break if children.empty?
+
+          children.each(&block)
+        end
+      ensure
+        cursor.close
+      end
+      self
+    end
+
+    # @rbs summaries: bool
+    # @rbs return: ValueChildrenCursor
+    def children_cursor(summaries: true)
+      raise InvalidObjectError, 'Value is not valid' unless valid?
+
+      flags = ValueSerializeFlags::VALUES | ValueSerializeFlags::TYPE_NAMES | ValueSerializeFlags::LOCATIONS
+      flags |= ValueSerializeFlags::SUMMARIES if summaries
+      cursor_ptr = FFIBindings.lldb_value_children_cursor_create(@ptr, flags)
+      raise LLDBError, 'Failed to create children cursor' if cursor_ptr.nil? || cursor_ptr.null?
+
+      ValueChildrenCursor.new(cursor_ptr, context: context)
+    end
+
     # @rbs return: Integer
     def value_as_signed
       return 0 unless valid?
@@ -322,6 +378,129 @@ module LLDB
       Value.new(value_ptr, parent: self, context: context)
     end
 
+    # The bytes LLDB holds for this value, in target byte order, without
+    # going through value formatting.
+    #
+    # @rbs return: String
+    def raw_bytes
+      raise InvalidObjectError, 'Value is not valid' unless valid?
+
+      error = Error.new
+      size = FFIBindings.lldb_value_get_data(@ptr, nil, 0, error.to_ptr)
+      error.raise_if_error!('value.raw_bytes')
+      return ''.b if size.zero?
+
+      buffer = FFI::MemoryPointer.new(:uint8, size, false)
+      written = FFIBindings.lldb_value_get_data(@ptr, buffer, size, error.to_ptr)
+      error.raise_if_error!('value.raw_bytes')
+      buffer.get_bytes(0, [written, size].min)
+    end
+
+    # Decode this value's bytes as consecutive elements of `element_type`
+    # (one of the types accepted by Process#read_array), natively and in the
+    # target byte order. A float[1024] read as :float gives 1024 Floats; a
+    # scalar gives a one-element Array.
+    #
+    # @rbs element_type: Symbol
+    # @rbs return: Array[Numeric]
+    def read_as(element_type)
+      raise InvalidObjectError, 'Value is not valid' unless valid?
+
+      native_type, ffi_type = Process::ARRAY_ELEMENT_TYPES.fetch(element_type) do
+        raise ArgumentError, "unknown element type: #{element_type.inspect}"
+      end
+      count = FFI::MemoryPointer.new(:uint64)
+      error = Error.new
+      status = FFIBindings.lldb_value_get_data_as(@ptr, native_type, nil, 0, count, error.to_ptr)
+      Native.check_status!(status, 'value.read_as', error)
+      return [] if count.read_uint64.zero?
+
+      buffer = FFI::MemoryPointer.new(ffi_type, count.read_uint64, false)
+      status = FFIBindings.lldb_value_get_data_as(@ptr, native_type, buffer, buffer.size, count, error.to_ptr)
+      Native.check_status!(status, 'value.read_as', error)
+      buffer.public_send(:"read_array_of_#{ffi_type}", count.read_uint64)
+    end
+
+    # Render this value and its descendants with one native call. Each node is
+    # a Hash with :name, :type_name, :value, :summary, :address, :byte_size,
+    # :num_children, :error, :error_message, :truncated, and :children.
+    # Children beyond `depth` levels are not expanded (:children is nil); at
+    # most `max_children` children are included per node (:truncated is true).
+    # Pass summaries: false to skip data formatters.
+    #
+    # @rbs depth: Integer
+    # @rbs max_children: Integer
+    # @rbs summaries: bool
+    # @rbs return: Hash[Symbol, untyped]
+    def to_tree(depth: 3, max_children: 1024, summaries: true)
+      raise InvalidObjectError, 'Value is not valid' unless valid?
+      raise ArgumentError, 'depth must be non-negative' if depth.negative?
+
+      flags = ValueSerializeFlags::VALUES | ValueSerializeFlags::TYPE_NAMES | ValueSerializeFlags::LOCATIONS
+      flags |= ValueSerializeFlags::SUMMARIES if summaries
+      bytes = NativeBuffer.read_bytes('value.to_tree') do |buffer, capacity, required|
+        FFIBindings.lldb_value_serialize(@ptr, depth, max_children, flags, buffer, capacity, required)
+      end
+      ValueTree.decode(bytes).first
+    end
+
+    # Describe the std::vector, std::basic_string, std::unordered_set or
+    # std::unordered_map behind this value when the native fast path
+    # recognizes its libstdc++ or libc++ layout. Returns a Hash with :kind,
+    # :count, :address (of the storage or first node), :element_type and
+    # :mapped_type (element type symbols as accepted by Process#read_array,
+    # or nil for elements read as raw bytes), and the :element_size and
+    # :mapped_size of each emitted element. Returns nil for other values.
+    #
+    # @rbs return: Hash[Symbol, untyped]?
+    def container_info
+      raise InvalidObjectError, 'Value is not valid' unless valid?
+
+      record = FFI::MemoryPointer.new(:uint64, 6)
+      Native.check_status!(FFIBindings.lldb_value_get_container_info(@ptr, record), 'value.container_info')
+      kind, element_type, mapped_type, _reserved, count, element_size, mapped_size, address =
+        record.get_bytes(0, record.size).unpack('L4Q4')
+      return nil if kind == ContainerKind::NONE
+
+      {
+        kind: CONTAINER_KINDS.fetch(kind),
+        count: count,
+        address: address,
+        element_type: TypeLayout::ELEMENT_TYPES[element_type],
+        mapped_type: TypeLayout::ELEMENT_TYPES[mapped_type],
+        element_size: element_size,
+        mapped_size: mapped_size
+      }
+    end
+
+    # Read the elements of a container recognized by #container_info
+    # straight from its storage, without synthetic children or a Value per
+    # element. Strings come back as a String; vectors and sets as an Array of
+    # numbers, or of raw byte Strings for non-scalar elements; maps as an
+    # Array of [key, value] pairs decoded the same way. With packed: true the
+    # host-order element bytes are returned as one binary String instead,
+    # for String#unpack or TypeLayout#decode. Returns nil when the value has
+    # no fast path; use #each_child or #non_synthetic_value then.
+    #
+    # @rbs start: Integer
+    # @rbs count: Integer?
+    # @rbs packed: bool
+    # @rbs return: (String | Array[untyped])?
+    def container_elements(start: 0, count: nil, packed: false)
+      raise ArgumentError, 'start must be non-negative' if start.negative?
+      raise ArgumentError, 'count must be non-negative' if count&.negative?
+
+      info = container_info
+      return nil unless info
+
+      count ||= [info[:count] - start, 0].max
+      error = Error.new
+      bytes = NativeBuffer.read_bytes('value.container_elements', error) do |buffer, capacity, required|
+        FFIBindings.lldb_value_read_container(@ptr, start, count, buffer, capacity, required, error.to_ptr)
+      end
+      packed ? bytes : decode_container(info, bytes)
+    end
+
     # @rbs return: FFI::Pointer
     def to_ptr
       @ptr
@@ -329,6 +508,38 @@ module LLDB
 
     private
 
+    # @rbs info: Hash[Symbol, untyped]
+    # @rbs bytes: String
+    # @rbs return: String | Array[untyped]
+    def decode_container(info, bytes)
+      return decode_container_string(bytes, info[:element_size]) if info[:kind] == :string
+
+      element = CONTAINER_DIRECTIVES.fetch(info[:element_type], "a#{info[:element_size]}")
+      if info[:kind] == :unordered_map
+        count = bytes.bytesize / (info[:element_size] + info[:mapped_size])
+        mapped = CONTAINER_DIRECTIVES.fetch(info[:mapped_type], "a#{info[:mapped_size]}")
+        return bytes.unpack("#{element}#{mapped}" * count).each_slice(2).to_a
+      end
+      return bytes.unpack("#{element}*") if info[:element_type]
+
+      Array.new(bytes.bytesize / info[:element_size]) do |index|
+        bytes.byteslice(index * info[:element_size], info[:element_size])
+      end
+    end
+
+    # @rbs bytes: String
+    # @rbs char_size: Integer
+    # @rbs return: String
+    def decode_container_string(bytes, char_size)
+      little = [1].pack('S').getbyte(0) == 1
+      encoding = case char_size
+                 when 2 then little ? Encoding::UTF_16LE : Encoding::UTF_16BE
+                 when 4 then little ? Encoding::UTF_32LE : Encoding::UTF_32BE
+                 else Encoding::UTF_8
+                 end
+      bytes.force_encoding(encoding)
+    end
+
     # @rbs return: Target
     def get_target_from_parent
       current = @parent
@@ -0,0 +1,60 @@
+# frozen_string_literal: true
+
+# rbs_inline: enabled
+
+module LLDB
+  # Reads the children of a Value in batches, each decoded from one native
+  # call into hashes shaped like Value#to_tree nodes with an added :index.
+  # Only the current batch is held in memory, so containers with millions of
+  # elements can be walked without creating a Value per child.
+  class ValueChildrenCursor
+    prepend NativeLifecycle
+
+    # @rbs ptr: FFI::Pointer
+    # @rbs context: Context?
+    # @rbs return: void
+    def initialize(ptr, context: nil)
+      initialize_native_object(
+        ptr,
+        release: ->(released) { FFIBindings.lldb_value_children_cursor_destroy(released) },
+        context: context
+      )
+    end
+
+    # @rbs return: bool
+    def valid?
+      !@ptr.null?
+    end
+
+    # @rbs return: Integer
+    def num_children
+      return 0 unless valid?
+
+      FFIBindings.lldb_value_children_cursor_get_num_children(@ptr)
+    end
+
+    # Index of the next child to be returned.
+    #
+    # @rbs return: Integer
+    def position
+      return 0 unless valid?
+
+      FFIBindings.lldb_value_children_cursor_get_position(@ptr)
+    end
+
+    # Return up to `count` further children; empty once the cursor is done.
+    #
+    # @rbs count: Integer
+    # @rbs return: Array[Hash[Symbol, untyped]]
+    def next_batch(count)
+      raise InvalidObjectError, 'ValueChildrenCursor is not valid' unless valid?
+      raise ArgumentError, 'count must be positive' unless count.positive?
+
+      first = position
+      bytes = NativeBuffer.read_bytes('value_children_cursor.next_batch') do |buffer, capacity, required|
+        FFIBindings.lldb_value_children_cursor_next_batch(@ptr, count, buffer, capacity, required)
+      end
+      ValueTree.decode(bytes).each_with_index { |child, offset| child[:index] = first + offset }
+    end
+  end
+end
@@ -0,0 +1,112 @@
+# frozen_string_literal: true
+
+# rbs_inline: enabled
+
+module LLDB
+  # Candidate addresses of a value hunt started by Process#search_value. The
+  # initial scan keeps every aligned element that held the value; #narrow
+  # re-reads only the pages that still hold candidates at a later stop and
+  # keeps the ones that satisfy a predicate.
+  class ValueSearch
+    prepend NativeLifecycle
+
+    # Predicates compared with an operand, then with the previously seen value.
+    PREDICATES = {
+      equal: 0,
+      not_equal: 1,
+      greater: 2,
+      less: 3,
+      changed: 4,
+      unchanged: 5,
+      increased: 6,
+      decreased: 7
+    }.freeze # : Hash[Symbol, Integer]
+    OPERAND_PREDICATES = %i[equal not_equal greater less].freeze # : Array[Symbol]
+
+    # @rbs return: Symbol
+    attr_reader :element_type
+
+    # @rbs ptr: FFI::Pointer
+    # @rbs element_type: Symbol
+    # @rbs ffi_type: Symbol
+    # @rbs context: Context?
+    # @rbs return: void
+    def initialize(ptr, element_type, ffi_type, context: nil)
+      @element_type = element_type
+      @ffi_type = ffi_type
+      initialize_native_object(
+        ptr,
+        release: ->(released) { FFIBindings.lldb_value_search_destroy(released) },
+        context: context
+      )
+    end
+
+    # @rbs return: bool
+    def valid?
+      !@ptr.null?
+    end
+
+    # Number of remaining candidates.
+    #
+    # @rbs return: Integer
+    def count
+      return 0 unless valid?
+
+      FFIBindings.lldb_value_search_get_count(@ptr)
+    end
+
+    # Keep the candidates whose current value satisfies `predicate`. :equal,
+    # :not_equal, :greater, and :less compare with `operand`; :changed,
+    # :unchanged, :increased, and :decreased compare with the value seen at the
+    # previous scan. Returns the number of remaining candidates.
+    #
+    # @rbs predicate: Symbol
+    # @rbs operand: Numeric?
+    # @rbs return: Integer
+    def narrow(predicate, operand = nil)
+      raise InvalidObjectError, 'ValueSearch is not valid' unless valid?
+
+      native_predicate = PREDICATES.fetch(predicate) { raise ArgumentError, "unknown predicate: #{predicate.inspect}" }
+      needs_operand = OPERAND_PREDICATES.include?(predicate)
+      raise ArgumentError, "#{predicate} requires an operand" if needs_operand && operand.nil?
+
+      operand_buffer = needs_operand ? encode(operand) : nil
+      remaining = FFI::MemoryPointer.new(:uint64)
+      error = Error.new
+      status = FFIBindings.lldb_value_search_narrow(@ptr, native_predicate, operand_buffer, remaining, error.to_ptr)
+      Native.check_status!(status, 'value_search.narrow', error)
+
+      remaining.read_uint64
+    end
+
+    # The first `limit` candidates in address order, with the value each held
+    # at the last scan.
+    #
+    # @rbs limit: Integer
+    # @rbs return: Array[{ address: Integer, value: Numeric }]
+    def results(limit: 1024)
+      raise InvalidObjectError, 'ValueSearch is not valid' unless valid?
+      raise ArgumentError, 'limit must be non-negative' if limit.negative?
+
+      capacity = [limit, count].min
+      addresses = FFI::MemoryPointer.new(:uint64, [capacity, 1].max)
+      values = FFI::MemoryPointer.new(@ffi_type, [capacity, 1].max)
+      total = FFI::MemoryPointer.new(:uint64)
+      status = FFIBindings.lldb_value_search_get_results(@ptr, addresses, values, capacity, total)
+      Native.check_status!(status, 'value_search.results')
+
+      addresses.read_array_of_uint64(capacity).zip(values.public_send(:"read_array_of_#{@ffi_type}", capacity))
+               .map { |address, value| { address: address, value: value } }
+    end
+
+    private
+
+    # @rbs value: Numeric
+    # @rbs return: FFI::MemoryPointer
+    def encode(value)
+      buffer = FFI::MemoryPointer.new(@ffi_type)
+      buffer.public_send(:"write_#{@ffi_type}", value)
+      buffer
+    end
+  end
+end
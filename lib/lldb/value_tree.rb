@@ -0,0 +1,62 @@
+# frozen_string_literal: true
+
+# rbs_inline: enabled
+
+module LLDB
+  # Decodes the value tree buffers written by lldb_value_serialize and
+  # lldb_frame_snapshot_variables into nested hashes.
+  module ValueTree
+    # Size of lldb_ruby_value_tree_header_t and layout of lldb_ruby_value_node_t.
+    HEADER_SIZE = 24 # : Integer
+    NODE_SIZE = 48 # : Integer
+    NODE_FORMAT = 'L6Q2L2' # : String
+    NODE_FIELDS = 10 # : Integer
+
+    # @rbs bytes: String
+    # @rbs return: Array[Hash[Symbol, untyped]]
+    def self.decode(bytes)
+      node_count, node_size, strings_offset, strings_size = bytes.unpack('L2Q2')
+      strings = {}
+      offset = 0
+      bytes.byteslice(strings_offset, strings_size).split("\0", -1)[0...-1].each do |string|
+        strings[offset] = string.freeze
+        offset += string.bytesize + 1
+      end
+
+      # Newer libraries may append fields to each node; skip anything past the known layout.
+      node_format = "#{NODE_FORMAT}x#{node_size - NODE_SIZE}"
+      fields = bytes.byteslice(HEADER_SIZE, node_count * node_size).unpack(node_format * node_count)
+      records = fields.each_slice(NODE_FIELDS)
+      roots = []
+      loop do
+        records.peek
+        roots << build_node(records, strings)
+      end
+      roots
+    end
+
+    # @rbs records: Enumerator[Array[Integer], void]
+    # @rbs strings: Hash[Integer, String]
+    # @rbs return: Hash[Symbol, untyped]
+    def self.build_node(records, strings)
+      name, type_name, value, summary, num_children, child_count, address, byte_size, flags, error = records.next
+      {
+        name: strings[name],
+        type_name: strings[type_name],
+        value: strings[value],
+        summary: strings[summary],
+        address: address == INVALID_ADDRESS ? nil : address,
+        byte_size: byte_size,
+        num_children: num_children,
+        error: flags.anybits?(ValueNodeFlags::ERROR),
+        error_message: strings[error],
+        truncated: flags.anybits?(ValueNodeFlags::TRUNCATED),
+        children: if flags.anybits?(ValueNodeFlags::UNEXPANDED)
+                    nil
+                  else
+                    Array.new(child_count) { build_node(records, strings) }
+                  end
+      }
+    end
+  end
+end
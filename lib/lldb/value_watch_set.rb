@@ -0,0 +1,99 @@
+# frozen_string_literal: true
+
+# rbs_inline: enabled
+
+module LLDB
+  # Tracks the raw bytes of variable paths across stops. Each #update
+  # resolves every path in a frame with one native call and returns only the
+  # entries whose bytes changed since the previous update.
+  class ValueWatchSet
+    prepend NativeLifecycle
+
+    # Layout of lldb_ruby_value_change_t.
+    CHANGE_SIZE = 40 # : Integer
+    CHANGE_FORMAT = 'L2Q4' # : String
+
+    # @rbs return: Array[String]
+    attr_reader :paths
+
+    # @rbs paths: Array[String]
+    # @rbs context: Context?
+    # @rbs return: void
+    def initialize(paths = [], context: nil)
+      ptr = FFIBindings.lldb_value_watch_set_create
+      raise LLDBError, 'Failed to create value watch set' if ptr.nil? || ptr.null?
+
+      initialize_native_object(
+        ptr,
+        release: ->(released) { FFIBindings.lldb_value_watch_set_destroy(released) },
+        context: context
+      )
+      @paths = []
+      paths.each { |path| add(path) }
+    end
+
+    # @rbs return: bool
+    def valid?
+      !@ptr.null?
+    end
+
+    # Watch `path`, a variable path such as "node->next" or "items[3]".
+    # Returns its index in the set.
+    #
+    # @rbs path: String
+    # @rbs return: Integer
+    def add(path)
+      raise InvalidObjectError, 'ValueWatchSet is not valid' unless valid?
+
+      index = FFIBindings.lldb_value_watch_set_add(@ptr, path.to_s)
+      Native.check_status!(NativeStatus::INTERNAL_ERROR, 'value_watch_set.add') if index == 0xFFFF_FFFF
+      @paths << path.to_s.dup.freeze
+      index
+    end
+
+    # @rbs return: Integer
+    def size
+      return 0 unless valid?
+
+      FFIBindings.lldb_value_watch_set_get_count(@ptr)
+    end
+
+    # Resolve every path in `frame` and return the entries whose bytes
+    # changed. :old is nil the first time a path resolves and :new is nil
+    # once it stops resolving.
+    #
+    # @rbs frame: Frame
+    # @rbs return: Array[Hash[Symbol, untyped]]
+    def update(frame)
+      raise InvalidObjectError, 'ValueWatchSet is not valid' unless valid?
+      raise InvalidObjectError, 'Frame is not valid' unless frame.valid?
+
+      capacity = [size, 1].max
+      changes = FFI::MemoryPointer.new(:uint8, capacity * CHANGE_SIZE, false)
+      change_count = FFI::MemoryPointer.new(:size_t)
+      bytes = NativeBuffer.read_bytes('value_watch_set.update') do |buffer, buffer_size, required|
+        FFIBindings.lldb_value_watch_set_update(@ptr, frame, changes, capacity, change_count, buffer, buffer_size,
+                                                required)
+      end
+      count = change_count.read(:size_t)
+      changes.get_bytes(0, count * CHANGE_SIZE).unpack(CHANGE_FORMAT * count).each_slice(6).map do |fields|
+        decode_change(fields, bytes)
+      end
+    end
+
+    private
+
+    # @rbs fields: Array[Integer]
+    # @rbs bytes: String
+    # @rbs return: Hash[Symbol, untyped]
+    def decode_change(fields, bytes)
+      index, flags, old_offset, old_size, new_offset, new_size = fields
+      {
+        index: index,
+        path: @paths[index],
+        old: flags.anybits?(ValueChangeFlags::NEW) ? nil : bytes.byteslice(old_offset, old_size),
+        new: flags.anybits?(ValueChangeFlags::UNAVAILABLE) ? nil : bytes.byteslice(new_offset, new_size)
+      }
+    end
+  end
+end
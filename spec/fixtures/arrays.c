@@ -0,0 +1,16 @@
+#include <stdint.h>
+
+struct lldb_test_sample {
+    int32_t id;
+    int32_t flags;
+    double weight;
+};
+
+int32_t lldb_test_ints[8] = {1, -2, 3, -4, 5, -6, 7, -8};
+double lldb_test_doubles[4] = {0.5, 1.5, 2.5, 3.5};
+struct lldb_test_sample lldb_test_samples[3] = {{10, 0, 1.0}, {20, 1, 2.0}, {30, 2, 3.0}};
+const char* lldb_test_names[3] = {"alpha", "", "gamma ray"};
+
+int main(void) {
+    return lldb_test_ints[0] + (int)lldb_test_doubles[0] + lldb_test_samples[0].id + lldb_test_names[0][0];
+}
@@ -0,0 +1,32 @@
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+struct Sample {
+    int id;
+    double weight;
+};
+
+static const int kMillion = 1000000;
+
+void lldb_test_containers_ready() {}
+
+int main() {
+    std::vector<int> ints(kMillion);
+    for (int i = 0; i < kMillion; ++i) ints[i] = i * 3;
+
+    std::unordered_map<int, double> halves;
+    halves.reserve(kMillion);
+    for (int i = 0; i < kMillion; ++i) halves[i] = i * 0.5;
+
+    std::vector<Sample> samples = {{1, 0.25}, {2, 0.5}, {3, 0.75}};
+    std::unordered_set<long> ids = {7, 11, 13};
+    std::string short_text = "lldb";
+    std::string long_text(4096, 'x');
+    std::vector<bool> flags(8, true);
+
+    lldb_test_containers_ready();
+    return static_cast<int>(ints.size() + halves.size() + samples.size() + ids.size() + short_text.size() +
+                            long_text.size() + flags.size()) & 1;
+}
@@ -0,0 +1,15 @@
+#include <stdint.h>
+
+volatile int32_t lldb_test_counter = 1234567;
+volatile double lldb_test_level = 0.75;
+
+void lldb_test_tick(void) {}
+
+int main(void) {
+    for (int round = 0; round < 3; ++round) {
+        lldb_test_counter += 1;
+        lldb_test_level *= 2;
+        lldb_test_tick();
+    }
+    return 0;
+}
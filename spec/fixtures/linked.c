@@ -0,0 +1,42 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+struct lldb_test_node {
+    struct lldb_test_node* next;
+    int64_t value;
+};
+
+struct lldb_test_tree {
+    struct lldb_test_tree* left;
+    struct lldb_test_tree* right;
+    int64_t key;
+};
+
+struct lldb_test_node* lldb_test_list;
+struct lldb_test_node lldb_test_ring[3];
+struct lldb_test_tree lldb_test_tree_nodes[7];
+
+void lldb_test_ready(void) {}
+
+int main(void) {
+    for (int64_t value = 999; value >= 0; --value) {
+        struct lldb_test_node* node = malloc(sizeof(*node));
+        node->value = value;
+        node->next = lldb_test_list;
+        lldb_test_list = node;
+    }
+
+    for (int index = 0; index < 3; ++index) {
+        lldb_test_ring[index].value = index;
+        lldb_test_ring[index].next = &lldb_test_ring[(index + 1) % 3];
+    }
+
+    for (int index = 0; index < 7; ++index) {
+        lldb_test_tree_nodes[index].key = index;
+        lldb_test_tree_nodes[index].left = 2 * index + 1 < 7 ? &lldb_test_tree_nodes[2 * index + 1] : NULL;
+        lldb_test_tree_nodes[index].right = 2 * index + 2 < 7 ? &lldb_test_tree_nodes[2 * index + 2] : NULL;
+    }
+
+    lldb_test_ready();
+    return 0;
+}
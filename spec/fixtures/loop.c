@@ -1,6 +1,30 @@
 #include <stdio.h>
+#include <stdlib.h>
+
+static volatile unsigned long lldb_test_sink;
+
+unsigned long lldb_test_spin_inner(unsigned long seed) {
+    for (int i = 0; i < 1000; i++) {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+    }
+    return seed;
+}
+
+void lldb_test_spin(long rounds) {
+    unsigned long seed = 1;
+    for (long round = 0; round < rounds; round++) {
+        seed = lldb_test_spin_inner(seed);
+    }
+    lldb_test_sink = seed;
+}
 
 int main(int argc, char** argv) {
+    /* With a round count, burn CPU in a small call tree for the profiler. */
+    if (argc > 1) {
+        lldb_test_spin(atol(argv[1]));
+        return 0;
+    }
+
     int sum = 0;
     for (int i = 0; i < 10; i++) {
         sum += i;
@@ -6,11 +6,19 @@ struct lldb_test_struct {
   double second;
 };
 
+struct lldb_test_padded {
+  unsigned int low : 4;
+  unsigned int : 0;
+  unsigned int : 3;
+  unsigned int high : 5;
+};
+
 int lldb_test_type(struct lldb_test_struct value) {
   return value.first;
 }
 
 int main(void) {
   struct lldb_test_struct value = {42, 5, 3.5};
-  return lldb_test_type(value);
+  struct lldb_test_padded padded = {9, 17};
+  return lldb_test_type(value) + (int)padded.low;
 }
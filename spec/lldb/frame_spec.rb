@@ -133,6 +133,42 @@ RSpec.describe LLDB::Frame do
     end
   end
 
+  describe '#variables_snapshot' do
+    it 'matches get_variables with one record per variable' do
+      snapshot = frame.variables_snapshot
+      variables = frame.get_variables.to_a
+
+      expect(snapshot.map { |variable| variable[:name] }).to eq(variables.map(&:name))
+      expect(snapshot.map { |variable| variable[:value] }).to eq(variables.map(&:value))
+      expect(snapshot.map { |variable| variable[:type_name] }).to eq(variables.map(&:type_name))
+      expect(snapshot.map { |variable| variable[:children] }).to all(eq([]))
+    end
+
+    it 'filters arguments and locals' do
+      arguments = frame.variables_snapshot(locals: false, statics: false).map { |variable| variable[:name] }
+      locals = frame.variables_snapshot(arguments: false, statics: false).map { |variable| variable[:name] }
+
+      expect(arguments).to contain_exactly('a', 'b')
+      expect(locals).to include('result')
+    end
+  end
+
+  describe '#resolve_paths' do
+    it 'resolves every path in order with one record each' do
+      records = frame.resolve_paths(%w[a b lldb_test_missing])
+
+      expect(records.map { |record| record[:path] }).to eq(%w[a b lldb_test_missing])
+      expect(records[0]).to include(name: 'a', value: frame.find_variable('a').value, error: false, error_message: nil)
+      expect(records[1][:type_name]).to eq(frame.get_value_for_variable_path('b').type_name)
+      expect(records[2][:error]).to be true
+      expect(records[2][:error_message]).to be_a(String)
+    end
+
+    it 'returns an empty list for no paths' do
+      expect(frame.resolve_paths([])).to eq([])
+    end
+  end
+
   describe '#get_registers' do
     it 'returns a ValueList of register sets' do
       registers = frame.get_registers
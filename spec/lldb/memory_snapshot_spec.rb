@@ -0,0 +1,43 @@
+# frozen_string_literal: true
+
+require 'tmpdir'
+
+RSpec.describe LLDB::MemorySnapshot do
+  let(:debugger) { LLDB::Debugger.create }
+  let(:executable) { compile_fixture('simple') }
+  let(:target) { debugger.create_target(executable) }
+
+  before do
+    debugger.async = false
+    target.breakpoint_create_by_name('main')
+  end
+
+  it 'serves reads from a snapshot after the process is gone' do
+    Dir.mktmpdir('lldb-ruby-snapshot') do |directory|
+      path = File.join(directory, 'memory.snap')
+      process = target.launch
+      pc = process.selected_thread.selected_frame.pc
+      expected = process.read_memory(pc, 32)
+
+      result = process.snapshot_memory(path)
+      process.kill
+
+      snapshot = described_class.open(path)
+      expect(result[:regions]).to be > 0
+      expect(snapshot.regions.length).to eq(result[:regions])
+      expect(snapshot.regions.sum(&:size)).to eq(result[:bytes])
+      expect(snapshot.read_memory(pc, 32)).to eq(expected)
+      expect { snapshot.read_memory(0, 8) }.to raise_error(LLDB::OperationError)
+      snapshot.close
+    end
+  end
+
+  it 'rejects files that are not snapshots' do
+    Dir.mktmpdir('lldb-ruby-snapshot') do |directory|
+      path = File.join(directory, 'bogus.snap')
+      File.binwrite(path, 'not a snapshot' * 8)
+
+      expect { described_class.open(path) }.to raise_error(LLDB::OperationError)
+    end
+  end
+end
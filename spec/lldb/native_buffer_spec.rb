@@ -27,4 +27,27 @@ RSpec.describe LLDB::NativeBuffer do
       end.to raise_error(ArgumentError)
     end
   end
+
+  describe '.read_bytes' do
+    it 'retries with the required size when the first buffer is too small' do
+      value = 'y' * 70_000
+      capacities = []
+
+      result = described_class.read_bytes('spec.read_bytes') do |buffer, capacity, required|
+        capacities << capacity
+        required.write_uint64(value.bytesize)
+        buffer.put_bytes(0, value) if value.bytesize <= capacity
+        LLDB::NativeStatus::OK
+      end
+
+      expect(result).to eq(value)
+      expect(capacities).to eq([65_536, 70_000])
+    end
+
+    it 'raises when the writer reports a failure' do
+      expect do
+        described_class.read_bytes('spec.read_bytes') { LLDB::NativeStatus::INVALID_ARGUMENT }
+      end.to raise_error(LLDB::OperationError)
+    end
+  end
 end
@@ -25,6 +25,14 @@ RSpec.describe LLDB::NativeHandle do
     expect(releases).to eq([pointer])
   end
 
+  it 'detaches a handle without a release callback' do
+    handle = described_class.new(pointer, release: nil)
+
+    expect(handle.close).to be true
+    expect(handle.closed?).to be true
+    expect(handle.to_ptr).to be_null
+  end
+
   it 'releases an unclosed handle during finalization' do
     releases = []
     state = [[pointer, ->(released) { releases << released }]]
@@ -114,6 +114,37 @@ RSpec.describe LLDB::Process do
     end
   end
 
+  describe '#capture_backtraces' do
+    before do
+      debugger.async = false
+      target.breakpoint_create_by_name('lldb_test_add')
+    end
+
+    it 'captures every thread with symbolicated frames' do
+      process = target.launch
+      thread = process.selected_thread
+      backtraces = process.capture_backtraces
+      frames = backtraces.fetch(thread.id)
+
+      expect(backtraces.keys).to eq(process.threads.map(&:id))
+      expect(frames.map { |frame| frame[:index] }).to eq((0...frames.size).to_a)
+      expect(frames.first).to include(pc: thread.frame_at_index(0).pc, function: 'lldb_test_add')
+      expect(frames.first[:file]).to end_with('simple.c')
+      expect(frames[1][:function]).to eq('main')
+      process.kill
+    end
+
+    it 'limits the depth and skips symbolication on request' do
+      process = target.launch
+      frames = process.capture_backtraces(max_depth: 1, functions: false, line_entries: false)
+                      .fetch(process.selected_thread.id)
+
+      expect(frames.size).to eq(1)
+      expect(frames.first).to include(function: nil, file: nil, line: nil, truncated: true)
+      process.kill
+    end
+  end
+
   describe '#unique_id' do
     before do
       debugger.async = false
@@ -127,6 +158,386 @@ RSpec.describe LLDB::Process do
     end
   end
 
+  describe '#read_memory_batch' do
+    before do
+      debugger.async = false
+      target.breakpoint_create_by_name('main')
+    end
+
+    it 'matches individual reads for adjacent and overlapping ranges' do
+      process = target.launch
+      pc = process.selected_thread.selected_frame.pc
+      ranges = [[pc + 8, 8], [pc, 8], [pc + 4, 8]]
+
+      results = process.read_memory_batch(ranges)
+
+      expect(results).to eq(ranges.map { |address, size| process.read_memory(address, size) })
+      expect(results).to all(be_frozen)
+      expect(process.read_memory_batch([[pc, 0]])).to eq([''])
+      process.kill
+    end
+
+    it 'returns nil for unreadable ranges' do
+      process = target.launch
+      pc = process.selected_thread.selected_frame.pc
+
+      results = process.read_memory_batch([[0, 16], [pc, 4]])
+
+      expect(results.first).to be_nil
+      expect(results.last.bytesize).to eq(4)
+      process.kill
+    end
+  end
+
+  describe '#write_memory_batch' do
+    let(:executable) { compile_fixture('arrays') }
+
+    before do
+      debugger.async = false
+      target.breakpoint_create_by_name('main')
+    end
+
+    it 'applies every write and reports the first failure' do
+      process = target.launch
+      ints = process.selected_thread.selected_frame.evaluate_expression('&lldb_test_ints').value_as_unsigned
+
+      result = process.write_memory_batch([[ints, [42].pack('l<')], [0, 'x'], [ints + 8, [7].pack('l<')], [ints, '']])
+
+      expect(result[:written]).to eq([4, 0, 4, 0])
+      expect(result[:failed_index]).to eq(1)
+      expect(result[:error]).to be_fail
+      expect(process.read_array(ints, :int32, 3)).to eq([42, -2, 7])
+      expect(process.write_memory_batch([[ints, 'abcd']])).to eq(written: [4], failed_index: nil, error: nil)
+      process.kill
+    end
+  end
+
+  describe 'memory cache' do
+    before do
+      debugger.async = false
+      target.breakpoint_create_by_name('main')
+    end
+
+    it 'serves repeated reads during one stop from cached pages' do
+      process = target.launch
+      pc = process.selected_thread.selected_frame.pc
+      process.enable_memory_cache(page_size: 4096, max_pages: 16)
+
+      first = process.read_memory(pc, 16)
+      second = process.read_memory(pc, 16)
+      stats = process.memory_cache_stats
+
+      expect(second).to eq(first)
+      expect(stats[:misses]).to be >= 1
+      expect(stats[:hits]).to be >= 1
+      expect(stats[:pages]).to be >= 1
+
+      process.disable_memory_cache
+      expect(process.memory_cache_stats).to eq(hits: 0, misses: 0, pages: 0)
+      process.kill
+    end
+
+    it 'serves reads from pages loaded by a background prefetch' do
+      target.breakpoint_create_by_name('lldb_test_add')
+      process = target.launch
+      sp = process.selected_thread.selected_frame.sp
+
+      prefetch = process.prefetch([[sp, 64], [sp + 32, 64]])
+      expect(prefetch.wait(10)).to be(true)
+      expect(prefetch.page_count).to be >= 1
+      expect(IO.select([prefetch.to_io], nil, nil, 0)).not_to be_nil if prefetch.to_io
+      misses = process.memory_cache_stats[:misses]
+
+      process.read_memory(sp, 64)
+      expect(process.memory_cache_stats).to include(misses: misses, hits: be >= 1)
+
+      running = process.prefetch([[sp - 65_536, 65_536]])
+      process.continue
+      expect(running.wait(10)).to be(true)
+      process.kill
+    end
+
+    it 'drops cached pages covering a write_memory' do
+      target.breakpoint_create_by_name('lldb_test_add')
+      process = target.launch
+      process.continue
+      address = process.selected_thread.selected_frame.find_variable('a').load_address
+      process.enable_memory_cache(page_size: 4096, max_pages: 16)
+
+      process.read_memory(address, 4)
+      misses = process.memory_cache_stats[:misses]
+      process.write_memory(address, [1234].pack('l<'))
+
+      expect(process.read_memory(address, 4)).to eq([1234].pack('l<'))
+      expect(process.memory_cache_stats[:misses]).to be > misses
+      process.kill
+    end
+
+    it 'does not let an in-flight prefetch restore bytes from before a write' do
+      target.breakpoint_create_by_name('lldb_test_add')
+      process = target.launch
+      process.continue
+      address = process.selected_thread.selected_frame.find_variable('a').load_address
+
+      prefetch = process.prefetch([[address - 65_536, 131_072]])
+      process.write_memory(address, [4321].pack('l<'))
+      expect(prefetch.wait(10)).to be(true)
+
+      expect(process.read_memory(address, 4)).to eq([4321].pack('l<'))
+      process.kill
+    end
+
+    it 'drops cached pages covering a value set from a string' do
+      target.breakpoint_create_by_name('lldb_test_add')
+      process = target.launch
+      process.continue
+      value = process.selected_thread.selected_frame.find_variable('a')
+      process.enable_memory_cache(page_size: 4096, max_pages: 16)
+
+      process.read_memory(value.load_address, 4)
+      expect(value.set_value_from_cstring('42')).to be(true)
+
+      expect(process.read_memory(value.load_address, 4)).to eq([42].pack('l<'))
+      process.kill
+    end
+
+    it 'drops cached pages when the process stops again' do
+      target.breakpoint_create_by_name('lldb_test_add')
+      process = target.launch
+      sp = process.selected_thread.selected_frame.sp
+      process.enable_memory_cache(page_size: 4096, max_pages: 16)
+
+      process.read_memory(sp, 16)
+      process.read_memory(sp, 16)
+      stats = process.memory_cache_stats
+      process.continue
+
+      expect(process).to be_stopped
+      process.read_memory(sp, 16)
+      expect(process.memory_cache_stats).to include(hits: stats[:hits], misses: be > stats[:misses])
+      process.kill
+    end
+
+    it 'drops the cache of a process that exits on its own' do
+      process = target.launch
+      process.enable_memory_cache(page_size: 4096, max_pages: 16)
+      process.read_memory(process.selected_thread.selected_frame.pc, 16)
+      process.continue
+
+      expect(process).to be_exited
+      expect(process.memory_cache_stats).to eq(hits: 0, misses: 0, pages: 0)
+    end
+
+    it 'rejects page sizes that are not powers of two' do
+      process = target.launch
+
+      expect { process.enable_memory_cache(page_size: 1000) }.to raise_error(LLDB::OperationError)
+      process.kill
+    end
+  end
+
+  describe '#memory_regions' do
+    before do
+      debugger.async = false
+      target.breakpoint_create_by_name('main')
+    end
+
+    it 'returns the address space as sorted region snapshots' do
+      process = target.launch
+      pc = process.selected_thread.selected_frame.pc
+
+      regions = process.memory_regions
+      code = regions.find { |region| region.include?(pc) }
+
+      expect(regions).to all(be_a(LLDB::MemoryRegion))
+      expect(regions.map(&:base_address)).to eq(regions.map(&:base_address).sort)
+      expect(code).to be_readable
+      expect(code).to be_executable
+      expect(code.base_address).to eq(process.get_memory_region_info(pc).base_address)
+      process.kill
+    end
+  end
+
+  describe '#read_array' do
+    let(:executable) { compile_fixture('arrays') }
+
+    before do
+      debugger.async = false
+      target.breakpoint_create_by_name('main')
+    end
+
+    def address_of(process, expression)
+      process.selected_thread.selected_frame.evaluate_expression("&#{expression}").value_as_unsigned
+    end
+
+    it 'decodes packed and strided elements' do
+      process = target.launch
+      samples = address_of(process, 'lldb_test_samples')
+
+      expect(process.read_array(address_of(process, 'lldb_test_ints'), :int32, 8)).to eq([1, -2, 3, -4, 5, -6, 7, -8])
+      expect(process.read_array(address_of(process, 'lldb_test_doubles'), :double, 4)).to eq([0.5, 1.5, 2.5, 3.5])
+      expect(process.read_array(samples, :int32, 3, stride: 16)).to eq([10, 20, 30])
+      expect(process.read_array(samples + 8, :double, 3, stride: 16)).to eq([1.0, 2.0, 3.0])
+      process.kill
+    end
+
+    it 'fills a caller-provided buffer' do
+      process = target.launch
+      buffer = FFI::MemoryPointer.new(:int32, 4)
+
+      count = process.read_array(address_of(process, 'lldb_test_ints'), :int32, 4, into: buffer)
+
+      expect(count).to eq(4)
+      expect(buffer.read_array_of_int32(4)).to eq([1, -2, 3, -4])
+      expect { process.read_array(0, :int128, 1) }.to raise_error(ArgumentError)
+      process.kill
+    end
+  end
+
+  describe '#read_cstrings' do
+    let(:executable) { compile_fixture('arrays') }
+
+    before do
+      debugger.async = false
+      target.breakpoint_create_by_name('main')
+    end
+
+    it 'reads a table of strings and marks unreadable pointers' do
+      process = target.launch
+      table = process.selected_thread.selected_frame.evaluate_expression('&lldb_test_names').value_as_unsigned
+      pointers = process.read_array(table, :pointer, 3)
+
+      expect(process.read_cstrings(pointers + [0])).to eq(['alpha', '', 'gamma ray', nil])
+      expect(process.read_cstrings([pointers.last], max_size: 5)).to eq(['gamma'])
+      singles = pointers.map { |address| process.read_cstring_from_memory(address) }
+      expect(process.read_cstrings(pointers)).to eq(singles)
+      process.kill
+    end
+  end
+
+  describe '#walk_links' do
+    let(:executable) { compile_fixture('linked') }
+
+    before do
+      debugger.async = false
+      target.breakpoint_create_by_name('lldb_test_ready')
+    end
+
+    def evaluate(process, expression)
+      process.selected_thread.selected_frame.evaluate_expression(expression).value_as_unsigned
+    end
+
+    it 'walks a heap list and returns node payloads' do
+      process = target.launch
+
+      walk = process.walk_links(evaluate(process, 'lldb_test_list'), 0, payload_offset: 8, payload_size: 8)
+
+      expect(walk[:addresses].length).to eq(1000)
+      expect(walk[:payloads].map { |bytes| bytes.unpack1('q<') }).to eq((0...1000).to_a)
+      expect(walk).to include(revisited: false, truncated: false, read_failed: false)
+      expect(process.walk_links(walk[:addresses].first, 0, max_nodes: 10)).to include(truncated: true)
+      process.kill
+    end
+
+    it 'stops at cycles and walks trees in preorder' do
+      process = target.launch
+
+      ring = process.walk_links(evaluate(process, '&lldb_test_ring'), 0)
+      tree = process.walk_links(evaluate(process, '&lldb_test_tree_nodes'), [0, 8], payload_offset: 16, payload_size: 8)
+
+      expect(ring[:addresses].length).to eq(3)
+      expect(ring[:revisited]).to be(true)
+      expect(tree[:payloads].map { |bytes| bytes.unpack1('q<') }).to eq([0, 1, 3, 4, 2, 5, 6])
+      process.kill
+    end
+  end
+
+  describe '#find_references' do
+    let(:executable) { compile_fixture('linked') }
+
+    before do
+      debugger.async = false
+      target.breakpoint_create_by_name('lldb_test_ready')
+    end
+
+    def evaluate(process, expression)
+      process.selected_thread.selected_frame.evaluate_expression(expression).value_as_unsigned
+    end
+
+    it 'reports the words that point into each range' do
+      process = target.launch
+      head = evaluate(process, 'lldb_test_list')
+      ring = evaluate(process, '&lldb_test_ring')
+      second = evaluate(process, '&lldb_test_ring[1]')
+
+      result = process.find_references([[head, 16], [second, 8]])
+      edges = result[:references]
+
+      expect(result).to include(total: edges.length, truncated: false)
+      expect(edges.map { |edge| edge[:referrer] }).to eq(edges.map { |edge| edge[:referrer] }.sort)
+      expect(edges).to include({ referrer: evaluate(process, '&lldb_test_list'), target: head, range: 0 })
+      expect(edges).to include({ referrer: ring, target: second, range: 1 })
+
+      capped = process.find_references([[head, 16], [second, 8]], max_references: 1)
+      expect(capped[:references]).to eq(edges.first(1))
+      expect(capped).to include(total: edges.length, truncated: true)
+      process.kill
+    end
+  end
+
+  describe '#scan_memory' do
+    before do
+      debugger.async = false
+      target.breakpoint_create_by_name('main')
+    end
+
+    it 'finds exact and masked byte patterns' do
+      process = target.launch
+
+      hits = process.scan_memory('Sum: %d')
+      masked = process.scan_memory("S\0m: %d", mask: "\xFF\x00\xFF\xFF\xFF\xFF\xFF".b)
+
+      expect(hits).not_to be_empty
+      expect(hits).to eq(hits.sort)
+      expect(process.read_memory(hits.first, 7)).to eq('Sum: %d')
+      expect(masked).to include(*hits)
+      expect(process.scan_memory('Sum: %d', max_hits: 1)).to eq([hits.first])
+      process.kill
+    end
+
+    it 'rejects masks that do not match the pattern length' do
+      process = target.launch
+
+      expect { process.scan_memory('Sum', mask: "\xFF") }.to raise_error(ArgumentError)
+      process.kill
+    end
+  end
+
+  describe '#track_memory' do
+    before do
+      debugger.async = false
+      target.breakpoint_create_by_name('main')
+      target.breakpoint_create_by_name('lldb_test_add')
+    end
+
+    it 'reports the stack bytes written between two stops' do
+      process = target.launch
+      tracker = process.track_memory(byte_diff: true)
+      expect(tracker.page_count).to be > 0
+      expect(tracker.update).to eq([])
+
+      process.continue
+      sp = process.selected_thread.selected_frame.sp
+      changes = tracker.update
+
+      expect(changes).to all(include(:address, :size, :kind))
+      stack_page = sp & ~4095
+      expect(changes).to include(a_hash_including(kind: :modified, address: be_between(stack_page, stack_page + 8191)))
+      tracker.close
+      process.kill
+    end
+  end
+
   describe '#get_stdout' do
     before do
       debugger.async = false
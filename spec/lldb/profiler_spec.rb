@@ -0,0 +1,86 @@
+# frozen_string_literal: true
+
+RSpec.describe LLDB::Profiler do
+  let(:debugger) { LLDB::Debugger.create }
+  let(:target) { debugger.create_target(compile_fixture('loop')) }
+
+  # loop.c spins in lldb_test_spin for the given number of rounds, about a
+  # microsecond and a half each.
+  def launch_spinning(rounds)
+    debugger.async = true
+    process = target.launch(args: [rounds.to_s])
+    deadline = Time.now + 10
+    sleep 0.01 until process.running? || Time.now > deadline
+    process
+  end
+
+  def wait_until_done(profiler)
+    deadline = Time.now + 10
+    sleep 0.01 while profiler.running? && Time.now < deadline
+  end
+
+  it 'samples a running process and writes folded stacks' do
+    process = launch_spinning(100_000_000)
+    profiler = process.start_profiler(interval: 0.005)
+    sleep 0.5
+    profiler.stop
+
+    stats = profiler.stats
+    expect(profiler).not_to be_running
+    expect(stats[:samples]).to be > 0
+    expect(stats[:paused]).to be <= stats[:elapsed]
+
+    lines = profiler.folded.lines
+    expect(lines).to all(match(/\A\S.* \d+\n\z/))
+    expect(lines.sum { |line| line[/\d+$/].to_i }).to be >= stats[:samples]
+    expect(lines.join).to include('main;lldb_test_spin;lldb_test_spin_inner ')
+    process.kill
+  end
+
+  it 'writes a pprof profile' do
+    process = launch_spinning(100_000_000)
+    profiler = process.start_profiler(interval: 0.005) { sleep 0.3 }
+
+    pprof = profiler.pprof
+    expect(pprof.encoding).to eq(Encoding::BINARY)
+    expect(pprof).to include('samples', 'nanoseconds', 'lldb_test_spin_inner', 'loop.c')
+    expect(profiler.pprof).to eq(pprof)
+    process.kill
+  end
+
+  it 'refuses to write the profile while sampling' do
+    process = launch_spinning(100_000_000)
+    profiler = process.start_profiler(interval: 0.01)
+
+    expect { profiler.folded }.to raise_error(LLDB::OperationError, /still sampling/)
+    profiler.stop
+    process.kill
+  end
+
+  it 'stops sampling when the process exits' do
+    process = launch_spinning(200_000)
+    profiler = process.start_profiler(interval: 0.002)
+    wait_until_done(profiler)
+
+    expect(profiler).not_to be_running
+    expect(profiler.folded).to be_a(String)
+    expect(process.state).to eq(LLDB::State::EXITED)
+  end
+
+  it 'requires an asynchronous debugger' do
+    debugger.async = false
+    target.breakpoint_create_by_name('lldb_test_spin')
+    process = target.launch(args: ['1000'])
+
+    expect { process.start_profiler }.to raise_error(LLDB::OperationError, /asynchronous/)
+    process.kill
+  end
+
+  it 'validates its arguments' do
+    process = launch_spinning(100_000_000)
+
+    expect { process.start_profiler(interval: 0) }.to raise_error(ArgumentError)
+    expect { process.start_profiler(max_depth: 0) }.to raise_error(ArgumentError)
+    process.kill
+  end
+end
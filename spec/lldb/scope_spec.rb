@@ -0,0 +1,64 @@
+# frozen_string_literal: true
+
+RSpec.describe LLDB::Scope do
+  let(:debugger) { LLDB::Debugger.create }
+  let(:executable) { compile_fixture('simple') }
+  let(:target) { debugger.create_target(executable) }
+  let(:process) do
+    debugger.async = false
+    target.breakpoint_create_by_name('lldb_test_add')
+    target.launch
+  end
+  let(:thread) { process.selected_thread }
+
+  after do
+    process.kill if process&.valid?
+  end
+
+  it 'is only current inside LLDB.with_scope' do
+    expect(described_class.current).to be_nil
+    LLDB.with_scope { |scope| expect(described_class.current).to eq(scope) }
+    expect(described_class.current).to be_nil
+  end
+
+  it 'allocates frames and values from the scope and closes them on exit' do
+    frame = thread.selected_frame
+    escaped = nil
+
+    result = LLDB.with_scope do |scope|
+      scoped_frame = thread.selected_frame
+      escaped = scoped_frame.find_variable('a')
+
+      expect(scope.handle_count).to eq(2)
+      escaped.to_i
+    end
+
+    expect(result).to eq(frame.find_variable('a').to_i)
+    expect(escaped).to be_closed
+    expect(escaped).not_to be_valid
+    expect(frame).to be_valid
+  end
+
+  it 'restores the enclosing scope after a nested one' do
+    LLDB.with_scope do |outer|
+      LLDB.with_scope { thread.selected_frame.find_variable('a') }
+      thread.selected_frame
+
+      expect(described_class.current).to eq(outer)
+      expect(outer.handle_count).to eq(1)
+    end
+  end
+
+  it 'releases the scope when the block raises' do
+    captured = nil
+
+    expect do
+      LLDB.with_scope do |scope|
+        captured = scope
+        raise 'boom'
+      end
+    end.to raise_error(RuntimeError, 'boom')
+    expect(captured).to be_closed
+    expect(described_class.current).to be_nil
+  end
+end
@@ -181,6 +181,62 @@ RSpec.describe LLDB::Target do
     end
   end
 
+  describe '#symbolicate' do
+    before do
+      debugger.async = false
+      target.breakpoint_create_by_name('lldb_test_add')
+    end
+
+    it 'symbolicates addresses like the frames at them' do
+      process = target.launch
+      frame = process.selected_thread.frame_at_index(0)
+      caller_frame = process.selected_thread.frame_at_index(1)
+      inner, outer, unknown = target.symbolicate([frame.pc, caller_frame.pc - 1, 0])
+
+      expect(inner).to include(address: frame.pc, module: 'simple', function: 'lldb_test_add', line: frame.line,
+                               inlined_into: [])
+      expect(inner[:file]).to end_with('simple.c')
+      expect(outer).to include(function: 'main', line: caller_frame.line)
+      expect(unknown).to include(address: 0, module: nil, function: nil, file: nil, line: nil)
+      process.kill
+    end
+
+    it 'serves repeated addresses from the cache' do
+      process = target.launch
+      pc = process.selected_thread.frame_at_index(0).pc
+      described_class.clear_symbol_cache
+      before = described_class.symbol_cache_stats
+
+      target.symbolicate([pc])
+      first = target.symbolicate([pc, pc])
+      stats = described_class.symbol_cache_stats
+
+      expect(stats[:misses] - before[:misses]).to eq(1)
+      expect(stats[:hits] - before[:hits]).to eq(2)
+      expect(stats[:entries]).to eq(1)
+      expect(first[0]).to eq(first[1])
+      process.kill
+    end
+
+    it 'drops cached entries when a relaunch loads the module again' do
+      process = target.launch
+      pc = process.selected_thread.frame_at_index(0).pc
+      described_class.clear_symbol_cache
+      target.symbolicate([pc])
+      expect(described_class.symbol_cache_stats[:entries]).to eq(1)
+      process.kill
+
+      process = target.launch
+      before = described_class.symbol_cache_stats
+      target.symbolicate([process.selected_thread.frame_at_index(0).pc])
+      stats = described_class.symbol_cache_stats
+
+      expect(stats[:misses] - before[:misses]).to eq(1)
+      expect(stats[:entries]).to eq(1)
+      process.kill
+    end
+  end
+
   describe 'watchpoint methods' do
     it 'has num_watchpoints returning 0 for a new target' do
       expect(target.num_watchpoints).to eq(0)
@@ -96,4 +96,44 @@ RSpec.describe LLDB::Type do
       expect(type.virtual_base_class_at_index(0)).to be_nil
     end
   end
+
+  describe '#layout' do
+    let(:expected) { { 'first' => [42], 'flags' => [5], 'second' => [3.5] } }
+
+    it 'flattens fields, including bitfields' do
+      skip 'Value or type not found' if type.nil?
+      fields = type.layout.fields
+
+      expect(fields.map { |field| field[:name] }).to eq(%w[first flags second])
+      expect(fields.map { |field| field[:type] }).to eq(%i[int32 uint32 double])
+      expect(fields[1][:bit_size]).to eq(3)
+      expect(type.layout.byte_size).to eq(type.byte_size)
+    end
+
+    it 'decodes raw memory into one column per field' do
+      skip 'Value or type not found' if type.nil?
+      bytes = process.read_memory(value.load_address, type.byte_size)
+
+      expect(type.layout.decode(bytes)).to eq(expected)
+      expect(type.layout.decode(bytes * 2)).to eq(expected.transform_values { |column| column * 2 })
+      expect(process.read_structs(value.load_address, type, 1)).to eq(expected)
+    end
+
+    it 'skips unnamed and zero-width bitfields' do
+      padded = thread.frame_at_index(1).find_variable('padded')
+      skip 'Value or type not found' if padded.nil?
+      layout = padded.type.layout
+
+      expect(layout.fields.map { |field| field[:name] }).to eq(%w[low high])
+      bytes = process.read_memory(padded.load_address, layout.byte_size)
+      expect(layout.decode(bytes)).to eq('low' => [9], 'high' => [17])
+    end
+
+    it 'treats a scalar type as a single unnamed field' do
+      skip 'Value or type not found' if type.nil?
+      fields = type.pointer_type.layout.fields
+
+      expect(fields.map { |field| field.slice(:name, :offset, :type) }).to eq([{ name: '', offset: 0, type: :pointer }])
+    end
+  end
 end
@@ -0,0 +1,48 @@
+# frozen_string_literal: true
+
+RSpec.describe LLDB::ValueSearch do
+  let(:debugger) { LLDB::Debugger.create }
+  let(:executable) { compile_fixture('counter') }
+  let(:target) { debugger.create_target(executable) }
+
+  before do
+    debugger.async = false
+    target.breakpoint_create_by_name('lldb_test_tick')
+  end
+
+  def address_of(process, symbol)
+    process.selected_thread.selected_frame.evaluate_expression("&#{symbol}").value_as_unsigned
+  end
+
+  it 'narrows an integer search down to the counter across stops' do
+    process = target.launch
+    counter = address_of(process, 'lldb_test_counter')
+
+    search = process.search_value(1_234_568, :int32)
+    expect(search.results(limit: search.count)).to include({ address: counter, value: 1_234_568 })
+
+    process.continue
+    expect(search.narrow(:increased)).to be >= 1
+    process.continue
+    search.narrow(:equal, 1_234_570)
+
+    addresses = search.results.map { |result| result[:address] }
+    expect(search.results).to include({ address: counter, value: 1_234_570 })
+    expect(addresses).to eq(addresses.sort)
+    process.kill
+  end
+
+  it 'searches floating-point values' do
+    process = target.launch
+    level = address_of(process, 'lldb_test_level')
+
+    search = process.search_value(1.5, :double)
+    process.continue
+    search.narrow(:greater, 2.0)
+
+    expect(search.results).to include({ address: level, value: 3.0 })
+    expect { search.narrow(:less) }.to raise_error(ArgumentError)
+    expect { process.search_value(1, :pointer) }.to raise_error(ArgumentError)
+    process.kill
+  end
+end
@@ -135,4 +135,130 @@ RSpec.describe LLDB::Value do
       expect(value.pointer_type?).to be false
     end
   end
+
+  describe '#each_child' do
+    let(:executable) { compile_fixture('arrays') }
+    let(:process) do
+      debugger.async = false
+      target.breakpoint_create_by_name('main')
+      target.launch
+    end
+    let(:ints) { frame.evaluate_expression('lldb_test_ints') }
+
+    it 'yields every child across batches with its index' do
+      children = ints.each_child(batch: 3).to_a
+
+      expect(children.map { |child| child[:index] }).to eq((0...8).to_a)
+      expect(children.map { |child| child[:value] }).to eq(%w[1 -2 3 -4 5 -6 7 -8])
+      expect(children.map { |child| child[:name] }).to eq(ints.children.map(&:name))
+    end
+
+    it 'reports the cursor position as batches are read' do
+      cursor = ints.children_cursor
+
+      expect(cursor.num_children).to eq(8)
+      expect(cursor.next_batch(5).size).to eq(5)
+      expect(cursor.position).to eq(5)
+      expect(cursor.next_batch(5).size).to eq(3)
+      expect(cursor.next_batch(5)).to be_empty
+    ensure
+      cursor&.close
+    end
+  end
+
+  describe '#raw_bytes' do
+    it 'returns the bytes behind a scalar' do
+      expect(value.raw_bytes.bytesize).to eq(value.byte_size)
+      expect(value.raw_bytes.unpack1('l')).to eq(value.to_i)
+    end
+  end
+
+  describe '#read_as' do
+    let(:executable) { compile_fixture('arrays') }
+    let(:process) do
+      debugger.async = false
+      target.breakpoint_create_by_name('main')
+      target.launch
+    end
+
+    it 'decodes arrays without value formatting' do
+      expect(frame.evaluate_expression('lldb_test_doubles').read_as(:double)).to eq([0.5, 1.5, 2.5, 3.5])
+      expect(frame.evaluate_expression('lldb_test_ints').read_as(:int32)).to eq([1, -2, 3, -4, 5, -6, 7, -8])
+      expect(frame.evaluate_expression('lldb_test_ints').read_as(:int64).size).to eq(4)
+      expect { frame.evaluate_expression('lldb_test_ints').read_as(:bogus) }.to raise_error(ArgumentError)
+    end
+  end
+
+  describe '#container_elements' do
+    let(:executable) { compile_fixture('containers') }
+    let(:process) do
+      debugger.async = false
+      target.breakpoint_create_by_name('lldb_test_containers_ready')
+      target.launch
+    end
+    let(:main_frame) { thread.frame_at_index(1) }
+
+    def variable(name)
+      main_frame.find_variable(name)
+    end
+
+    it 'reads vectors of scalars without synthetic children' do
+      ints = variable('ints')
+
+      expect(ints.container_info).to include(kind: :vector, count: 1_000_000, element_type: :int32)
+      expect(ints.container_elements(start: 10, count: 3)).to eq([30, 33, 36])
+      expect(ints.container_elements.last).to eq(2_999_997)
+      expect(ints.container_elements(count: 2, packed: true).unpack('l*')).to eq([0, 3])
+    end
+
+    it 'returns raw bytes for struct elements' do
+      samples = variable('samples')
+      layout = samples.container_elements(packed: true)
+
+      expect(samples.container_elements.map(&:bytesize)).to eq([16] * 3)
+      expect(samples.child_at_index(0).type.layout.decode(layout)['weight']).to eq([0.25, 0.5, 0.75])
+    end
+
+    it 'reads short and long strings' do
+      expect(variable('short_text').container_elements).to eq('lldb')
+      expect(variable('long_text').container_elements).to eq('x' * 4096)
+    end
+
+    it 'walks hashed containers' do
+      halves = variable('halves').container_elements(count: 5)
+
+      expect(variable('halves').container_info).to include(kind: :unordered_map, count: 1_000_000)
+      expect(halves.size).to eq(5)
+      halves.each { |key, half| expect(half).to eq(key * 0.5) }
+      expect(variable('ids').container_elements).to contain_exactly(7, 11, 13)
+    end
+
+    it 'leaves unsupported values to the synthetic path' do
+      expect(variable('flags').container_info).to be_nil
+      expect(variable('flags').container_elements).to be_nil
+    end
+  end
+
+  describe '#to_tree' do
+    it 'serializes a scalar as a single node' do
+      tree = value.to_tree
+
+      expect(tree).to include(name: 'a', type_name: value.type_name, value: value.value, children: [])
+      expect(tree[:address]).to eq(value.load_address)
+      expect(tree[:error]).to be false
+    end
+
+    it 'expands children up to the requested depth' do
+      frame_value = thread.frame_at_index(1).find_variable('argv')
+      skip 'argv not available' if frame_value.nil?
+
+      expect(frame_value.to_tree(depth: 0)[:children]).to be_nil
+      children = frame_value.to_tree(depth: 1)[:children]
+      expect(children.map { |child| child[:name] }).to eq(frame_value.children.map(&:name))
+    end
+
+    it 'rejects a negative depth' do
+      expect { value.to_tree(depth: -1) }.to raise_error(ArgumentError)
+    end
+  end
 end
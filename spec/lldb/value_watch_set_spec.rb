@@ -0,0 +1,38 @@
+# frozen_string_literal: true
+
+RSpec.describe LLDB::ValueWatchSet do
+  let(:debugger) { LLDB::Debugger.create }
+  let(:executable) { compile_fixture('counter') }
+  let(:target) { debugger.create_target(executable) }
+
+  before do
+    debugger.async = false
+    target.breakpoint_create_by_name('lldb_test_tick')
+  end
+
+  def frame_of(process)
+    process.selected_thread.selected_frame
+  end
+
+  it 'reports only the paths whose bytes changed between stops' do
+    process = target.launch
+    watch = described_class.new(%w[lldb_test_counter lldb_test_level])
+    missing = watch.add('lldb_test_missing')
+
+    first = watch.update(frame_of(process))
+    expect(first.map { |change| change[:path] }).to eq(%w[lldb_test_counter lldb_test_level])
+    expect(first.map { |change| change[:old] }).to all(be_nil)
+    expect(first[0][:new].unpack1('l')).to eq(1_234_568)
+    expect(watch.update(frame_of(process))).to be_empty
+
+    process.continue
+    changes = watch.update(frame_of(process))
+    counter = changes.find { |change| change[:index].zero? }
+    expect(changes.map { |change| change[:index] }).to contain_exactly(0, 1)
+    expect(changes.map { |change| change[:index] }).not_to include(missing)
+    expect(counter[:old].unpack1('l')).to eq(1_234_568)
+    expect(counter[:new].unpack1('l')).to eq(1_234_569)
+    expect(watch.size).to eq(3)
+    process.kill
+  end
+end
@@ -30,13 +30,16 @@ def fixture_path(name)
   File.expand_path("fixtures/#{name}", __dir__)
 end
 
-# Helper to compile a C fixture
+# Helper to compile a C or C++ fixture
 def compile_fixture(name)
-  source = fixture_path("#{name}.c")
+  cxx = File.exist?(fixture_path("#{name}.cpp"))
+  source = fixture_path(cxx ? "#{name}.cpp" : "#{name}.c")
   output = fixture_path(name)
 
   unless File.exist?(output) && File.mtime(output) > File.mtime(source)
-    system('gcc', '-g', '-O0', '-o', output, source, exception: true)
+    # Symbolication caches only modules with a UUID; ask ELF linkers for one.
+    flags = RUBY_PLATFORM.include?('linux') ? ['-Wl,--build-id'] : []
+    system(cxx ? 'g++' : 'gcc', '-g', '-O0', *flags, '-o', output, source, exception: true)
   end
 
   output